@@ -0,0 +1,153 @@
+#include "flash_file.h"
+#include <string.h>
+
+static uint32_t next_rand(uint32_t *state)
+{
+    // xorshift32
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static bool in_range(const flash_file_t *flash, uint32_t offset, uint32_t len)
+{
+    return offset <= flash->size && len <= flash->size - offset;
+}
+
+// Bytes of an operation of `len` bytes done before the power fails, `len` if it doesn't
+static uint32_t power_take(flash_file_t *flash, uint32_t len, bool erase)
+{
+    if (flash->power_left < 0 || flash->power_left >= len || (flash->power_in_erase && !erase))
+    {
+        if (flash->power_left >= 0 && (erase || !flash->power_in_erase))
+            flash->power_left -= len;
+        return len;
+    }
+    uint32_t done = (uint32_t)flash->power_left;
+    flash->power_left = -1;
+    flash->power_off = true;
+    return done;
+}
+
+static bool file_read(flash_file_t *flash, uint32_t offset, void *buf, uint32_t len)
+{
+    return fseek(flash->file, offset, SEEK_SET) == 0 && fread(buf, 1, len, flash->file) == len;
+}
+
+static bool file_write(flash_file_t *flash, uint32_t offset, const void *buf, uint32_t len)
+{
+    return fseek(flash->file, offset, SEEK_SET) == 0 && fwrite(buf, 1, len, flash->file) == len &&
+           fflush(flash->file) == 0;
+}
+
+static bool flash_read(void *ctx, uint32_t offset, void *buf, uint32_t len)
+{
+    flash_file_t *flash = ctx;
+    if (flash->power_off || !in_range(flash, offset, len))
+        return false;
+    return file_read(flash, offset, buf, len);
+}
+
+static bool flash_write(void *ctx, uint32_t offset, const void *buf, uint32_t len)
+{
+    flash_file_t *flash = ctx;
+    if (flash->power_off || !in_range(flash, offset, len))
+        return false;
+
+    uint8_t data[SAMPLE_LOG_SECTOR_SIZE];
+    const uint8_t *src = buf;
+    while (len > 0)
+    {
+        uint32_t n = len < sizeof(data) ? len : sizeof(data);
+        if (!file_read(flash, offset, data, n))
+            return false;
+
+        uint32_t done = power_take(flash, n, false);
+        for (uint32_t i = 0; i < done; i++)
+            data[i] &= src[i];
+        if (done < n)
+            data[done] &= src[done] | (uint8_t)next_rand(&flash->rand);
+        if (!file_write(flash, offset, data, done < n ? done + 1 : n) || done < n)
+            return false;
+
+        offset += n;
+        src += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool flash_erase(void *ctx, uint32_t offset, uint32_t len)
+{
+    flash_file_t *flash = ctx;
+    if (flash->power_off || !in_range(flash, offset, len) || offset % SAMPLE_LOG_SECTOR_SIZE ||
+        len % SAMPLE_LOG_SECTOR_SIZE)
+        return false;
+
+    uint8_t erased[SAMPLE_LOG_SECTOR_SIZE];
+    memset(erased, 0xFF, sizeof(erased));
+    for (; len > 0; offset += SAMPLE_LOG_SECTOR_SIZE, len -= SAMPLE_LOG_SECTOR_SIZE)
+    {
+        uint32_t done = power_take(flash, SAMPLE_LOG_SECTOR_SIZE, true);
+        if (!file_write(flash, offset, erased, done) || done < SAMPLE_LOG_SECTOR_SIZE)
+            return false;
+    }
+    return true;
+}
+
+bool flash_file_create(flash_file_t *flash, const char *path, uint32_t size)
+{
+    memset(flash, 0, sizeof(*flash));
+    flash->size = size;
+    flash->power_left = -1;
+    flash->rand = 1;
+    flash->file = fopen(path, "w+b");
+    if (!flash->file)
+        return false;
+
+    uint8_t erased[SAMPLE_LOG_SECTOR_SIZE];
+    memset(erased, 0xFF, sizeof(erased));
+    for (uint32_t offset = 0; offset < size; offset += sizeof(erased))
+    {
+        if (!file_write(flash, offset, erased, size - offset < sizeof(erased) ? size - offset : sizeof(erased)))
+        {
+            flash_file_close(flash);
+            return false;
+        }
+    }
+    return true;
+}
+
+void flash_file_close(flash_file_t *flash)
+{
+    if (flash->file)
+        fclose(flash->file);
+    flash->file = NULL;
+}
+
+sample_log_flash_t flash_file_get_flash(flash_file_t *flash)
+{
+    sample_log_flash_t callbacks = {
+        .read = flash_read,
+        .write = flash_write,
+        .erase = flash_erase,
+        .ctx = flash,
+        .size = flash->size,
+    };
+    return callbacks;
+}
+
+void flash_file_set_power_loss(flash_file_t *flash, uint32_t bytes, bool in_erase, uint32_t seed)
+{
+    flash->power_left = bytes;
+    flash->power_in_erase = in_erase;
+    flash->rand = seed ? seed : 1;
+}
+
+void flash_file_power_on(flash_file_t *flash)
+{
+    flash->power_left = -1;
+    flash->power_off = false;
+}
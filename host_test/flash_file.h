@@ -0,0 +1,36 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "sample_log.h"
+
+// A flash partition in a file, to run sample_log on Linux. Like NOR flash, writing only clears bits and
+// erasing sets them again.
+//
+// The power can be set to fail after some more bytes are written or erased, or only erased. The write or
+// erase in progress then stops at that byte: the bytes before it are done, the byte itself only partly (a random
+// subset of its bits), the rest not at all. It fails, and so does every access until flash_file_power_on().
+typedef struct
+{
+    FILE *file;
+    uint32_t size;
+    int64_t power_left;  // Bytes written or erased until the power fails, -1 if it doesn't
+    bool power_in_erase; // Count only the bytes erased
+    bool power_off;
+    uint32_t rand;       // State of the random generator of the partly written bytes
+} flash_file_t;
+
+// Create an erased partition of `size` bytes in `path`. Returns false on error.
+bool flash_file_create(flash_file_t *flash, const char *path, uint32_t size);
+
+void flash_file_close(flash_file_t *flash);
+
+// Callbacks for sample_log_open()
+sample_log_flash_t flash_file_get_flash(flash_file_t *flash);
+
+// Let the power fail after `bytes` more bytes are written or erased, or only erased if `in_erase` is true
+void flash_file_set_power_loss(flash_file_t *flash, uint32_t bytes, bool in_erase, uint32_t seed);
+
+// Restore the power after a power loss
+void flash_file_power_on(flash_file_t *flash);
@@ -0,0 +1,238 @@
+// Runs the sample log for at least 120 simulated days on a file-backed partition, with 300 power losses at
+// random points of the flash writes and erases, and restarts in between. After each restart the log must hold
+// the records written before, in order and unchanged, and continue after the newest one.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flash_file.h"
+#include "sample_log.h"
+
+#define PARTITION_SIZE (512 * 1024) // "samples" in partitions.csv
+#define SIM_DAYS 120
+#define POWER_LOSSES 300
+#define SAMPLE_S 5                  // Signal update interval of the SCD4x
+#define FLUSH_S (10 * 60)           // SAMPLE_LOG_FLUSH_MS in main.c
+#define RUN_S (SIM_DAYS * 24 * 3600 / (POWER_LOSSES * 4 / 3))
+#define MAX_RECORDS (2 * SIM_DAYS * 24 * 3600 / SAMPLE_LOG_INTERVAL_S) // Room for runs longer than RUN_S
+
+#define CHECK(cond)                                                                  \
+    do                                                                               \
+    {                                                                                \
+        if (!(cond))                                                                 \
+        {                                                                            \
+            fprintf(stderr, "%s:%d: run %u: %s\n", __FILE__, __LINE__, run, #cond); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+static uint32_t run;
+static uint32_t rand_state = 12345;
+
+// Records of the complete intervals in the order they were added. The first `durable_cnt` are written.
+static sample_log_record_t records[MAX_RECORDS];
+static uint32_t record_cnt;
+static uint32_t durable_cnt;
+
+static sample_log_record_t read_back[MAX_RECORDS];
+
+static uint32_t rand_below(uint32_t n)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state % n;
+}
+
+static int32_t rand_between(int32_t min, int32_t max)
+{
+    return min + (int32_t)rand_below(max - min + 1);
+}
+
+static int32_t clamp(int32_t v, int32_t min, int32_t max)
+{
+    return v < min ? min : v > max ? max : v;
+}
+
+static bool record_equal(const sample_log_record_t *a, const sample_log_record_t *b)
+{
+    return a->time_s == b->time_s && a->co2_ppm == b->co2_ppm && a->temp_ddeg == b->temp_ddeg &&
+           a->rh_dpct == b->rh_dpct;
+}
+
+// Measurement of the next interval. Mostly small changes, sometimes larger ones, rarely a jump, so every
+// record encoding is used.
+static void next_values(sample_log_record_t *rec)
+{
+    uint32_t r = rand_below(100);
+    int32_t range = r < 80 ? 2 : r < 97 ? 20 : 1000;
+    rec->co2_ppm = (uint16_t)clamp(rec->co2_ppm + rand_between(-range, range), 400, 5000);
+    rec->temp_ddeg = (int16_t)clamp(rec->temp_ddeg + rand_between(-range / 2, range / 2), -100, 400);
+    rec->rh_dpct = (uint16_t)clamp(rec->rh_dpct + rand_between(-range / 2, range / 2), 0, 1000);
+}
+
+// Read the log back and compare it with the records added. `durable_max` records are there if a chunk
+// being written at the power loss was written completely anyway.
+static void check_log(const sample_log_t *log, uint32_t durable_max)
+{
+    sample_log_iter_t iter;
+    sample_log_record_t rec;
+    uint32_t n = 0;
+    sample_log_iter_init(log, &iter, 0);
+    while (sample_log_iter_next(&iter, &rec))
+    {
+        CHECK(n < MAX_RECORDS);
+        read_back[n++] = rec;
+    }
+
+    if (n == 0)
+    {
+        CHECK(durable_cnt == 0);
+        CHECK(sample_log_get_end_time(log) == 0);
+        record_cnt = 0;
+        return;
+    }
+
+    // The oldest records may be overwritten. The rest have to be there, exactly as added.
+    uint32_t first = 0;
+    while (first < record_cnt && records[first].time_s < read_back[0].time_s)
+        first++;
+    CHECK(first + n <= record_cnt);
+    for (uint32_t i = 0; i < n; i++)
+        CHECK(record_equal(&read_back[i], &records[first + i]));
+    uint32_t end = first + n;
+    CHECK(end == durable_cnt || end == durable_max);
+    CHECK(sample_log_get_end_time(log) == records[end - 1].time_s + SAMPLE_LOG_INTERVAL_S);
+
+    // Reading the last day, as at boot, starts at the sector holding its start and returns the same records
+    uint32_t from_s = records[end - 1].time_s > 24 * 3600 ? records[end - 1].time_s - 24 * 3600 : 0;
+    sample_log_iter_init(log, &iter, from_s);
+    CHECK(sample_log_iter_next(&iter, &rec));
+    uint32_t i = first;
+    while (i < end && records[i].time_s < rec.time_s)
+        i++;
+    CHECK(rec.time_s <= from_s || i == first);
+    do
+        CHECK(i < end && record_equal(&rec, &records[i++]));
+    while (sample_log_iter_next(&iter, &rec));
+    CHECK(i == end);
+
+    // The records lost with the power will be added again with the times after the log
+    record_cnt = durable_cnt = end;
+}
+
+int main(void)
+{
+    flash_file_t flash;
+    if (!flash_file_create(&flash, "test_sample_log.bin", PARTITION_SIZE))
+    {
+        perror("test_sample_log.bin");
+        return 1;
+    }
+    sample_log_flash_t callbacks = flash_file_get_flash(&flash);
+
+    static sample_log_t log;
+    sample_log_record_t values = {.co2_ppm = 600, .temp_ddeg = 220, .rh_dpct = 450};
+    uint64_t sim_s = 0;
+    uint32_t power_losses = 0;
+    uint32_t restarts = 0;
+    uint32_t durable_max = 0;
+
+    while (power_losses < POWER_LOSSES || sim_s < SIM_DAYS * 24 * 3600)
+    {
+        CHECK(sample_log_open(&log, &callbacks));
+        check_log(&log, durable_max);
+
+        // Power loss at a random point of the writes and erases, unless this run ends with a restart
+        bool restart = run % 4 == 3;
+        uint32_t run_s = rand_between(SAMPLE_S, 2 * RUN_S);
+        uint32_t time_offset_s = sample_log_get_end_time(&log);
+        uint32_t slot = UINT32_MAX;
+        uint32_t flush_s = 0;
+        uint32_t outage_end_s = 0;
+        uint32_t uptime_s;
+
+        for (uptime_s = rand_between(1, 10);; uptime_s += SAMPLE_S)
+        {
+            if (uptime_s >= run_s && !flash.power_off && flash.power_left < 0)
+            {
+                if (restart)
+                    break;
+                // Mostly in the next chunk written or the one after, sometimes in the next sector erased
+                if (rand_below(4) == 0)
+                    flash_file_set_power_loss(&flash, rand_below(SAMPLE_LOG_SECTOR_SIZE), true, rand_state);
+                else
+                    flash_file_set_power_loss(&flash, rand_below(2 * SAMPLE_LOG_CHUNK_MAX), false, rand_state);
+            }
+
+            // Sometimes the sensor can't be read for a while, that leaves a gap in the log
+            if (uptime_s < outage_end_s)
+                continue;
+            if (rand_below(5000) == 0)
+                outage_end_s = uptime_s + rand_between(60, 3600);
+
+            history_sample_t sample = {
+                .time_s = time_offset_s + uptime_s,
+                .co2_ppm = values.co2_ppm,
+                .temp_cdeg = values.temp_ddeg * 10,
+                .rh_cpct = values.rh_dpct * 10,
+            };
+            // The test keeps the values the same in an interval, so their average is exact
+            uint32_t sample_slot = sample.time_s / SAMPLE_LOG_INTERVAL_S;
+            if (sample_slot != slot)
+            {
+                if (slot != UINT32_MAX)
+                {
+                    CHECK(record_cnt < MAX_RECORDS);
+                    records[record_cnt] = values;
+                    records[record_cnt++].time_s = slot * SAMPLE_LOG_INTERVAL_S;
+                    next_values(&values);
+                    sample.co2_ppm = values.co2_ppm;
+                    sample.temp_cdeg = values.temp_ddeg * 10;
+                    sample.rh_cpct = values.rh_dpct * 10;
+                }
+                slot = sample_slot;
+            }
+
+            bool ok = sample_log_add(&log, &sample);
+            if (ok && uptime_s - flush_s >= FLUSH_S)
+            {
+                flush_s = uptime_s;
+                ok = sample_log_flush(&log);
+            }
+            if (flash.power_off)
+                break;
+            CHECK(ok);
+            durable_cnt = record_cnt - log.chunk_cnt;
+        }
+
+        if (restart)
+        {
+            CHECK(sample_log_flush(&log));
+            durable_cnt = durable_max = record_cnt;
+            restarts++;
+        }
+        else
+        {
+            // The chunk being written at the power loss may or may not have made it
+            durable_max = record_cnt - log.chunk_cnt;
+            flash_file_power_on(&flash);
+            power_losses++;
+        }
+        sim_s += uptime_s;
+        run++;
+    }
+
+    CHECK(sample_log_open(&log, &callbacks));
+    check_log(&log, durable_max);
+    CHECK(record_cnt > 0);
+    uint32_t kept_s = records[record_cnt - 1].time_s - read_back[0].time_s;
+    printf("%u days, %u power losses, %u restarts: %u records kept, %.1f days\n", (unsigned)(sim_s / (24 * 3600)),
+           power_losses, restarts, record_cnt, kept_s / (24.0 * 3600));
+    // Most of the partition holds records: wasted sectors after torn chunks and short chunks are the exception
+    CHECK(kept_s > 30 * 24 * 3600);
+
+    flash_file_close(&flash);
+    remove("test_sample_log.bin");
+    return 0;
+}
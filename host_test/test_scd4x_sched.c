@@ -0,0 +1,147 @@
+// Runs the SCD4x task's schedule for 24 simulated hours against a stub of the sensor's I2C commands, with the
+// sensor clock off by -3..+3 %, with and without failing data ready checks. Every measurement has to be read
+// before the next one replaces it, shortly after it's ready, with few data ready checks.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "scd4x_sched.h"
+
+#define SIM_MS (24 * 3600 * 1000LL)
+#define WARM_UP_MS (30 * 60 * 1000) // The schedule learns the sensor's period meanwhile
+#define I2C_ERROR_RATE 500         // One data ready check in this many fails, if they fail
+
+#define CHECK(cond)                                                                           \
+    do                                                                                        \
+    {                                                                                         \
+        if (!(cond))                                                                          \
+        {                                                                                     \
+            fprintf(stderr, "%s:%d: drift %d %%: %s\n", __FILE__, __LINE__, drift_pct, #cond); \
+            exit(1);                                                                          \
+        }                                                                                     \
+    } while (0)
+
+static int drift_pct;
+static uint32_t rand_state = 12345;
+
+static uint32_t rand_below(uint32_t n)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state % n;
+}
+
+// The sensor as seen over I2C: a new measurement every period_us from start_us, by the sensor's own clock
+typedef struct
+{
+    int64_t start_us;
+    int64_t period_us;
+    int64_t read_cnt; // Measurements read so far
+    bool i2c_errors;  // Let the transactions fail sometimes
+} sensor_stub_t;
+
+static int64_t sensor_ready_cnt(const sensor_stub_t *sensor, int64_t now_ms)
+{
+    int64_t elapsed_us = now_ms * 1000 - sensor->start_us;
+    return elapsed_us < 0 ? 0 : elapsed_us / sensor->period_us;
+}
+
+// scd4x_get_data_ready_status(). Returns false if the transaction failed.
+static bool sensor_get_data_ready_status(const sensor_stub_t *sensor, int64_t now_ms, bool *ready)
+{
+    if (sensor->i2c_errors && rand_below(I2C_ERROR_RATE) == 0)
+        return false;
+    *ready = sensor_ready_cnt(sensor, now_ms) > sensor->read_cnt;
+    return true;
+}
+
+// scd4x_read_measurement(). Returns the measurements replaced before they were read.
+static int64_t sensor_read_measurement(sensor_stub_t *sensor, int64_t now_ms)
+{
+    int64_t ready_cnt = sensor_ready_cnt(sensor, now_ms);
+    int64_t missed = ready_cnt - sensor->read_cnt - 1;
+    sensor->read_cnt = ready_cnt;
+    return missed;
+}
+
+static void run(int drift, bool i2c_errors)
+{
+    drift_pct = drift;
+    sensor_stub_t sensor = {
+        .start_us = rand_below(SCD4X_SCHED_PERIOD_MS) * 10,
+        .period_us = SCD4X_SCHED_PERIOD_MS * (100 + drift) * 10,
+        .i2c_errors = i2c_errors,
+    };
+    scd4x_sched_t sched;
+    int64_t now_ms = 0;
+    scd4x_sched_init(&sched, SCD4X_SCHED_PERIOD_MS, now_ms);
+
+    int64_t measurements = 0;
+    int64_t latency_total_ms = 0;
+    int64_t latency_max_ms = 0;
+    uint32_t checks_after_warm_up = 0;
+    int64_t measurements_after_warm_up = 0;
+
+    // The loop of scd4x_task() in main.c
+    while (now_ms < SIM_MS)
+    {
+        now_ms += scd4x_sched_get_delay(&sched, now_ms);
+
+        bool ready = false;
+        if (!sensor_get_data_ready_status(&sensor, now_ms, &ready))
+            ready = false;
+        scd4x_sched_report(&sched, now_ms, ready);
+        if (now_ms >= WARM_UP_MS)
+            checks_after_warm_up++;
+        if (!ready)
+            continue;
+
+        // Time since the measurement was ready, by the sensor's clock
+        int64_t ready_us = sensor.start_us + sensor_ready_cnt(&sensor, now_ms) * sensor.period_us;
+        int64_t latency_ms = now_ms - ready_us / 1000;
+        CHECK(sensor_read_measurement(&sensor, now_ms) == 0);
+        measurements++;
+        if (now_ms >= WARM_UP_MS)
+        {
+            measurements_after_warm_up++;
+            latency_total_ms += latency_ms;
+            if (latency_ms > latency_max_ms)
+                latency_max_ms = latency_ms;
+        }
+    }
+
+    CHECK(measurements >= SIM_MS * 1000 / sensor.period_us - 1);
+    CHECK(sched.stats.measurements == measurements);
+    double checks_per_measurement = (double)checks_after_warm_up / measurements_after_warm_up;
+    double latency_avg_ms = (double)latency_total_ms / measurements_after_warm_up;
+    printf("drift %+d %%%s: %lld measurements, %.2f checks each, latency avg %.1f ms, max %lld ms, period %u us\n",
+           drift, i2c_errors ? ", I2C errors" : "", (long long)measurements, checks_per_measurement, latency_avg_ms,
+           (long long)latency_max_ms, sched.period_us);
+
+    // Polling once a second took 5 checks per measurement and found it 500 ms late on average
+    CHECK(checks_per_measurement < 1.5);
+    CHECK(latency_avg_ms < SCD4X_SCHED_MARGIN_MS + 10);
+    if (i2c_errors)
+    {
+        // A failed check looks like the data wasn't ready, so the measurement seems to be later than it was, and
+        // the period longer. The next few are found late, until the schedule nudges the expected time back.
+        CHECK(latency_max_ms < 5 * SCD4X_SCHED_POLL_MS);
+    }
+    else
+    {
+        // Found at the first check, or by polling
+        CHECK(latency_max_ms <= SCD4X_SCHED_POLL_MS);
+    }
+    // The period learned follows the sensor's clock
+    CHECK(llabs((int64_t)sched.period_us - sensor.period_us) < sensor.period_us / 500);
+}
+
+int main(void)
+{
+    for (int drift = -3; drift <= 3; drift++)
+    {
+        run(drift, false);
+        run(drift, true);
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "history.h"
+#include <string.h>
+
+void history_init(history_t *history, history_sample_t *samples, uint32_t len)
+{
+    history->samples = samples;
+    history->len = len;
+    atomic_init(&history->head, 0);
+}
+
+void history_push(history_t *history, const history_sample_t *sample)
+{
+    uint32_t head = atomic_load_explicit(&history->head, memory_order_relaxed);
+    history->samples[head % history->len] = *sample;
+    // Publish the sample only after it's written
+    atomic_store_explicit(&history->head, head + 1, memory_order_release);
+}
+
+uint32_t history_read(history_t *history, uint32_t *pos, history_sample_t *out, uint32_t max)
+{
+    uint32_t head = atomic_load_explicit(&history->head, memory_order_acquire);
+    if (head - *pos > history->len)
+        *pos = head - history->len;
+
+    uint32_t cnt = head - *pos;
+    if (cnt > max)
+        cnt = max;
+    for (uint32_t i = 0; i < cnt; i++)
+        out[i] = history->samples[(*pos + i) % history->len];
+
+    // The producer could have overwritten the oldest samples meanwhile: sample `i` is intact only if
+    // sample `i + len` hasn't been started yet. Drop the ones which could have changed.
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t head_after = atomic_load_explicit(&history->head, memory_order_relaxed);
+    uint32_t skip = 0;
+    if (head_after - *pos >= history->len)
+    {
+        skip = head_after - *pos - history->len + 1;
+        if (skip > cnt)
+            skip = cnt;
+        memmove(out, out + skip, (cnt - skip) * sizeof(out[0]));
+    }
+
+    *pos += cnt;
+    return cnt - skip;
+}
+
+// Clear a point and make it the newest
+static void tier_start_point(trend_tier_t *tier, uint32_t index)
+{
+    tier->newest = index;
+    tier->cnt = 0;
+    tier->sum = 0;
+    tier->min[index] = TREND_NONE;
+    tier->max[index] = TREND_NONE;
+    tier->avg[index] = TREND_NONE;
+}
+
+void trend_tier_init(trend_tier_t *tier, uint32_t bucket_s)
+{
+    tier->bucket_s = bucket_s;
+    tier->bucket = UINT32_MAX;
+    for (uint32_t i = 0; i < TREND_POINTS; i++)
+        tier_start_point(tier, i);
+}
+
+void trend_tier_add(trend_tier_t *tier, uint32_t time_s, int32_t value)
+{
+    uint32_t bucket = time_s / tier->bucket_s;
+    if (tier->bucket == UINT32_MAX)
+    {
+        tier->bucket = bucket;
+    }
+    else if (bucket != tier->bucket)
+    {
+        if (bucket < tier->bucket)
+            return;
+
+        // Step over the points without samples, but clear each only once
+        uint32_t steps = bucket - tier->bucket;
+        if (steps > TREND_POINTS)
+            steps = TREND_POINTS;
+        for (uint32_t i = 0; i < steps; i++)
+            tier_start_point(tier, (tier->newest + 1) % TREND_POINTS);
+        tier->bucket = bucket;
+    }
+
+    uint32_t i = tier->newest;
+    if (tier->cnt == 0 || value < tier->min[i])
+        tier->min[i] = value;
+    if (tier->cnt == 0 || value > tier->max[i])
+        tier->max[i] = value;
+    tier->cnt++;
+    tier->sum += value;
+    tier->avg[i] = (int32_t)(tier->sum / tier->cnt);
+}
+
+uint32_t trend_tier_get_start(const trend_tier_t *tier)
+{
+    return (tier->newest + 1) % TREND_POINTS;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HISTORY_LEN (24 * 3600 / 5) // Samples kept: 24 h at the 5 s signal update interval of the SCD4x
+#define HISTORY_READ_CHUNK 16       // Samples copied at once by the consumer
+
+#define TREND_POINTS 120        // Points of a trend tier, i.e. of the chart
+#define TREND_NONE INT32_MAX    // Value of a point without samples, same as LV_CHART_POINT_NONE
+
+// A measurement. 12 bytes, 24 h take 207 kB.
+typedef struct
+{
+    uint32_t time_s;   // Time since boot
+    uint16_t co2_ppm;
+    int16_t temp_cdeg; // Temperature in 0.01 degC
+    uint16_t rh_cpct;  // Relative humidity in 0.01 %
+} history_sample_t;
+
+// Fixed size ring of samples. Lock free for a single producer (the sensor task) and a single consumer (the UI).
+// The producer never waits: when the ring is full the oldest sample is overwritten, and the consumer skips it
+// if it fell that much behind.
+typedef struct
+{
+    history_sample_t *samples;
+    uint32_t len;
+    atomic_uint_fast32_t head; // Samples written so far. Sample `i` is at `i % len`.
+} history_t;
+
+// Min/max/avg of the samples in fixed time buckets, in the last TREND_POINTS buckets. The arrays are a ring,
+// the newest point is at `newest`, so they can be drawn as they are (lv_chart_set_series_ext_y_array()
+// and lv_chart_set_x_start_point()). Adding a sample costs the same regardless of the time span.
+typedef struct
+{
+    uint32_t bucket_s; // Time span of a point
+    uint32_t bucket;   // Time of the newest point in `bucket_s` units, UINT32_MAX if no samples yet
+    uint32_t newest;   // Index of the newest point
+    uint32_t cnt;      // Samples in the newest point
+    int64_t sum;
+    int32_t min[TREND_POINTS];
+    int32_t max[TREND_POINTS];
+    int32_t avg[TREND_POINTS];
+} trend_tier_t;
+
+// Use `samples` of `len` elements (e.g. HISTORY_LEN in PSRAM) as the ring
+void history_init(history_t *history, history_sample_t *samples, uint32_t len);
+
+// Add a sample. Producer only.
+void history_push(history_t *history, const history_sample_t *sample);
+
+// Copy at most `max` samples following the ones read so far. `pos` is the consumer's read position, start
+// with 0. Samples which were overwritten before they could be read are skipped. Returns the samples copied.
+uint32_t history_read(history_t *history, uint32_t *pos, history_sample_t *out, uint32_t max);
+
+// Start a tier with no samples and `bucket_s` long points
+void trend_tier_init(trend_tier_t *tier, uint32_t bucket_s);
+
+// Add a sample to the newest point, or start a new one if its time is past that. Points without samples
+// in between are set to TREND_NONE. Samples older than the newest point are ignored.
+void trend_tier_add(trend_tier_t *tier, uint32_t time_s, int32_t value);
+
+// Index of the oldest point, where drawing starts
+uint32_t trend_tier_get_start(const trend_tier_t *tier);
+
+#ifdef __cplusplus
+}
+#endif
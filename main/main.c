@@ -1,44 +1,117 @@
+#include <inttypes.h>
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 
 #include "esp_timer.h"
 #include "esp_log.h"
+#include "esp_partition.h"
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 #include "st7701_panel.h"
 
 #include "lvgl.h"
 #include "scd4x.h"
+#include "scd4x_sched.h"
+#include "history.h"
+#include "sample_log.h"
 
 #include "hw_layout.h"
 
 #include "fonts.h"
 
-#define BUF_SIZE (LCD_H_RES * LCD_V_RES * LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565)) // LVGL draw buffer size
+#define LVGL_BUF_PARTS 4 // Render the screen in this many areas so that rendering and copying can overlap
+#define BUF_SIZE (LCD_H_RES * LCD_V_RES * LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565) / LVGL_BUF_PARTS) // LVGL draw buffer size
+#define FB_STRIDE (LCD_H_RES * LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565))          // Panel frame buffer line size
+
+// 1: rotate rendered areas straight into the panel's two frame buffers and flip them once per refresh
+// 0: rotate into an intermediate buffer and let esp_lcd copy it into the frame buffer
+#define LCD_ROTATE_TO_FB 1
+#define FB_DIRTY_MAX 16 // Dirty areas tracked per refresh before falling back to a full frame sync
+#define LVGL_BUF_CNT 2  // LVGL draw buffers (2 or 3), all but one can wait in the flush queue
 
 static const char *TAG = "APP";
 
 static i2c_dev_t scd4x_dev; // SCD4x sensor I2C handle
+static scd4x_sched_t scd4x_sched; // When to check the SCD4x for new data
 static bool sensor_fail;
 static bool asc_enabled;
 
-static SemaphoreHandle_t lv_sem; // LVGL Mutex
+static SemaphoreHandle_t lv_sem;       // LVGL Mutex
+static SemaphoreHandle_t lvgl_wakeup;  // Given when LVGL needs to run before its next timer is due
+
+#if LCD_ROTATE_TO_FB
+static uint8_t *panel_fb[2];               // Panel frame buffers
+static uint8_t fb_back;                    // Index of the frame buffer not being scanned out
+static lv_area_t fb_dirty[FB_DIRTY_MAX];   // Areas (panel coords) written since the last flip
+static uint32_t fb_dirty_cnt;
 
+// A rendered area waiting to be rotated into the back frame buffer by the flush task
+typedef struct
+{
+    lv_area_t fb_area; // Destination area in panel coordinates
+    const uint8_t *src;
+    int32_t src_w;
+    int32_t src_h;
+    uint32_t src_stride;
+    lv_display_rotation_t rotation;
+    lv_color_format_t cf;
+    bool last; // Flip the frame buffers after this area
+} flush_job_t;
+
+static QueueHandle_t flush_queue;     // Rendered areas in flight, at most LVGL_BUF_CNT - 1
+static SemaphoreHandle_t flush_slots; // Counts the LVGL draw buffers which can be queued for flushing
+#else
 uint8_t *lvgl_dest = NULL; // Draw buffer for display rotation
+#endif
 
 static lv_obj_t *label_co2;
 static lv_obj_t *label_asc;
+static lv_obj_t *label_trend;
+static lv_obj_t *chart_trend;
+static lv_chart_series_t *ser_trend_min;
+static lv_chart_series_t *ser_trend_max;
+static lv_chart_series_t *ser_trend_avg;
+
+static history_t history;         // Measurements, written by the SCD4x task, read by the LVGL task
+static uint32_t history_read_pos; // Samples read by the LVGL task
+
+#define SAMPLE_LOG_PARTITION_SUBTYPE 0x40 // "samples" in partitions.csv
+static sample_log_t sample_log; // Measurements kept over restarts, written by the SCD4x task
+static bool sample_log_ok;
+static uint32_t time_offset_s;  // Time of the samples at boot, continues the log after a restart
+// Write the log at least this often, so at most this much is lost at a power off instead of a full chunk
+// (SAMPLE_LOG_CHUNK_RECORDS intervals). Shorter chunks take more space: about 4 bytes per record instead of 3.
+#define SAMPLE_LOG_FLUSH_MS (10 * 60 * 1000)
+
+// Time spans of the trend chart, switched every TREND_SWITCH_MS
+#define TREND_TIERS 3
+#define TREND_SWITCH_MS 10000
+static const uint32_t trend_bucket_s[TREND_TIERS] = {3600 / TREND_POINTS, 6 * 3600 / TREND_POINTS, 24 * 3600 / TREND_POINTS};
+static const char *const trend_names[TREND_TIERS] = {"1 H", "6 H", "24 H"};
+static trend_tier_t trend_tiers[TREND_TIERS];
+static uint32_t trend_shown;
+
+_Static_assert(TREND_NONE == LV_CHART_POINT_NONE, "Trend points are drawn without conversion");
 
 static lv_style_t style_co2ppm;
 static lv_style_t style_asc;
 
-// Increase LVGL tick every 1ms
-static void lvgl_tick_inc(void *arg)
+// LVGL time in ms, read from esp_timer instead of counting ticks in a periodic interrupt
+static uint32_t lvgl_tick_get_cb(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Called by LVGL when it has to run earlier than lv_timer_handler() returned, e.g. a widget was invalidated
+static void lvgl_resume_cb(void *data)
 {
-    lv_tick_inc(1);
+    xSemaphoreGive(lvgl_wakeup);
 }
 
 esp_err_t lvgl_port_lock(uint32_t timeout_ms)
@@ -56,6 +129,114 @@ void lvgl_port_unlock(void)
         xSemaphoreGiveRecursive(lv_sem);
 }
 
+#if LCD_ROTATE_TO_FB
+// Remember an area of the back buffer which has to be copied to the other buffer after the flip
+static void fb_mark_dirty(const lv_area_t *area)
+{
+    if (fb_dirty_cnt < FB_DIRTY_MAX)
+    {
+        fb_dirty[fb_dirty_cnt++] = *area;
+    }
+    else
+    {
+        // Too many areas, sync the whole frame
+        lv_area_set(&fb_dirty[0], 0, 0, LCD_H_RES - 1, LCD_V_RES - 1);
+        fb_dirty_cnt = 1;
+    }
+}
+
+// Bring the new back buffer up to date with what was just flipped to the front
+static void fb_sync_back(void)
+{
+    const uint8_t *front = panel_fb[fb_back ^ 1];
+    uint8_t *back = panel_fb[fb_back];
+
+    for (uint32_t i = 0; i < fb_dirty_cnt; i++)
+    {
+        const lv_area_t *a = &fb_dirty[i];
+        uint32_t offset = a->y1 * FB_STRIDE + a->x1 * 2;
+        uint32_t line_size = lv_area_get_width(a) * 2;
+        for (int32_t y = a->y1; y <= a->y2; y++)
+        {
+            memcpy(back + offset, front + offset, line_size);
+            offset += FB_STRIDE;
+        }
+    }
+    fb_dirty_cnt = 0;
+}
+
+// Rotate an area into the back frame buffer
+static void fb_copy_area(const flush_job_t *job)
+{
+    uint8_t *dest = panel_fb[fb_back] + job->fb_area.y1 * FB_STRIDE + job->fb_area.x1 * 2;
+
+    if (job->rotation != LV_DISPLAY_ROTATION_0)
+    {
+        lv_draw_sw_rotate(job->src, dest, job->src_w, job->src_h, job->src_stride, FB_STRIDE, job->rotation, job->cf);
+    }
+    else
+    {
+        const uint8_t *src = job->src;
+        for (int32_t y = 0; y < job->src_h; y++)
+        {
+            memcpy(dest, src, job->src_w * 2);
+            dest += FB_STRIDE;
+            src += job->src_stride;
+        }
+    }
+    fb_mark_dirty(&job->fb_area);
+}
+
+// Copies the rendered areas on core 0 while LVGL renders the next area into its other buffer on core 1
+static void flush_task(void *arg)
+{
+    flush_job_t job;
+    while (1)
+    {
+        xQueueReceive(flush_queue, &job, portMAX_DELAY);
+        fb_copy_area(&job);
+
+        // The draw buffer is copied, LVGL can render into it again
+        xSemaphoreGive(flush_slots);
+
+        if (job.last)
+        {
+            // Areas of the next refresh can be written only when the panel has left the old buffer
+            st7701_panel_flip_fb(panel_fb[fb_back]);
+            st7701_wait_flush_done();
+            fb_back ^= 1;
+            fb_sync_back();
+        }
+    }
+}
+
+// Queue the rendered area for the flush task and return to let LVGL render the next one
+static void example_lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
+{
+    flush_job_t job = {
+        .fb_area = *area,
+        .src = color_p,
+        .src_w = lv_area_get_width(area),
+        .src_h = lv_area_get_height(area),
+        .rotation = lv_display_get_rotation(disp),
+        .cf = lv_display_get_color_format(disp),
+        .last = lv_display_flush_is_last(disp),
+    };
+    job.src_stride = lv_draw_buf_width_to_stride(job.src_w, job.cf);
+    lv_display_rotate_area(disp, &job.fb_area);
+
+    // lvgl_flush_wait_cb has already waited for a free slot
+    xSemaphoreTake(flush_slots, portMAX_DELAY);
+    xQueueSend(flush_queue, &job, portMAX_DELAY);
+}
+
+// Called before the next area is flushed. Wait until the queue has room, so the buffer LVGL renders into after it is free
+void lvgl_flush_wait_cb(lv_display_t *disp)
+{
+    xSemaphoreTake(flush_slots, portMAX_DELAY);
+    xSemaphoreGive(flush_slots);
+}
+#else
 // LVGL flush callback copied from manuf. sample code
 static void example_lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p)
 {
@@ -89,20 +270,7 @@ void lvgl_flush_wait_cb(lv_display_t *disp)
 {
     st7701_wait_flush_done();
 }
-
-// Main LVGL task
-static void lvgl_task(void *arg)
-{
-    while (1)
-    {
-        if (lvgl_port_lock(0) == ESP_OK)
-        {
-            lv_timer_handler();
-            lvgl_port_unlock();
-        }
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
-}
+#endif
 
 // CO2 value to text color mapping
 static lv_color_t co2_color(uint16_t ppm)
@@ -114,43 +282,174 @@ static lv_color_t co2_color(uint16_t ppm)
     return lv_color_hex(0xe4002b);
 }
 
-// Reads measurement from SCD4x and updates display
-static void scd4x_task(void *arg)
+// Writing and erasing the flash doesn't stop the display: the code and rodata run from PSRAM
+// (CONFIG_SPIRAM_XIP_FROM_PSRAM), so the cache stays enabled, and the RGB panel ISR refilling the bounce buffers
+// from the frame buffers in PSRAM keeps running (CONFIG_LCD_RGB_ISR_IRAM_SAFE).
+static bool sample_log_read(void *ctx, uint32_t offset, void *buf, uint32_t len)
 {
-    uint16_t co2_reading;
-    float temp, humidity;
-    bool scd4x_datardy = false;
+    return esp_partition_read(ctx, offset, buf, len) == ESP_OK;
+}
 
-    do
+static bool sample_log_write(void *ctx, uint32_t offset, const void *buf, uint32_t len)
+{
+    return esp_partition_write(ctx, offset, buf, len) == ESP_OK;
+}
+
+static bool sample_log_erase(void *ctx, uint32_t offset, uint32_t len)
+{
+    return esp_partition_erase_range(ctx, offset, len) == ESP_OK;
+}
+
+// Open the log in the samples partition. The power off time is unknown, the log continues where it ended.
+static void sample_log_init(void)
+{
+    const esp_partition_t *part =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, SAMPLE_LOG_PARTITION_SUBTYPE, "samples");
+    if (!part)
     {
-        ESP_LOGI(TAG, "Waiting for SCD4x initial measurement");
-        ESP_ERROR_CHECK(scd4x_get_data_ready_status(&scd4x_dev, &scd4x_datardy));
-        if (!scd4x_datardy)
+        ESP_LOGW(TAG, "No samples partition, measurements are not kept");
+        return;
+    }
+
+    sample_log_flash_t flash = {
+        .read = sample_log_read,
+        .write = sample_log_write,
+        .erase = sample_log_erase,
+        .ctx = (void *)part,
+        .size = part->size,
+    };
+    int64_t start_us = esp_timer_get_time();
+    sample_log_ok = sample_log_open(&sample_log, &flash);
+    time_offset_s = sample_log_get_end_time(&sample_log);
+    ESP_LOGI(TAG, "Sample log %s in %lld us, continues at %" PRIu32 " s", sample_log_ok ? "opened" : "failed",
+             esp_timer_get_time() - start_us, time_offset_s);
+}
+
+// Show the trend of a time span. The chart draws the tier's arrays directly.
+static void trend_show(uint32_t tier_id)
+{
+    trend_tier_t *tier = &trend_tiers[tier_id];
+    trend_shown = tier_id;
+    lv_chart_set_series_ext_y_array(chart_trend, ser_trend_min, tier->min);
+    lv_chart_set_series_ext_y_array(chart_trend, ser_trend_max, tier->max);
+    lv_chart_set_series_ext_y_array(chart_trend, ser_trend_avg, tier->avg);
+    lv_chart_set_x_start_point(chart_trend, ser_trend_min, trend_tier_get_start(tier));
+    lv_chart_set_x_start_point(chart_trend, ser_trend_max, trend_tier_get_start(tier));
+    lv_chart_set_x_start_point(chart_trend, ser_trend_avg, trend_tier_get_start(tier));
+    lv_chart_refresh(chart_trend);
+    lv_label_set_text(label_trend, trend_names[tier_id]);
+}
+
+static void trend_switch_cb(lv_timer_t *timer)
+{
+    trend_show((trend_shown + 1) % TREND_TIERS);
+}
+
+// Add the new measurements to the trend and show the latest one. Called with the LVGL lock held.
+static void ui_read_history(void)
+{
+    history_sample_t samples[HISTORY_READ_CHUNK];
+    uint16_t co2_ppm = 0;
+    uint32_t read = 0;
+    uint32_t cnt;
+    while ((cnt = history_read(&history, &history_read_pos, samples, HISTORY_READ_CHUNK)) > 0)
+    {
+        for (uint32_t i = 0; i < cnt; i++)
         {
-            vTaskDelay(pdMS_TO_TICKS(1000));
+            for (uint32_t t = 0; t < TREND_TIERS; t++)
+                trend_tier_add(&trend_tiers[t], samples[i].time_s, samples[i].co2_ppm);
         }
-    } while (!scd4x_datardy);
+        co2_ppm = samples[cnt - 1].co2_ppm;
+        read += cnt;
+    }
+    if (read == 0)
+        return;
 
-    lvgl_port_lock(50);
-    lv_obj_add_flag(label_asc, LV_OBJ_FLAG_HIDDEN);
-    lvgl_port_unlock();
+    if (!lv_obj_has_flag(label_asc, LV_OBJ_FLAG_HIDDEN))
+        lv_obj_add_flag(label_asc, LV_OBJ_FLAG_HIDDEN);
+    lv_label_set_text_fmt(label_co2, co2_ppm < 1000 ? "%3u" : "%4u", co2_ppm);
+    // Set corresponding text color based on co2 reading
+    lv_style_set_text_color(&style_co2ppm, co2_color(co2_ppm));
+    lv_obj_refresh_style(label_co2, LV_PART_MAIN, LV_STYLE_PROP_ANY);
 
+    trend_show(trend_shown);
+}
+
+// Main LVGL task. Sleeps until the next LVGL timer is due or lvgl_resume_cb wakes it up.
+static void lvgl_task(void *arg)
+{
     while (1)
     {
-        scd4x_get_data_ready_status(&scd4x_dev, &scd4x_datardy);
+        uint32_t time_until_next = 0;
+        if (lvgl_port_lock(0) == ESP_OK)
+        {
+            ui_read_history();
+            time_until_next = lv_timer_handler();
+            lvgl_port_unlock();
+        }
+
+        // Round up, so the timer is surely due when the task wakes up
+        TickType_t ticks = portMAX_DELAY;
+        if (time_until_next != LV_NO_TIMER_READY)
+            ticks = (time_until_next + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        xSemaphoreTake(lvgl_wakeup, ticks);
+    }
+}
 
-        if (scd4x_datardy &&
-            scd4x_read_measurement(&scd4x_dev, &co2_reading, &temp, &humidity) == ESP_OK &&
-            lvgl_port_lock(100) == ESP_OK)
+// Checks the SCD4x shortly after each measurement is expected, reads it into the history and wakes the UI
+static void scd4x_task(void *arg)
+{
+    uint16_t co2_reading;
+    float temp, humidity;
+    int64_t log_flush_ms = esp_timer_get_time() / 1000;
+
+    ESP_LOGI(TAG, "Waiting for SCD4x initial measurement");
+    while (1)
+    {
+        vTaskDelay(pdMS_TO_TICKS(scd4x_sched_get_delay(&scd4x_sched, esp_timer_get_time() / 1000)));
+
+        bool scd4x_datardy = false;
+        if (scd4x_get_data_ready_status(&scd4x_dev, &scd4x_datardy) != ESP_OK)
+            scd4x_datardy = false;
+        int64_t now_ms = esp_timer_get_time() / 1000;
+        scd4x_sched_report(&scd4x_sched, now_ms, scd4x_datardy);
+        if (!scd4x_datardy)
+            continue;
+
+        const scd4x_sched_stats_t *stats = &scd4x_sched.stats;
+        ESP_LOGI(TAG, "SCD4x data ready: latency %" PRIu32 "ms (avg %" PRIu32 ", max %" PRIu32 "), age %" PRIu32 "ms, "
+                 "%" PRIu32 " checks for %" PRIu32 " measurements, %" PRIu32 " late, period %" PRIu32 "us",
+                 stats->latency_ms, stats->latency_avg_ms, stats->latency_max_ms,
+                 scd4x_sched_get_age(&scd4x_sched, now_ms),
+                 stats->checks, stats->measurements, stats->late, stats->period_us);
+
+        if (scd4x_read_measurement(&scd4x_dev, &co2_reading, &temp, &humidity) == ESP_OK)
         {
             ESP_LOGI(TAG, "SCD4x measurement: CO2=%uppm, T=%.2fC, H=%.2f%%", co2_reading, temp, humidity);
-            lv_label_set_text_fmt(label_co2, co2_reading < 1000 ? "%3u" : "%4u", co2_reading);
-            // Set corresponding text color based on co2 reading
-            lv_style_set_text_color(&style_co2ppm, co2_color(co2_reading));
-            lv_obj_refresh_style(label_co2, LV_PART_MAIN, LV_STYLE_PROP_ANY);
-            lvgl_port_unlock();
+            i2c_dev_port_stats_t i2c_stats;
+            if (i2c_dev_get_port_stats(scd4x_dev.port, &i2c_stats) == ESP_OK && i2c_stats.transactions)
+                ESP_LOGI(TAG, "I2C: %" PRIu32 " transactions, %" PRIu32 " transfers, %" PRIu32 " errors, "
+                         "%" PRIu32 " contended, latency avg %" PRIu32 "us max %" PRIu32 "us",
+                         i2c_stats.transactions, i2c_stats.transfers, i2c_stats.errors, i2c_stats.contended,
+                         (uint32_t)(i2c_stats.latency_total_us / i2c_stats.transactions), i2c_stats.latency_max_us);
+            history_sample_t sample = {
+                .time_s = time_offset_s + (uint32_t)(esp_timer_get_time() / 1000000),
+                .co2_ppm = co2_reading,
+                .temp_cdeg = (int16_t)lroundf(temp * 100),
+                .rh_cpct = (uint16_t)lroundf(humidity * 100),
+            };
+            history_push(&history, &sample);
+            if (sample_log_ok && !sample_log_add(&sample_log, &sample))
+                ESP_LOGW(TAG, "Writing the sample log failed");
+            if (sample_log_ok && now_ms - log_flush_ms >= SAMPLE_LOG_FLUSH_MS)
+            {
+                log_flush_ms = now_ms;
+                if (!sample_log_flush(&sample_log))
+                    ESP_LOGW(TAG, "Writing the sample log failed");
+            }
+            // The LVGL task shows it, this task doesn't wait for the LVGL lock
+            xSemaphoreGive(lvgl_wakeup);
         }
-        vTaskDelay(pdMS_TO_TICKS(1000));
     }
 }
 
@@ -190,6 +489,43 @@ static void ui_create(void)
     lv_label_set_text(label_co2, "XXXX");
     lv_style_set_text_color(&style_co2ppm, lv_color_hex(0xd77e00));
     lv_obj_set_style_align(label_co2, LV_ALIGN_BOTTOM_LEFT, 0);
+
+    for (uint32_t t = 0; t < TREND_TIERS; t++)
+        trend_tier_init(&trend_tiers[t], trend_bucket_s[t]);
+
+    // Start the trend with the logged measurements from before the restart
+    if (sample_log_ok)
+    {
+        sample_log_iter_t iter;
+        sample_log_record_t rec;
+        sample_log_iter_init(&sample_log, &iter, time_offset_s > 24 * 3600 ? time_offset_s - 24 * 3600 : 0);
+        while (sample_log_iter_next(&iter, &rec))
+        {
+            for (uint32_t t = 0; t < TREND_TIERS; t++)
+                trend_tier_add(&trend_tiers[t], rec.time_s, rec.co2_ppm);
+        }
+    }
+
+    chart_trend = lv_chart_create(screen);
+    lv_obj_set_size(chart_trend, 300, 180);
+    lv_obj_set_style_align(chart_trend, LV_ALIGN_BOTTOM_RIGHT, 0);
+    lv_obj_set_style_bg_opa(chart_trend, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(chart_trend, 0, 0);
+    lv_obj_set_style_line_color(chart_trend, lv_color_hex(0x303030), 0);
+    lv_obj_set_style_size(chart_trend, 0, 0, LV_PART_INDICATOR); // No dots on the points
+    lv_chart_set_type(chart_trend, LV_CHART_TYPE_LINE);
+    lv_chart_set_point_count(chart_trend, TREND_POINTS);
+    lv_chart_set_axis_range(chart_trend, LV_CHART_AXIS_PRIMARY_Y, 400, 2000);
+    ser_trend_max = lv_chart_add_series(chart_trend, lv_color_hex(0x606060), LV_CHART_AXIS_PRIMARY_Y);
+    ser_trend_min = lv_chart_add_series(chart_trend, lv_color_hex(0x606060), LV_CHART_AXIS_PRIMARY_Y);
+    ser_trend_avg = lv_chart_add_series(chart_trend, lv_color_white(), LV_CHART_AXIS_PRIMARY_Y);
+
+    label_trend = lv_label_create(chart_trend);
+    lv_obj_set_style_text_color(label_trend, lv_color_white(), 0);
+    lv_obj_set_style_align(label_trend, LV_ALIGN_TOP_RIGHT, 0);
+
+    trend_show(0);
+    lv_timer_create(trend_switch_cb, TREND_SWITCH_MS, NULL);
 }
 
 void app_main(void)
@@ -200,24 +536,49 @@ void app_main(void)
 
     lv_init();
     lv_sem = xSemaphoreCreateRecursiveMutex();
+    lvgl_wakeup = xSemaphoreCreateBinary();
+    lv_tick_set_cb(lvgl_tick_get_cb);
+    lv_timer_handler_set_resume_cb(lvgl_resume_cb, NULL);
     lv_display_t *disp = lv_display_create(LCD_H_RES, LCD_V_RES);
     lv_display_set_flush_cb(disp, example_lvgl_flush_cb);
     lv_display_set_flush_wait_cb(disp, lvgl_flush_wait_cb);
 
     uint8_t *buf1 = (uint8_t *)heap_caps_malloc(BUF_SIZE, MALLOC_CAP_SPIRAM);
     uint8_t *buf2 = (uint8_t *)heap_caps_malloc(BUF_SIZE, MALLOC_CAP_SPIRAM);
+#if LCD_ROTATE_TO_FB
+    ESP_ERROR_CHECK(st7701_panel_get_frame_buffers((void **)&panel_fb[0], (void **)&panel_fb[1]));
+    fb_back = 1;
+    flush_queue = xQueueCreate(LVGL_BUF_CNT - 1, sizeof(flush_job_t));
+    flush_slots = xSemaphoreCreateCounting(LVGL_BUF_CNT - 1, LVGL_BUF_CNT - 1);
+    xTaskCreatePinnedToCore(flush_task, "Flush Task", 3072, NULL, 3, NULL, 0);
+#else
     lvgl_dest = (uint8_t *)heap_caps_malloc(BUF_SIZE, MALLOC_CAP_SPIRAM);
+#endif
     lv_display_set_buffers(disp, buf1, buf2, BUF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+#if LCD_ROTATE_TO_FB && LVGL_BUF_CNT > 2
+    // A 3rd buffer lets LVGL render one more area ahead while the flush task is busy
+    static lv_draw_buf_t buf3;
+    const lv_draw_buf_t *buf_act = lv_display_get_buf_active(disp);
+    lv_draw_buf_init(&buf3, buf_act->header.w, buf_act->header.h, buf_act->header.cf, buf_act->header.stride,
+                     heap_caps_malloc(BUF_SIZE, MALLOC_CAP_SPIRAM), BUF_SIZE);
+    lv_display_set_3rd_draw_buffer(disp, &buf3);
+#endif
     lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_270);
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    // The CO2 label is redrawn every measurement, mostly with the same digits
+    lv_display_set_flush_diff(disp, true);
+#endif
+    // Every area is a separate render pass and flush job, worth about 8 rows of pixels. Join close areas.
+    lv_display_set_refr_cost(disp, 1, LCD_H_RES * 8);
     lv_display_set_user_data(disp, lcd_handle);
 
-    const esp_timer_create_args_t lvgl_tick_timer_cfg =
-        {
-            .callback = &lvgl_tick_inc,
-            .name = "lvgl tick timer"};
-    esp_timer_handle_t lvgl_tick_timer = NULL;
-    ESP_ERROR_CHECK(esp_timer_create(&lvgl_tick_timer_cfg, &lvgl_tick_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, 1000));
+    sample_log_init();
+    // 24 h of measurements don't fit in internal RAM
+    history_sample_t *history_buf = heap_caps_malloc(HISTORY_LEN * sizeof(history_sample_t), MALLOC_CAP_SPIRAM);
+    if (!history_buf)
+        ESP_LOGE(TAG, "No PSRAM for the history, %u bytes", (unsigned)(HISTORY_LEN * sizeof(history_sample_t)));
+    ESP_ERROR_CHECK(history_buf ? ESP_OK : ESP_ERR_NO_MEM);
+    history_init(&history, history_buf, HISTORY_LEN);
 
     ESP_LOGI(TAG, "Creating LVGL Task");
 
@@ -258,6 +619,7 @@ void app_main(void)
         vTaskDelay(pdMS_TO_TICKS(1000));
 
     ESP_ERROR_CHECK(scd4x_start_periodic_measurement(&scd4x_dev));
+    scd4x_sched_init(&scd4x_sched, SCD4X_SCHED_PERIOD_MS, esp_timer_get_time() / 1000);
     ESP_LOGI(TAG, "SCD4x periodic measurements started");
 
     xTaskCreatePinnedToCore(scd4x_task, "SCD41 Task", 4096, NULL, 4, NULL, 0);
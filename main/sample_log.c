@@ -0,0 +1,485 @@
+#include "sample_log.h"
+#include <string.h>
+
+#define SECTOR_MAGIC 0x4C324F43 // "CO2L"
+#define SECTOR_HEADER 12        // Magic, sequence number, CRC and padding
+
+// Chunk header: payload length, record count, CRC, then the first record as it is
+#define CHUNK_LEN 0
+#define CHUNK_CNT 1
+#define CHUNK_CRC 2
+#define CHUNK_TIME 4
+#define CHUNK_CO2 8
+#define CHUNK_TEMP 10
+#define CHUNK_RH 12
+
+// Record encodings, by the leading bits of the first byte (differences from the previous record)
+// 0cccttrr                        CO2 -4..3, T -2..1, RH -2..1
+// 10cccccc ttttrrrr               CO2 -32..31, T -8..7, RH -8..7
+// 110ccccc cccctttt ttrrrrrr      CO2 -256..255, T -32..31, RH -32..31
+// 11100000 CO2 T RH               Absolute values, 16 bits each
+#define RECORD_ABSOLUTE 0xE0
+
+typedef enum
+{
+    CHUNK_OK,
+    CHUNK_END, // Erased flash or no room for a chunk
+    CHUNK_BAD, // Torn by a power loss or corrupted
+} chunk_res_t;
+
+static uint16_t crc16(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+    while (len--)
+    {
+        crc ^= (uint16_t)*data++ << 8;
+        for (int i = 0; i < 8; i++)
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    put_u16(p, v);
+    put_u16(p + 2, v >> 16);
+}
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return p[0] | (uint16_t)p[1] << 8;
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return get_u16(p) | (uint32_t)get_u16(p + 2) << 16;
+}
+
+static bool fits(int32_t v, int bits)
+{
+    return v >= -(1 << (bits - 1)) && v < (1 << (bits - 1));
+}
+
+static int32_t sign_extend(uint32_t v, int bits)
+{
+    return (int32_t)(v << (32 - bits)) >> (32 - bits);
+}
+
+static int32_t div_round(int32_t a, int32_t b)
+{
+    return a >= 0 ? (a + b / 2) / b : (a - b / 2) / b;
+}
+
+// CRC of a chunk, without the CRC field
+static uint16_t chunk_crc(const uint8_t *chunk, uint32_t len)
+{
+    uint16_t crc = crc16(0xFFFF, chunk, CHUNK_CRC);
+    return crc16(crc, chunk + CHUNK_TIME, len - CHUNK_TIME);
+}
+
+static uint32_t encode_record(uint8_t *p, const sample_log_record_t *prev, const sample_log_record_t *rec)
+{
+    int32_t dc = rec->co2_ppm - prev->co2_ppm;
+    int32_t dt = rec->temp_ddeg - prev->temp_ddeg;
+    int32_t dr = rec->rh_dpct - prev->rh_dpct;
+
+    if (fits(dc, 3) && fits(dt, 2) && fits(dr, 2))
+    {
+        p[0] = (dc & 0x7) << 4 | (dt & 0x3) << 2 | (dr & 0x3);
+        return 1;
+    }
+    if (fits(dc, 6) && fits(dt, 4) && fits(dr, 4))
+    {
+        uint32_t v = 0x2u << 14 | (dc & 0x3f) << 8 | (dt & 0xf) << 4 | (dr & 0xf);
+        p[0] = v >> 8;
+        p[1] = v;
+        return 2;
+    }
+    if (fits(dc, 9) && fits(dt, 6) && fits(dr, 6))
+    {
+        uint32_t v = 0x6u << 21 | (dc & 0x1ff) << 12 | (dt & 0x3f) << 6 | (dr & 0x3f);
+        p[0] = v >> 16;
+        p[1] = v >> 8;
+        p[2] = v;
+        return 3;
+    }
+    p[0] = RECORD_ABSOLUTE;
+    put_u16(p + 1, rec->co2_ppm);
+    put_u16(p + 3, (uint16_t)rec->temp_ddeg);
+    put_u16(p + 5, rec->rh_dpct);
+    return 7;
+}
+
+// Apply the record at `p` to `rec`. Returns its length, 0 if it's invalid.
+static uint32_t decode_record(const uint8_t *p, uint32_t avail, sample_log_record_t *rec)
+{
+    int32_t dc, dt, dr;
+    uint32_t len;
+    if (avail < 1)
+        return 0;
+
+    uint8_t b = p[0];
+
+    if (!(b & 0x80))
+    {
+        dc = sign_extend(b >> 4 & 0x7, 3);
+        dt = sign_extend(b >> 2 & 0x3, 2);
+        dr = sign_extend(b & 0x3, 2);
+        len = 1;
+    }
+    else if ((b & 0xc0) == 0x80)
+    {
+        if (avail < 2)
+            return 0;
+        uint32_t v = (uint32_t)b << 8 | p[1];
+        dc = sign_extend(v >> 8 & 0x3f, 6);
+        dt = sign_extend(v >> 4 & 0xf, 4);
+        dr = sign_extend(v & 0xf, 4);
+        len = 2;
+    }
+    else if ((b & 0xe0) == 0xc0)
+    {
+        if (avail < 3)
+            return 0;
+        uint32_t v = (uint32_t)b << 16 | (uint32_t)p[1] << 8 | p[2];
+        dc = sign_extend(v >> 12 & 0x1ff, 9);
+        dt = sign_extend(v >> 6 & 0x3f, 6);
+        dr = sign_extend(v & 0x3f, 6);
+        len = 3;
+    }
+    else if (b == RECORD_ABSOLUTE)
+    {
+        if (avail < 7)
+            return 0;
+        rec->co2_ppm = get_u16(p + 1);
+        rec->temp_ddeg = (int16_t)get_u16(p + 3);
+        rec->rh_dpct = get_u16(p + 5);
+        rec->time_s += SAMPLE_LOG_INTERVAL_S;
+        return 7;
+    }
+    else
+    {
+        return 0;
+    }
+
+    rec->co2_ppm += dc;
+    rec->temp_ddeg += dt;
+    rec->rh_dpct += dr;
+    rec->time_s += SAMPLE_LOG_INTERVAL_S;
+    return len;
+}
+
+static void decode_first(const uint8_t *chunk, sample_log_record_t *rec)
+{
+    rec->time_s = get_u32(chunk + CHUNK_TIME);
+    rec->co2_ppm = get_u16(chunk + CHUNK_CO2);
+    rec->temp_ddeg = (int16_t)get_u16(chunk + CHUNK_TEMP);
+    rec->rh_dpct = get_u16(chunk + CHUNK_RH);
+}
+
+// Sequence number of a sector, false if it has no valid header
+static bool sector_get_seq(const sample_log_t *log, uint32_t sector, uint32_t *seq, bool *io_ok)
+{
+    uint8_t header[SECTOR_HEADER];
+    if (!log->flash.read(log->flash.ctx, sector * SAMPLE_LOG_SECTOR_SIZE, header, sizeof(header)))
+    {
+        if (io_ok)
+            *io_ok = false;
+        return false;
+    }
+    if (get_u32(header) != SECTOR_MAGIC || get_u16(header + 8) != crc16(0xFFFF, header, 8))
+        return false;
+
+    *seq = get_u32(header + 4);
+    return true;
+}
+
+static chunk_res_t read_chunk(const sample_log_t *log, uint32_t sector, uint32_t ofs, uint8_t *chunk, uint32_t *len)
+{
+    if (ofs + SAMPLE_LOG_CHUNK_HEADER > SAMPLE_LOG_SECTOR_SIZE)
+        return CHUNK_END;
+
+    uint32_t addr = sector * SAMPLE_LOG_SECTOR_SIZE + ofs;
+    if (!log->flash.read(log->flash.ctx, addr, chunk, SAMPLE_LOG_CHUNK_HEADER))
+        return CHUNK_BAD;
+
+    bool erased = true;
+    for (uint32_t i = 0; i < SAMPLE_LOG_CHUNK_HEADER; i++)
+        erased &= chunk[i] == 0xFF;
+    if (erased)
+        return CHUNK_END;
+
+    uint32_t total = SAMPLE_LOG_CHUNK_HEADER + chunk[CHUNK_LEN];
+    if (total > SAMPLE_LOG_CHUNK_MAX || ofs + total > SAMPLE_LOG_SECTOR_SIZE ||
+        chunk[CHUNK_CNT] == 0 || chunk[CHUNK_CNT] > SAMPLE_LOG_CHUNK_RECORDS)
+        return CHUNK_BAD;
+
+    if (!log->flash.read(log->flash.ctx, addr + SAMPLE_LOG_CHUNK_HEADER, chunk + SAMPLE_LOG_CHUNK_HEADER,
+                         total - SAMPLE_LOG_CHUNK_HEADER))
+        return CHUNK_BAD;
+    if (get_u16(chunk + CHUNK_CRC) != chunk_crc(chunk, total))
+        return CHUNK_BAD;
+
+    *len = total;
+    return CHUNK_OK;
+}
+
+// Find the free space in a sector and the time after its last record (0 if it has none)
+static uint32_t scan_sector(const sample_log_t *log, uint32_t sector, uint32_t *end_s)
+{
+    uint8_t chunk[SAMPLE_LOG_CHUNK_MAX];
+    uint32_t ofs = SECTOR_HEADER;
+    *end_s = 0;
+    while (1)
+    {
+        uint32_t len;
+        chunk_res_t res = read_chunk(log, sector, ofs, chunk, &len);
+        if (res == CHUNK_END)
+            return ofs;
+        if (res == CHUNK_BAD)
+            return SAMPLE_LOG_SECTOR_SIZE; // Can't write after a torn chunk, continue in the next sector
+
+        sample_log_record_t rec;
+        decode_first(chunk, &rec);
+        for (uint32_t pos = SAMPLE_LOG_CHUNK_HEADER, i = 1; i < chunk[CHUNK_CNT]; i++)
+        {
+            uint32_t n = decode_record(chunk + pos, len - pos, &rec);
+            if (n == 0)
+                break;
+            pos += n;
+        }
+        *end_s = rec.time_s + SAMPLE_LOG_INTERVAL_S;
+        ofs += len;
+    }
+}
+
+bool sample_log_open(sample_log_t *log, const sample_log_flash_t *flash)
+{
+    memset(log, 0, sizeof(*log));
+    log->flash = *flash;
+    log->sector_cnt = flash->size / SAMPLE_LOG_SECTOR_SIZE;
+    log->empty = true;
+    log->write_ofs = SAMPLE_LOG_SECTOR_SIZE;
+
+    // The newest sector is the one with the largest sequence number
+    bool io_ok = true;
+    for (uint32_t s = 0; s < log->sector_cnt; s++)
+    {
+        uint32_t seq;
+        if (sector_get_seq(log, s, &seq, &io_ok) && (log->empty || (int32_t)(seq - log->head_seq) > 0))
+        {
+            log->head = s;
+            log->head_seq = seq;
+            log->empty = false;
+        }
+    }
+    if (!io_ok)
+        return false;
+    if (log->empty)
+        return true;
+
+    log->write_ofs = scan_sector(log, log->head, &log->end_s);
+    if (log->end_s == 0)
+    {
+        // Power was lost right after starting the sector, the last records are in the previous one
+        uint32_t prev = (log->head + log->sector_cnt - 1) % log->sector_cnt;
+        uint32_t seq;
+        if (sector_get_seq(log, prev, &seq, NULL) && seq == log->head_seq - 1)
+            scan_sector(log, prev, &log->end_s);
+    }
+    return true;
+}
+
+uint32_t sample_log_get_end_time(const sample_log_t *log)
+{
+    return log->end_s;
+}
+
+// Erase the sector after the head and make it the head
+static bool start_sector(sample_log_t *log)
+{
+    uint32_t sector = log->empty ? 0 : (log->head + 1) % log->sector_cnt;
+    uint32_t seq = log->empty ? 0 : log->head_seq + 1;
+    log->head = sector;
+    log->head_seq = seq;
+    log->empty = false;
+    log->write_ofs = SAMPLE_LOG_SECTOR_SIZE;
+
+    uint8_t header[SECTOR_HEADER];
+    memset(header, 0xFF, sizeof(header));
+    put_u32(header, SECTOR_MAGIC);
+    put_u32(header + 4, seq);
+    put_u16(header + 8, crc16(0xFFFF, header, 8));
+    if (!log->flash.erase(log->flash.ctx, sector * SAMPLE_LOG_SECTOR_SIZE, SAMPLE_LOG_SECTOR_SIZE) ||
+        !log->flash.write(log->flash.ctx, sector * SAMPLE_LOG_SECTOR_SIZE, header, sizeof(header)))
+        return false;
+
+    log->write_ofs = SECTOR_HEADER;
+    return true;
+}
+
+bool sample_log_flush(sample_log_t *log)
+{
+    if (log->chunk_cnt == 0)
+        return true;
+
+    log->chunk[CHUNK_LEN] = log->chunk_len - SAMPLE_LOG_CHUNK_HEADER;
+    log->chunk[CHUNK_CNT] = log->chunk_cnt;
+    put_u16(log->chunk + CHUNK_CRC, chunk_crc(log->chunk, log->chunk_len));
+    uint32_t len = log->chunk_len;
+    log->chunk_len = 0;
+    log->chunk_cnt = 0;
+
+    if (log->write_ofs + len > SAMPLE_LOG_SECTOR_SIZE && !start_sector(log))
+        return false;
+
+    uint32_t addr = log->head * SAMPLE_LOG_SECTOR_SIZE + log->write_ofs;
+    if (!log->flash.write(log->flash.ctx, addr, log->chunk, len))
+    {
+        log->write_ofs = SAMPLE_LOG_SECTOR_SIZE;
+        return false;
+    }
+    log->write_ofs += len;
+    return true;
+}
+
+static bool add_record(sample_log_t *log, const sample_log_record_t *rec)
+{
+    bool ok = true;
+    // A chunk covers consecutive intervals, a gap starts a new one
+    if (log->chunk_cnt > 0 && rec->time_s != log->prev.time_s + SAMPLE_LOG_INTERVAL_S)
+        ok = sample_log_flush(log);
+
+    if (log->chunk_cnt == 0)
+    {
+        put_u32(log->chunk + CHUNK_TIME, rec->time_s);
+        put_u16(log->chunk + CHUNK_CO2, rec->co2_ppm);
+        put_u16(log->chunk + CHUNK_TEMP, (uint16_t)rec->temp_ddeg);
+        put_u16(log->chunk + CHUNK_RH, rec->rh_dpct);
+        log->chunk_len = SAMPLE_LOG_CHUNK_HEADER;
+    }
+    else
+    {
+        log->chunk_len += encode_record(log->chunk + log->chunk_len, &log->prev, rec);
+    }
+    log->chunk_cnt++;
+    log->prev = *rec;
+    log->end_s = rec->time_s + SAMPLE_LOG_INTERVAL_S;
+
+    if (log->chunk_cnt == SAMPLE_LOG_CHUNK_RECORDS)
+        ok &= sample_log_flush(log);
+    return ok;
+}
+
+bool sample_log_add(sample_log_t *log, const history_sample_t *sample)
+{
+    // Already logged before a restart
+    if (sample->time_s < log->end_s)
+        return true;
+
+    bool ok = true;
+    uint32_t slot = sample->time_s / SAMPLE_LOG_INTERVAL_S;
+    if (log->acc_cnt > 0 && slot != log->acc_slot)
+    {
+        sample_log_record_t rec = {
+            .time_s = log->acc_slot * SAMPLE_LOG_INTERVAL_S,
+            .co2_ppm = (uint16_t)div_round(log->acc_co2, log->acc_cnt),
+            .temp_ddeg = (int16_t)div_round(log->acc_temp, log->acc_cnt * 10),
+            .rh_dpct = (uint16_t)div_round(log->acc_rh, log->acc_cnt * 10),
+        };
+        log->acc_cnt = 0;
+        ok = add_record(log, &rec);
+    }
+    if (log->acc_cnt == 0)
+    {
+        log->acc_slot = slot;
+        log->acc_co2 = 0;
+        log->acc_temp = 0;
+        log->acc_rh = 0;
+    }
+    log->acc_cnt++;
+    log->acc_co2 += sample->co2_ppm;
+    log->acc_temp += sample->temp_cdeg;
+    log->acc_rh += sample->rh_cpct;
+    return ok;
+}
+
+void sample_log_iter_init(const sample_log_t *log, sample_log_iter_t *iter, uint32_t from_s)
+{
+    memset(iter, 0, sizeof(*iter));
+    iter->log = log;
+    iter->sector = UINT32_MAX;
+    if (log->empty)
+        return;
+
+    // Step back from the newest sector until one starts early enough or the older ones were overwritten
+    uint32_t sector = log->head;
+    uint32_t seq = log->head_seq;
+    for (uint32_t i = 0; i < log->sector_cnt; i++)
+    {
+        uint32_t sector_seq;
+        if (!sector_get_seq(log, sector, &sector_seq, NULL) || sector_seq != seq)
+            break;
+        iter->sector = sector;
+        iter->seq = seq;
+
+        uint32_t len;
+        if (read_chunk(log, sector, SECTOR_HEADER, iter->chunk, &len) == CHUNK_OK &&
+            get_u32(iter->chunk + CHUNK_TIME) <= from_s)
+            break;
+        sector = (sector + log->sector_cnt - 1) % log->sector_cnt;
+        seq--;
+    }
+    iter->ofs = SECTOR_HEADER;
+}
+
+bool sample_log_iter_next(sample_log_iter_t *iter, sample_log_record_t *rec)
+{
+    const sample_log_t *log = iter->log;
+    while (iter->left == 0)
+    {
+        if (iter->sector == UINT32_MAX)
+            return false;
+
+        if (read_chunk(log, iter->sector, iter->ofs, iter->chunk, &iter->chunk_len) == CHUNK_OK)
+        {
+            iter->ofs += iter->chunk_len;
+            decode_first(iter->chunk, &iter->rec);
+            iter->left = iter->chunk[CHUNK_CNT];
+            iter->pos = 0;
+            break;
+        }
+
+        // End of the sector, continue in the next one if it was written after this one
+        uint32_t seq;
+        iter->sector = (iter->sector + 1) % log->sector_cnt;
+        iter->seq++;
+        iter->ofs = SECTOR_HEADER;
+        if (iter->seq == log->head_seq + 1 || !sector_get_seq(log, iter->sector, &seq, NULL) || seq != iter->seq)
+            iter->sector = UINT32_MAX;
+    }
+
+    if (iter->pos == 0)
+    {
+        iter->pos = SAMPLE_LOG_CHUNK_HEADER;
+    }
+    else
+    {
+        uint32_t n = decode_record(iter->chunk + iter->pos, iter->chunk_len - iter->pos, &iter->rec);
+        if (n == 0)
+        {
+            // Can't happen with a valid CRC, skip the rest of the chunk
+            iter->left = 0;
+            return sample_log_iter_next(iter, rec);
+        }
+        iter->pos += n;
+    }
+    iter->left--;
+    *rec = iter->rec;
+    return true;
+}
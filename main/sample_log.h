@@ -0,0 +1,104 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "history.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SAMPLE_LOG_SECTOR_SIZE 4096 // Erase unit of the flash
+#define SAMPLE_LOG_INTERVAL_S 60    // One record per this many seconds, the average of the samples meanwhile
+#define SAMPLE_LOG_CHUNK_RECORDS 16 // Records written to flash at once, lost on power off unless flushed
+#define SAMPLE_LOG_CHUNK_HEADER 14
+#define SAMPLE_LOG_CHUNK_MAX (SAMPLE_LOG_CHUNK_HEADER + (SAMPLE_LOG_CHUNK_RECORDS - 1) * 7)
+
+// Flash access. Returns true on success. Implemented with esp_partition_*() on the device, and with a file
+// on Linux to test the format without the device.
+typedef struct
+{
+    bool (*read)(void *ctx, uint32_t offset, void *buf, uint32_t len);
+    bool (*write)(void *ctx, uint32_t offset, const void *buf, uint32_t len);
+    bool (*erase)(void *ctx, uint32_t offset, uint32_t len); // Whole sectors
+    void *ctx;
+    uint32_t size; // At least 2 sectors
+} sample_log_flash_t;
+
+// A logged measurement, quantized to the resolution of the log
+typedef struct
+{
+    uint32_t time_s;
+    uint16_t co2_ppm;
+    int16_t temp_ddeg; // Temperature in 0.1 degC
+    uint16_t rh_dpct;  // Relative humidity in 0.1 %
+} sample_log_record_t;
+
+// Append-only log of measurements in a flash partition.
+//
+// The partition is a ring of sectors, each starting with a header with a sequence number. Only the sector after
+// the newest one is ever erased, so the sectors wear evenly and the oldest data is dropped first.
+// Records are written in chunks: the first record of a chunk is stored as it is, the others as the difference
+// from the previous one, in 1-3 bytes mostly. A chunk has a CRC, so a chunk torn by a power loss is detected.
+// Opening the log reads the sector headers and scans only the newest sector, so it takes the same time however
+// full the log is.
+typedef struct
+{
+    sample_log_flash_t flash;
+    uint32_t sector_cnt;
+    uint32_t head;      // Sector written now
+    uint32_t head_seq;  // Its sequence number
+    bool empty;         // No valid sector yet
+    uint32_t write_ofs; // Free space in the head sector, SAMPLE_LOG_SECTOR_SIZE if none
+    uint32_t end_s;     // Time after the last record written, 0 if none
+
+    // Average of the current interval
+    uint32_t acc_slot;
+    uint32_t acc_cnt;
+    int32_t acc_co2;
+    int32_t acc_temp;
+    int32_t acc_rh;
+
+    // Chunk being filled
+    uint8_t chunk[SAMPLE_LOG_CHUNK_MAX];
+    uint32_t chunk_len;
+    uint32_t chunk_cnt;
+    sample_log_record_t prev;
+} sample_log_t;
+
+// Reads the records of a log from the oldest one
+typedef struct
+{
+    const sample_log_t *log;
+    uint32_t sector;
+    uint32_t seq;
+    uint32_t ofs;
+    uint8_t chunk[SAMPLE_LOG_CHUNK_MAX];
+    uint32_t chunk_len;
+    uint32_t pos;  // Read position in `chunk`
+    uint32_t left; // Records left in `chunk`
+    sample_log_record_t rec;
+} sample_log_iter_t;
+
+// Find the end of the log in `flash`. Returns false if the flash can't be read.
+bool sample_log_open(sample_log_t *log, const sample_log_flash_t *flash);
+
+// Time after the last record in the log, 0 if none. Continue the log from here after a restart.
+uint32_t sample_log_get_end_time(const sample_log_t *log);
+
+// Add a measurement. It's written when SAMPLE_LOG_CHUNK_RECORDS intervals are complete.
+// Returns false if writing the flash failed, the log continues in the next sector then.
+bool sample_log_add(sample_log_t *log, const history_sample_t *sample);
+
+// Write the records of the complete intervals now, e.g. before a restart
+bool sample_log_flush(sample_log_t *log);
+
+// Start reading at the sector containing `from_s` or at the oldest record if that's later
+void sample_log_iter_init(const sample_log_t *log, sample_log_iter_t *iter, uint32_t from_s);
+
+// Get the next record written to flash. Returns false at the end.
+bool sample_log_iter_next(sample_log_iter_t *iter, sample_log_record_t *rec);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+#include "scd4x_sched.h"
+
+#define NUDGE_MS 5         // Initial nudge_ms, doubled every time the measurement is ready at the first check
+#define POLL_SLOW_MS 1000  // Check this often if there is no data for 2 periods, e.g. the sensor was restarted
+#define PERIOD_TOLERANCE 8 // Ignore period measurements off by more than 1/8 of the nominal period
+
+static int64_t period_ms(const scd4x_sched_t *sched)
+{
+    return (sched->period_us + 500) / 1000;
+}
+
+// Correct the period with the time between two measurements found by polling
+static void measure_period(scd4x_sched_t *sched, int64_t ready_ms)
+{
+    if (sched->anchor_ms >= 0)
+    {
+        int64_t elapsed_us = (ready_ms - sched->anchor_ms) * 1000;
+        int64_t periods = (elapsed_us + sched->period_us / 2) / sched->period_us;
+        if (periods > 0)
+        {
+            int64_t measured_us = elapsed_us / periods;
+            int64_t nominal_us = (int64_t)sched->nominal_period_ms * 1000;
+            if (measured_us > nominal_us - nominal_us / PERIOD_TOLERANCE &&
+                measured_us < nominal_us + nominal_us / PERIOD_TOLERANCE)
+            {
+                // Average, a single measurement is accurate only to SCD4X_SCHED_POLL_MS / periods
+                sched->period_us += (int32_t)(measured_us - sched->period_us) / 4;
+            }
+        }
+    }
+    sched->anchor_ms = ready_ms;
+}
+
+void scd4x_sched_init(scd4x_sched_t *sched, uint32_t period_ms, int64_t now_ms)
+{
+    sched->nominal_period_ms = period_ms;
+    sched->period_us = period_ms * 1000;
+    sched->next_ready_ms = now_ms + period_ms;
+    sched->last_ready_ms = -1;
+    sched->not_ready_ms = -1;
+    sched->anchor_ms = -1;
+    sched->nudge_ms = NUDGE_MS;
+
+    sched->stats = (scd4x_sched_stats_t){0};
+    sched->stats.period_us = sched->period_us;
+}
+
+uint32_t scd4x_sched_get_delay(const scd4x_sched_t *sched, int64_t now_ms)
+{
+    int64_t check_ms;
+    if (sched->not_ready_ms < 0)
+        check_ms = sched->next_ready_ms + SCD4X_SCHED_MARGIN_MS;
+    else if (sched->not_ready_ms - sched->next_ready_ms < 2 * period_ms(sched))
+        check_ms = sched->not_ready_ms + SCD4X_SCHED_POLL_MS;
+    else
+        check_ms = sched->not_ready_ms + POLL_SLOW_MS;
+
+    return check_ms > now_ms ? (uint32_t)(check_ms - now_ms) : 0;
+}
+
+void scd4x_sched_report(scd4x_sched_t *sched, int64_t now_ms, bool ready)
+{
+    scd4x_sched_stats_t *stats = &sched->stats;
+    stats->checks++;
+
+    if (!ready)
+    {
+        if (sched->not_ready_ms < 0)
+            stats->late++;
+        sched->not_ready_ms = now_ms;
+        sched->nudge_ms = NUDGE_MS;
+        return;
+    }
+
+    int64_t ready_ms;
+    int64_t latency_ms;
+    if (sched->not_ready_ms < 0)
+    {
+        // Ready at the first check, but it's unknown how much earlier. Expect the next one earlier and earlier,
+        // until a check finds no data and the time gets known by polling. This follows a faster sensor too.
+        latency_ms = now_ms - sched->next_ready_ms;
+        ready_ms = sched->next_ready_ms - sched->nudge_ms;
+        if (sched->nudge_ms < sched->nominal_period_ms / PERIOD_TOLERANCE)
+            sched->nudge_ms *= 2;
+    }
+    else
+    {
+        // Became ready between the last two checks
+        ready_ms = sched->not_ready_ms + (now_ms - sched->not_ready_ms) / 2;
+        latency_ms = now_ms - ready_ms;
+        measure_period(sched, ready_ms);
+    }
+    if (latency_ms < 0)
+        latency_ms = 0;
+
+    sched->last_ready_ms = ready_ms;
+    sched->not_ready_ms = -1;
+    sched->next_ready_ms = ready_ms + period_ms(sched);
+    while (sched->next_ready_ms <= now_ms)
+        sched->next_ready_ms += period_ms(sched);
+
+    stats->measurements++;
+    stats->latency_ms = (uint32_t)latency_ms;
+    if (stats->latency_ms > stats->latency_max_ms)
+        stats->latency_max_ms = stats->latency_ms;
+    if (stats->measurements == 1)
+        stats->latency_avg_ms = stats->latency_ms;
+    else
+        stats->latency_avg_ms = (stats->latency_avg_ms * 7 + stats->latency_ms) / 8;
+    stats->period_us = sched->period_us;
+}
+
+uint32_t scd4x_sched_get_age(const scd4x_sched_t *sched, int64_t now_ms)
+{
+    if (sched->last_ready_ms < 0)
+        return UINT32_MAX;
+
+    return now_ms > sched->last_ready_ms ? (uint32_t)(now_ms - sched->last_ready_ms) : 0;
+}
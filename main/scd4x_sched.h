@@ -0,0 +1,57 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Signal update interval of the SCD4x
+#define SCD4X_SCHED_PERIOD_MS 5000            // scd4x_start_periodic_measurement()
+#define SCD4X_SCHED_PERIOD_LOW_POWER_MS 30000 // scd4x_start_low_power_periodic_measurement()
+
+#define SCD4X_SCHED_MARGIN_MS 20 // Check this long after the data is expected to be ready
+#define SCD4X_SCHED_POLL_MS 50   // Check this often when the data wasn't ready at the expected time
+
+// Timing of the measurements
+typedef struct
+{
+    uint32_t measurements;   // Measurements found ready
+    uint32_t checks;         // Data ready checks, i.e. I2C transactions besides reading the measurements
+    uint32_t late;           // Measurements which weren't ready at the expected time
+    uint32_t latency_ms;     // Estimated time from data ready until it was found, last measurement
+    uint32_t latency_max_ms; // Largest latency_ms so far
+    uint32_t latency_avg_ms; // Moving average of latency_ms
+    uint32_t period_us;      // Measured signal update interval of the sensor
+} scd4x_sched_stats_t;
+
+// Tells when to check the sensor for new data: shortly after the next measurement is expected, instead of
+// polling. The expected time is corrected with the measurements found, so it follows the drift of the sensor.
+// Only the time is needed, so it can be tested without the sensor.
+typedef struct
+{
+    int64_t next_ready_ms;    // Expected time of the next measurement
+    int64_t last_ready_ms;    // Estimated time of the last measurement, -1 if none
+    int64_t not_ready_ms;     // Time of the last check which found no new data, -1 if none since the last measurement
+    int64_t anchor_ms;        // Last measurement with known time (found by polling), -1 if none
+    uint32_t nudge_ms;        // Expect the next measurement this much earlier if it's ready at the first check
+    uint32_t nominal_period_ms;
+    uint32_t period_us;       // Estimated signal update interval
+    scd4x_sched_stats_t stats;
+} scd4x_sched_t;
+
+// Start scheduling. Call it when the periodic measurement has been started.
+void scd4x_sched_init(scd4x_sched_t *sched, uint32_t period_ms, int64_t now_ms);
+
+// Time until the sensor has to be checked for new data
+uint32_t scd4x_sched_get_delay(const scd4x_sched_t *sched, int64_t now_ms);
+
+// Report the result of a data ready check. `ready` is false also if the check failed.
+void scd4x_sched_report(scd4x_sched_t *sched, int64_t now_ms, bool ready);
+
+// Age of the last measurement or UINT32_MAX if none
+uint32_t scd4x_sched_get_age(const scd4x_sched_t *sched, int64_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,6 +1,7 @@
 #include "st7701_panel.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_attr.h"
 #include "hw_layout.h"
 #include "lcd_bl_pwm_bsp.h"
 #include "esp_lcd_panel_io_additions.h"
@@ -68,7 +69,7 @@ static const st7701_lcd_init_cmd_t lcd_init_cmds[] =
 static esp_lcd_panel_handle_t s_panel = NULL;
 static esp_lcd_panel_io_handle_t s_panel_io = NULL;
 
-static bool isr_on_bounce_frame_fin(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
+static bool IRAM_ATTR isr_on_bounce_frame_fin(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
 {
     BaseType_t high_task_awoken = pdFALSE;
     xSemaphoreGiveFromISR(flush_done, &high_task_awoken);
@@ -194,6 +195,25 @@ void st7701_wait_flush_done(void)
     xSemaphoreTake(flush_done, portMAX_DELAY);
 }
 
+esp_err_t st7701_panel_get_frame_buffers(void **fb0, void **fb1)
+{
+    ESP_RETURN_ON_FALSE(s_panel, ESP_ERR_INVALID_STATE, TAG, "panel not initialized");
+    return esp_lcd_rgb_panel_get_frame_buffer(s_panel, 2, fb0, fb1);
+}
+
+esp_err_t st7701_panel_flip_fb(void *fb)
+{
+    ESP_RETURN_ON_FALSE(s_panel, ESP_ERR_INVALID_STATE, TAG, "panel not initialized");
+    // Passing a frame buffer itself only switches the scanned out buffer, nothing is copied.
+    // The switch takes effect when the next frame starts.
+    esp_err_t ret = esp_lcd_panel_draw_bitmap(s_panel, 0, 0, LCD_H_RES, LCD_V_RES, fb);
+    // Drop the frame dones given so far, also one given just before the switch was issued.
+    // The next frame done is then of a frame started before the switch at the latest,
+    // and every frame after it reads the new buffer.
+    xSemaphoreTake(flush_done, 0);
+    return ret;
+}
+
 esp_err_t st7701_panel_set_backlight(uint16_t duty)
 {
     setUpduty(duty);
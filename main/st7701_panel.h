@@ -11,6 +11,10 @@ esp_err_t st7701_panel_init(esp_lcd_panel_handle_t *panel_handle);
 
 void st7701_wait_flush_done(void);
 
+esp_err_t st7701_panel_get_frame_buffers(void **fb0, void **fb1);
+
+esp_err_t st7701_panel_flip_fb(void *fb);
+
 esp_err_t st7701_panel_set_backlight(uint16_t duty);
 
 #ifdef __cplusplus
@@ -35,6 +35,8 @@
 #include "i2cdev.h"
 #include <driver/i2c_master.h>
 #include <esp_log.h>
+#include <esp_rom_sys.h>
+#include <esp_timer.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <inttypes.h>
@@ -60,6 +62,9 @@ typedef struct
     uint32_t ref_count;                 // Number of devices currently active on this bus port
     int sda_pin_current;                // Actual SDA pin the bus was initialized with
     int scl_pin_current;                // Actual SCL pin the bus was initialized with
+    portMUX_TYPE stats_lock;            // Spinlock for stats and transfers_active
+    uint32_t transfers_active;          // Transfers in progress on this port
+    i2c_dev_port_stats_t stats;
 } i2c_port_state_t;
 
 static i2c_port_state_t i2c_ports[I2C_NUM_MAX] = { 0 };
@@ -128,6 +133,9 @@ esp_err_t i2cdev_init(void)
         i2c_ports[i].bus_handle = NULL;
         i2c_ports[i].sda_pin_current = -1;
         i2c_ports[i].scl_pin_current = -1;
+        portMUX_INITIALIZE(&i2c_ports[i].stats_lock);
+        i2c_ports[i].transfers_active = 0;
+        memset(&i2c_ports[i].stats, 0, sizeof(i2c_ports[i].stats));
     }
     ESP_LOGV(TAG, "I2C subsystem initialized.");
     return ESP_OK;
@@ -558,17 +566,98 @@ static esp_err_t i2c_setup_device(i2c_dev_t *dev) // dev is non-const - modifies
     return res;
 }
 
-// Helper function with retry mechanism for I2C operations
-static esp_err_t i2c_do_operation_with_retry(i2c_dev_t *dev, esp_err_t (*i2c_func)(i2c_master_dev_handle_t, const void *, size_t, void *, size_t, int), const void *write_buffer, size_t write_size,
-                                             void *read_buffer, size_t read_size)
+// Wait without holding the bus. Waits of a tick or longer let other tasks run meanwhile.
+static void i2c_wait_us(uint32_t wait_us)
+{
+    const uint32_t tick_us = portTICK_PERIOD_MS * 1000;
+    if (wait_us < tick_us)
+    {
+        esp_rom_delay_us(wait_us);
+        return;
+    }
+    // vTaskDelay(n) returns after n - 1 to n tick periods
+    vTaskDelay((wait_us + tick_us - 1) / tick_us + 1);
+}
+
+// Execute the steps of a transaction from *next_step on. *next_step is advanced past each finished step, so on
+// failure it's the failed step. Adds the time spent waiting to *wait_time_us.
+static esp_err_t i2c_run_steps(i2c_dev_t *dev, const i2c_dev_step_t *steps, size_t steps_cnt, size_t *next_step, int timeout_ms,
+                               int64_t *wait_time_us)
+{
+    i2c_port_state_t *port_state = &i2c_ports[dev->port];
+
+    for (size_t i = *next_step; i < steps_cnt; i++)
+    {
+        const i2c_dev_step_t *step = &steps[i];
+        if (step->out_size || step->in_size)
+        {
+            portENTER_CRITICAL(&port_state->stats_lock);
+            if (port_state->transfers_active++ > 0)
+                port_state->stats.contended++;
+            port_state->stats.transfers++;
+            portEXIT_CRITICAL(&port_state->stats_lock);
+
+            esp_err_t res;
+            if (step->out_size && step->in_size)
+                res = i2c_master_transmit_receive(dev->dev_handle, step->out_data, step->out_size, step->in_data, step->in_size, timeout_ms);
+            else if (step->in_size)
+                res = i2c_master_receive(dev->dev_handle, step->in_data, step->in_size, timeout_ms);
+            else
+                res = i2c_master_transmit(dev->dev_handle, step->out_data, step->out_size, timeout_ms);
+
+            portENTER_CRITICAL(&port_state->stats_lock);
+            port_state->transfers_active--;
+            if (res != ESP_OK)
+                port_state->stats.errors++;
+            portEXIT_CRITICAL(&port_state->stats_lock);
+
+            if (res != ESP_OK)
+            {
+                ESP_LOGV(TAG, "[0x%02x at %d] Step %u of %u failed", dev->addr, dev->port, i, steps_cnt);
+                return res;
+            }
+        }
+
+        if (step->wait_us)
+        {
+            int64_t wait_start_us = esp_timer_get_time();
+            i2c_wait_us(step->wait_us);
+            *wait_time_us += esp_timer_get_time() - wait_start_us;
+        }
+        *next_step = i + 1;
+    }
+    return ESP_OK;
+}
+
+// Count a finished transaction in the port statistics
+static void i2c_count_transaction(i2c_dev_t *dev, int64_t start_us, int64_t wait_time_us)
+{
+    i2c_port_state_t *port_state = &i2c_ports[dev->port];
+    int64_t latency_us = esp_timer_get_time() - start_us - wait_time_us;
+
+    portENTER_CRITICAL(&port_state->stats_lock);
+    port_state->stats.transactions++;
+    port_state->stats.latency_total_us += latency_us;
+    if (latency_us > port_state->stats.latency_max_us)
+        port_state->stats.latency_max_us = (uint32_t)latency_us;
+    portEXIT_CRITICAL(&port_state->stats_lock);
+}
+
+// Helper function with retry mechanism for I2C operations. The device is set up once per attempt, not per step.
+// A retry continues with the failed step: the steps before it were done, and repeating a command could execute
+// it twice on the device (e.g. a calibration), where only reading its response failed.
+static esp_err_t i2c_do_steps_with_retry(i2c_dev_t *dev, const i2c_dev_step_t *steps, size_t steps_cnt)
 {
     if (!dev)
         return ESP_ERR_INVALID_ARG;
     esp_err_t res = ESP_FAIL;
     int retry = 0;
+    size_t next_step = 0;
     int timeout_ms = CONFIG_I2CDEV_TIMEOUT;
+    int64_t start_us = esp_timer_get_time();
+    int64_t wait_time_us = 0;
 
-    ESP_LOGV(TAG, "[0x%02x at %d] Performing I2C operation (timeout %d ms)...", dev->addr, dev->port, timeout_ms);
+    ESP_LOGV(TAG, "[0x%02x at %d] Performing I2C operation of %u steps (timeout %d ms)...", dev->addr, dev->port, steps_cnt, timeout_ms);
 
     while (retry <= I2C_MAX_RETRIES)
     {
@@ -597,12 +686,14 @@ static esp_err_t i2c_do_operation_with_retry(i2c_dev_t *dev, esp_err_t (*i2c_fun
             continue;
         }
 
-        ESP_LOGV(TAG, "[0x%02x at %d] Attempting I2C op (Try %d, Handle %p)", dev->addr, dev->port, retry, dev->dev_handle);
-        res = i2c_func(dev->dev_handle, write_buffer, write_size, read_buffer, read_size, timeout_ms);
+        ESP_LOGV(TAG, "[0x%02x at %d] Attempting I2C op (Try %d, Handle %p, step %u)", dev->addr, dev->port, retry, dev->dev_handle,
+                 next_step);
+        res = i2c_run_steps(dev, steps, steps_cnt, &next_step, timeout_ms, &wait_time_us);
 
         if (res == ESP_OK)
         {
             ESP_LOGV(TAG, "[0x%02x at %d] I2C operation successful (Try %d).", dev->addr, dev->port, retry);
+            i2c_count_transaction(dev, start_us, wait_time_us);
             return ESP_OK;
         }
 
@@ -653,24 +744,38 @@ static esp_err_t i2c_do_operation_with_retry(i2c_dev_t *dev, esp_err_t (*i2c_fun
     }
 
     ESP_LOGE(TAG, "[0x%02x at %d] I2C operation failed after %d retries. Last error: %d (%s)", dev->addr, dev->port, I2C_MAX_RETRIES + 1, res, esp_err_to_name(res));
+    i2c_count_transaction(dev, start_us, wait_time_us);
     return res;
 }
 
-// Wrapper functions for the I2C master API to use with the retry mechanism
-// i2c_do_operation_with_retry() needs a unified function signature for all I2C operations
-static esp_err_t i2c_master_transmit_wrapper(i2c_master_dev_handle_t handle, const void *write_buffer, size_t write_size, void *read_buffer, size_t read_size, int timeout_ms)
+esp_err_t i2c_dev_transaction(const i2c_dev_t *dev, const i2c_dev_step_t *steps, size_t steps_cnt)
 {
-    return i2c_master_transmit(handle, write_buffer, write_size, timeout_ms);
-}
+    if (!dev || !steps || !steps_cnt)
+        return ESP_ERR_INVALID_ARG;
+    for (size_t i = 0; i < steps_cnt; i++)
+    {
+        if ((steps[i].out_size && !steps[i].out_data) || (steps[i].in_size && !steps[i].in_data))
+            return ESP_ERR_INVALID_ARG;
+    }
 
-static esp_err_t i2c_master_receive_wrapper(i2c_master_dev_handle_t handle, const void *write_buffer, size_t write_size, void *read_buffer, size_t read_size, int timeout_ms)
-{
-    return i2c_master_receive(handle, read_buffer, read_size, timeout_ms);
+    ESP_LOGV(TAG, "[0x%02x at %d] i2c_dev_transaction called (steps: %u)", dev->addr, dev->port, steps_cnt);
+
+    // Cast to non-const for i2c_setup_device internal modifications
+    esp_err_t result = i2c_do_steps_with_retry((i2c_dev_t *)dev, steps, steps_cnt);
+
+    ESP_LOGV(TAG, "[0x%02x at %d] i2c_dev_transaction result: %s (%d)", dev->addr, dev->port, esp_err_to_name(result), result);
+    return result;
 }
 
-static esp_err_t i2c_master_transmit_receive_wrapper(i2c_master_dev_handle_t handle, const void *write_buffer, size_t write_size, void *read_buffer, size_t read_size, int timeout_ms)
+esp_err_t i2c_dev_get_port_stats(i2c_port_t port, i2c_dev_port_stats_t *stats)
 {
-    return i2c_master_transmit_receive(handle, write_buffer, write_size, read_buffer, read_size, timeout_ms);
+    if (port >= I2C_NUM_MAX || !stats)
+        return ESP_ERR_INVALID_ARG;
+
+    portENTER_CRITICAL(&i2c_ports[port].stats_lock);
+    *stats = i2c_ports[port].stats;
+    portEXIT_CRITICAL(&i2c_ports[port].stats_lock);
+    return ESP_OK;
 }
 
 esp_err_t i2c_dev_read(const i2c_dev_t *dev, const void *out_data, size_t out_size, void *in_data, size_t in_size)
@@ -680,8 +785,14 @@ esp_err_t i2c_dev_read(const i2c_dev_t *dev, const void *out_data, size_t out_si
 
     ESP_LOGV(TAG, "[0x%02x at %d] i2c_dev_read called (out_size: %u, in_size: %u)", dev->addr, dev->port, out_size, in_size);
 
-    esp_err_t result = i2c_do_operation_with_retry((i2c_dev_t *)dev, // Cast to non-const for i2c_setup_device internal modifications
-                                                   out_data && out_size ? i2c_master_transmit_receive_wrapper : i2c_master_receive_wrapper, out_data, out_size, in_data, in_size);
+    const i2c_dev_step_t step = {
+        .out_data = out_data,
+        .out_size = out_data ? out_size : 0,
+        .in_data = in_data,
+        .in_size = in_size,
+    };
+    esp_err_t result = i2c_do_steps_with_retry((i2c_dev_t *)dev, // Cast to non-const for i2c_setup_device internal modifications
+                                               &step, 1);
 
     ESP_LOGV(TAG, "[0x%02x at %d] i2c_dev_read result: %s (%d)", dev->addr, dev->port, esp_err_to_name(result), result);
     return result;
@@ -715,7 +826,8 @@ esp_err_t i2c_dev_write(const i2c_dev_t *dev, const void *out_reg, size_t out_re
             uint8_t stack_buf[I2CDEV_MAX_STACK_ALLOC_SIZE];
             memcpy(stack_buf, out_reg, out_reg_size);
             memcpy(stack_buf + out_reg_size, out_data, out_size);
-            res = i2c_do_operation_with_retry((i2c_dev_t *)dev, i2c_master_transmit_wrapper, stack_buf, total_write_size, NULL, 0);
+            const i2c_dev_step_t step = { .out_data = stack_buf, .out_size = total_write_size };
+            res = i2c_do_steps_with_retry((i2c_dev_t *)dev, &step, 1);
         }
         else
         {
@@ -727,17 +839,20 @@ esp_err_t i2c_dev_write(const i2c_dev_t *dev, const void *out_reg, size_t out_re
             }
             memcpy(heap_buf, out_reg, out_reg_size);
             memcpy(heap_buf + out_reg_size, out_data, out_size);
-            res = i2c_do_operation_with_retry((i2c_dev_t *)dev, i2c_master_transmit_wrapper, heap_buf, total_write_size, NULL, 0);
+            const i2c_dev_step_t step = { .out_data = heap_buf, .out_size = total_write_size };
+            res = i2c_do_steps_with_retry((i2c_dev_t *)dev, &step, 1);
             free(heap_buf); // Free buffer regardless of operation result
         }
     }
     else if (out_reg && out_reg_size)
     {
-        res = i2c_do_operation_with_retry((i2c_dev_t *)dev, i2c_master_transmit_wrapper, out_reg, out_reg_size, NULL, 0);
+        const i2c_dev_step_t step = { .out_data = out_reg, .out_size = out_reg_size };
+        res = i2c_do_steps_with_retry((i2c_dev_t *)dev, &step, 1);
     }
     else if (out_data && out_size)
     {
-        res = i2c_do_operation_with_retry((i2c_dev_t *)dev, i2c_master_transmit_wrapper, out_data, out_size, NULL, 0);
+        const i2c_dev_step_t step = { .out_data = out_data, .out_size = out_size };
+        res = i2c_do_steps_with_retry((i2c_dev_t *)dev, &step, 1);
     }
     else
     {
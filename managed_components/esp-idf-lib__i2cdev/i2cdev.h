@@ -315,6 +315,58 @@ esp_err_t i2c_dev_read_reg(const i2c_dev_t *dev, uint8_t reg, void *data, size_t
  */
 esp_err_t i2c_dev_write_reg(const i2c_dev_t *dev, uint8_t reg, const void *data, size_t size);
 
+/**
+ * One step of a transaction: write, read, then wait
+ */
+typedef struct
+{
+    const void *out_data; //!< Data to write (can be NULL if out_size is 0)
+    size_t out_size;      //!< Size of data to write
+    void *in_data;        //!< Buffer to store data read, after a repeated start if out_size is not 0
+    size_t in_size;       //!< Number of bytes to read
+    uint32_t wait_us;     //!< Time to wait after the transfer, e.g. while the device executes a command
+} i2c_dev_step_t;
+
+/**
+ * I2C port statistics
+ */
+typedef struct
+{
+    uint32_t transactions;     //!< Finished transactions, single reads and writes included
+    uint32_t transfers;        //!< Bus transfers, retries included
+    uint32_t errors;           //!< Failed transfers
+    uint32_t contended;        //!< Transfers started while a transfer of another task was in progress on the port
+    uint32_t latency_max_us;   //!< Longest transaction, without its waits
+    uint64_t latency_total_us; //!< Total time of the transactions, without their waits
+} i2c_dev_port_stats_t;
+
+/**
+ * @brief Execute several transfers with a device as one transaction
+ *
+ * The device is set up once and the steps are executed back-to-back. The waits hold neither the
+ * bus nor the port: waits of a tick or longer are done with vTaskDelay(), so other tasks can use
+ * the other devices on the port meanwhile. If a step fails, the transaction is retried from that step on:
+ * the steps before it are not repeated, so a command is not sent again when only reading its response
+ * failed. A step which writes and reads is repeated as a whole.
+ *
+ * @note Like the other functions, it doesn't take the device mutex.
+ *
+ * @param dev Pointer to device descriptor
+ * @param steps Steps to execute in order
+ * @param steps_cnt Number of steps
+ * @return `ESP_OK` on success
+ */
+esp_err_t i2c_dev_transaction(const i2c_dev_t *dev, const i2c_dev_step_t *steps, size_t steps_cnt);
+
+/**
+ * @brief Get the statistics of a port
+ *
+ * @param port I2C port number
+ * @param[out] stats Statistics since i2cdev_init()
+ * @return `ESP_OK` on success, `ESP_ERR_NOT_SUPPORTED` with the legacy driver
+ */
+esp_err_t i2c_dev_get_port_stats(i2c_port_t port, i2c_dev_port_stats_t *stats);
+
 /**
  * @brief Take device mutex with error checking
  */
@@ -34,6 +34,7 @@
 #include "i2cdev.h"              // Common header
 #include <driver/i2c.h>          // Legacy I2C driver
 #include <esp_log.h>
+#include <ets_sys.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <inttypes.h>
@@ -780,6 +781,36 @@ esp_err_t i2c_dev_read_reg(const i2c_dev_t *dev, uint8_t reg, void *in_data, siz
     return err;
 }
 
+// Steps are executed one by one with i2c_dev_read()/i2c_dev_write(). No retries and no statistics with the legacy driver.
+esp_err_t i2c_dev_transaction(const i2c_dev_t *dev, const i2c_dev_step_t *steps, size_t steps_cnt)
+{
+    if (!dev || !steps || !steps_cnt)
+        return ESP_ERR_INVALID_ARG;
+
+    for (size_t i = 0; i < steps_cnt; i++)
+    {
+        const i2c_dev_step_t *step = &steps[i];
+        esp_err_t err = ESP_OK;
+        if (step->in_size)
+            err = i2c_dev_read(dev, step->out_data, step->out_size, step->in_data, step->in_size);
+        else if (step->out_size)
+            err = i2c_dev_write(dev, NULL, 0, step->out_data, step->out_size);
+        if (err != ESP_OK)
+            return err;
+
+        if (step->wait_us >= portTICK_PERIOD_MS * 1000)
+            vTaskDelay(pdMS_TO_TICKS((step->wait_us + 999) / 1000) + 1);
+        else if (step->wait_us)
+            ets_delay_us(step->wait_us);
+    }
+    return ESP_OK;
+}
+
+esp_err_t i2c_dev_get_port_stats(i2c_port_t port, i2c_dev_port_stats_t *stats)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
 // Implementation of i2c_dev_check_present (updated version of i2c_dev_probe) using legacy I2C driver
 esp_err_t i2c_dev_check_present(const i2c_dev_t *dev)
 {
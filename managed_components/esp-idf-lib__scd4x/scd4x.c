@@ -98,9 +98,10 @@ static inline uint16_t swap(uint16_t v)
     return (v << 8) | (v >> 8);
 }
 
-static esp_err_t send_cmd(i2c_dev_t *dev, uint16_t cmd, uint16_t *data, size_t words)
+#define MAX_WORDS 3 // Longest command argument or response
+
+static size_t encode_cmd(uint8_t *buf, uint16_t cmd, uint16_t *data, size_t words)
 {
-    uint8_t buf[2 + words * 3];
     // add command
     *(uint16_t *)buf = swap(cmd);
     if (data && words)
@@ -111,54 +112,61 @@ static esp_err_t send_cmd(i2c_dev_t *dev, uint16_t cmd, uint16_t *data, size_t w
             *(uint16_t *)p = swap(data[i]);
             *(p + 2) = crc8(p, 2);
         }
+    else
+        words = 0;
 
     ESP_LOGV(TAG, "Sending buffer:");
-    ESP_LOG_BUFFER_HEX_LEVEL(TAG, buf, sizeof(buf), ESP_LOG_VERBOSE);
+    ESP_LOG_BUFFER_HEX_LEVEL(TAG, buf, 2 + words * 3, ESP_LOG_VERBOSE);
 
-    return i2c_dev_write(dev, NULL, 0, buf, sizeof(buf));
+    return 2 + words * 3;
 }
 
-static esp_err_t read_resp(i2c_dev_t *dev, uint16_t *data, size_t words)
+static esp_err_t decode_resp(const uint8_t *buf, uint16_t *data, size_t words)
 {
-    uint8_t buf[words * 3];
-    CHECK(i2c_dev_read(dev, NULL, 0, buf, sizeof(buf)));
-
     ESP_LOGV(TAG, "Received buffer:");
-    ESP_LOG_BUFFER_HEX_LEVEL(TAG, buf, sizeof(buf), ESP_LOG_VERBOSE);
+    ESP_LOG_BUFFER_HEX_LEVEL(TAG, buf, words * 3, ESP_LOG_VERBOSE);
 
     for (size_t i = 0; i < words; i++)
     {
-        uint8_t *p = buf + i * 3;
+        const uint8_t *p = buf + i * 3;
         uint8_t crc = crc8(p, 2);
         if (crc != *(p + 2))
         {
             ESP_LOGE(TAG, "Invalid CRC 0x%02x, expected 0x%02x", crc, *(p + 2));
             return ESP_ERR_INVALID_CRC;
         }
-        data[i] = swap(*(uint16_t *)p);
+        data[i] = swap(*(const uint16_t *)p);
     }
     return ESP_OK;
 }
 
+// Send the command, wait for its execution time and read the response as one transaction.
+// The bus is free for other devices while the sensor executes the command.
 static esp_err_t execute_cmd(i2c_dev_t *dev, uint16_t cmd, uint32_t timeout_ms,
                              uint16_t *out_data, size_t out_words, uint16_t *in_data, size_t in_words)
 {
-    CHECK_ARG(dev);
+    CHECK_ARG(dev && out_words <= MAX_WORDS && in_words <= MAX_WORDS);
+
+    uint8_t out_buf[2 + MAX_WORDS * 3];
+    uint8_t in_buf[MAX_WORDS * 3];
+    i2c_dev_step_t steps[2] = {
+        {
+            .out_data = out_buf,
+            .out_size = encode_cmd(out_buf, cmd, out_data, out_words),
+            .wait_us = timeout_ms * 1000,
+        },
+        {
+            .in_data = in_buf,
+            .in_size = in_words * 3,
+        },
+    };
+    bool read = in_data && in_words;
 
     I2C_DEV_TAKE_MUTEX(dev);
-    I2C_DEV_CHECK(dev, send_cmd(dev, cmd, out_data, out_words));
-    if (timeout_ms)
-    {
-        if (timeout_ms > 10)
-            vTaskDelay(pdMS_TO_TICKS(timeout_ms));
-        else
-            ets_delay_us(timeout_ms * 1000);
-    }
-    if (in_data && in_words)
-        I2C_DEV_CHECK(dev, read_resp(dev, in_data, in_words));
+    I2C_DEV_CHECK(dev, i2c_dev_transaction(dev, steps, read ? 2 : 1));
     I2C_DEV_GIVE_MUTEX(dev);
 
-    return ESP_OK;
+    return read ? decode_resp(in_buf, in_data, in_words) : ESP_OK;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2,6 +2,11 @@ include("${CMAKE_CURRENT_LIST_DIR}/version.cmake")
 
 file(GLOB_RECURSE SOURCES ${LVGL_ROOT_DIR}/src/*.c ${LVGL_ROOT_DIR}/src/*.cpp)
 
+if(CONFIG_LV_DRAW_SW_ASM_ESP32S3)
+  file(GLOB_RECURSE ASM_SOURCES ${LVGL_ROOT_DIR}/src/draw/sw/blend/esp32s3/*.S)
+  list(APPEND SOURCES ${ASM_SOURCES})
+endif()
+
 idf_build_get_property(LV_MICROPYTHON LV_MICROPYTHON)
 
 if(LV_MICROPYTHON)
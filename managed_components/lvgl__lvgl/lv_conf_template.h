@@ -94,6 +94,21 @@
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
 
+/** 1: Allow comparing the rendered areas with the previously flushed content and
+ *  calling `flush_cb` only with the changed rows. Enable it per display with `lv_display_set_flush_diff()`.
+ *  Useful for mostly static screens where redrawn areas often look the same as before. */
+#define LV_USE_DISPLAY_FLUSH_DIFF 0
+
+/** 1: Keep the timers in a min-heap ordered by their next run time, so `lv_timer_handler()`
+ *  needs to check only the ready timers instead of all of them.
+ *  Useful with many timers. Uses 16 more bytes per timer. */
+#define LV_USE_TIMER_HEAP 0
+
+/** 1: Evaluate the built-in ease-in/out and overshoot animation paths from lookup tables
+ *  instead of solving the cubic-bezier for each animation in each step.
+ *  A table of ~2 kB is allocated for each of these paths when it's used first. */
+#define LV_USE_ANIM_PATH_LUT 0
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -151,6 +166,13 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Draw tasks and their descriptors are allocated from chunks of this size.
+ *  A chunk is reused when all draw tasks allocated from it are finished. */
+#define LV_DRAW_TASK_POOL_CHUNK_SIZE    (2 * 1024)      /**< [bytes]*/
+
+/** Number of unused chunks to keep for the next draw tasks instead of freeing them. */
+#define LV_DRAW_TASK_POOL_CACHE_CNT     4
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -194,6 +216,11 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** Split large draw tasks (e.g. a full screen gradient or a long label) into horizontal bands
+     *  which the idle rendering threads can steal, so all of them can work on the same draw task.
+     *  Has effect only if `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #define LV_DRAW_SW_TILE_SPLIT       0
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -206,16 +233,11 @@
     #define LV_DRAW_SW_COMPLEX          1
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /** Allow buffering some shadow calculation.
-         *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-        #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
-
-        /** Set number of maximally-cached circle data.
-         *  The circumference of 1/4 circle are saved for anti-aliasing.
-         *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
+        /** Byte budget of the cache of circle masks and shadow corners.
+         *  A rounded corner costs about `radius * 6` bytes and a shadow corner
+         *  `2 * (shadow_width + radius)^2` bytes. Entries larger than 1/4 of the budget are not cached.
          *  - 0: disables caching */
-        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+        #define LV_DRAW_SW_MASK_CACHE_SIZE (8 * 1024)
     #endif
 
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
@@ -499,6 +521,15 @@
  *  released immediately after use. */
 #define LV_CACHE_DEF_SIZE       0
 
+/** 1: Evict the images which are large and fast to decode first from the image cache (GreedyDual-Size).
+ *  0: Evict the least recently used images first. */
+#define LV_IMAGE_CACHE_COST_AWARE 0
+
+/** Split the image cache into this many parts with their own locks, so that the draw units
+ *  rarely wait for each other when they look up images in parallel (`LV_DRAW_SW_DRAW_UNIT_CNT > 1`).
+ *  Each part holds `LV_CACHE_DEF_SIZE / LV_IMAGE_CACHE_SHARD_CNT` bytes so larger images are not cached. */
+#define LV_IMAGE_CACHE_SHARD_CNT 1
+
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
@@ -657,6 +688,17 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Size of the cache in bytes which keeps the glyphs of `lv_font_fmt_txt` fonts converted to A8.
+ *  Without it the glyphs are converted (e.g. from 1 bpp or compressed) every time they are drawn.
+ *  0: disable the cache */
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+
+/** Max. memory in bytes for the lookup tables of `lv_font_fmt_txt` fonts.
+ *  The tables are built lazily per font to find the glyphs of BMP code points and
+ *  the kerning values of kern pair fonts without searching.
+ *  0: disable the lookup tables */
+#define LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE 0
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -961,6 +1003,10 @@
 /** Decode bin images to RAM */
 #define LV_BIN_DECODER_RAM_LOAD 0
 
+/** Use the pixels of uncompressed bin image files directly, without copying them to RAM,
+ *  if the file system driver can map files to memory (`map_cb`) */
+#define LV_BIN_DECODER_MAP_FILES 0
+
 /** RLE decompress library */
 #define LV_USE_RLE 0
 
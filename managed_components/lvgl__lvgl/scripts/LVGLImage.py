@@ -482,35 +482,69 @@ class LVGLImageHeader:
 
 class LVGLCompressData:
 
+    # Color formats whose rows are stored contiguously, without palette or
+    # separate alpha plane, thus can be compressed in bands of rows.
+    BAND_FORMATS = (ColorFormat.RGB565, ColorFormat.RGB565_SWAPPED,
+                    ColorFormat.ARGB8565, ColorFormat.RGB888,
+                    ColorFormat.XRGB8888, ColorFormat.ARGB8888)
+
     def __init__(self,
                  cf: ColorFormat,
                  method: CompressMethod,
-                 raw_data: bytes = b''):
+                 raw_data: bytes = b'',
+                 band_rows: int = 0,
+                 stride: int = 0):
         self.blk_size = (cf.bpp + 7) // 8
         self.compress = method
         self.raw_data = raw_data
         self.raw_data_len = len(raw_data)
+        self.band_rows = band_rows
+        if band_rows:
+            if cf not in self.BAND_FORMATS:
+                raise ParameterError(
+                    f"Band compression is not supported for {cf.name}")
+            if band_rows >= 1 << 16 or stride == 0:
+                raise ParameterError(f"Invalid band rows: {band_rows}")
+            self.band_size = band_rows * stride
         self.compressed = self._compress(raw_data)
 
-    def _compress(self, raw_data: bytes) -> bytearray:
-        if self.compress == CompressMethod.NONE:
-            return raw_data
-
+    def _compress_block(self, raw_data: bytes) -> bytes:
         if self.compress == CompressMethod.RLE:
             # RLE compression performs on pixel unit, pad data to pixel unit
             pad = b'\x00' * 0
-            if self.raw_data_len % self.blk_size:
-                pad = b'\x00' * (self.blk_size - self.raw_data_len % self.blk_size)
-            compressed = RLEImage().rle_compress(raw_data + pad, self.blk_size)
+            if len(raw_data) % self.blk_size:
+                pad = b'\x00' * (self.blk_size - len(raw_data) % self.blk_size)
+            return RLEImage().rle_compress(raw_data + pad, self.blk_size)
         elif self.compress == CompressMethod.LZ4:
-            compressed = lz4.block.compress(raw_data, store_size=False)
+            return lz4.block.compress(raw_data, store_size=False)
         else:
             raise ParameterError(f"Invalid compress method: {self.compress}")
 
+    def _compress(self, raw_data: bytes) -> bytearray:
+        if self.compress == CompressMethod.NONE:
+            return raw_data
+
+        if self.band_rows:
+            # Every band of rows is compressed on its own and located by an
+            # index of offsets, so the decoder can decompress only the bands
+            # it draws. The offsets are relative to the end of the index.
+            bands = [
+                self._compress_block(raw_data[i:i + self.band_size])
+                for i in range(0, self.raw_data_len, self.band_size)
+            ]
+            index = bytearray(uint32_t(0))
+            offset = 0
+            for band in bands:
+                offset += len(band)
+                index += uint32_t(offset)
+            compressed = bytes(index) + b"".join(bands)
+        else:
+            compressed = self._compress_block(raw_data)
+
         self.compressed_len = len(compressed)
 
         bin = bytearray()
-        bin += uint32_t(self.compress.value)
+        bin += uint32_t(self.compress.value | self.band_rows << 4)
         bin += uint32_t(self.compressed_len)
         bin += uint32_t(self.raw_data_len)
         bin += compressed
@@ -776,7 +810,8 @@ class LVGLImage:
 
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               band_rows: int = 0):
         """
         Write this image to file, filename should be ended with '.bin'
         """
@@ -795,7 +830,8 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
+            compressed = LVGLCompressData(self.cf, compress, self.data,
+                                          band_rows, self.stride)
             bin += compressed.compressed
 
             f.write(bin)
@@ -805,12 +841,14 @@ class LVGLImage:
     def to_c_array(self,
                    filename: str,
                    compress: CompressMethod = CompressMethod.NONE,
-                   outputname: str = None):
+                   outputname: str = None,
+                   band_rows: int = 0):
         self._check_ext(filename, ".c")
         self._check_dir(filename)
 
         if compress != CompressMethod.NONE:
-            data = LVGLCompressData(self.cf, compress, self.data).compressed
+            data = LVGLCompressData(self.cf, compress, self.data, band_rows,
+                                    self.stride).compressed
         else:
             data = self.data
         write_c_array_file(self.w, self.h, self.stride, self.cf, filename, outputname,
@@ -1319,7 +1357,8 @@ class PNGConverter:
                  compress: CompressMethod = CompressMethod.NONE,
                  keep_folder=True,
                  rgb565_dither=False,
-                 nema_gfx=False) -> None:
+                 nema_gfx=False,
+                 band_rows: int = 0) -> None:
         self.files = files
         self.cf = cf
         self.ofmt = ofmt
@@ -1329,6 +1368,7 @@ class PNGConverter:
         self.align = align
         self.premultiply = premultiply
         self.compress = compress
+        self.band_rows = band_rows
         self.background = background
         self.rgb565_dither = rgb565_dither
         self.nema_gfx = nema_gfx
@@ -1366,11 +1406,13 @@ class PNGConverter:
                 output.append((f, img))
                 if self.ofmt == OutputFormat.BIN_FILE:
                     img.to_bin(self._replace_ext(f, ".bin"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               band_rows=self.band_rows)
                 elif self.ofmt == OutputFormat.C_ARRAY:
                     img.to_c_array(self._replace_ext(f, ".c", outputname),
                                    compress=self.compress,
-                                   outputname=outputname)
+                                   outputname=outputname,
+                                   band_rows=self.band_rows)
                 elif self.ofmt == OutputFormat.PNG_FILE:
                     img.to_png(self._replace_ext(f, ".png"))
 
@@ -1405,6 +1447,15 @@ def main():
                         default="NONE",
                         choices=["NONE", "RLE", "LZ4"])
 
+    parser.add_argument('--band-rows',
+                        help=("compress the image in bands of this many rows, "
+                              "so only the visible bands are decompressed "
+                              "when drawing. Default to 0: compress the "
+                              "whole image at once"),
+                        default=0,
+                        type=int,
+                        metavar='rows')
+
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
                         default=1,
@@ -1455,6 +1506,8 @@ def main():
     ofmt = OutputFormat(args.ofmt) if cf not in (
         ColorFormat.RAW, ColorFormat.RAW_ALPHA) else OutputFormat.C_ARRAY
     compress = CompressMethod[args.compress]
+    if args.band_rows and compress == CompressMethod.NONE:
+        raise BaseException("--band-rows needs --compress RLE or LZ4")
 
     converter = PNGConverter(files,
                              cf,
@@ -1466,7 +1519,8 @@ def main():
                              compress=compress,
                              keep_folder=False,
                              rgb565_dither=args.rgb565dither,
-                             nema_gfx=args.nemagfx)
+                             nema_gfx=args.nemagfx,
+                             band_rows=args.band_rows)
     output = converter.convert(args.name)
     for f, img in output:
         logging.info(f"len: {img.data_len} for {path.basename(f)} ")
@@ -136,11 +136,8 @@ typedef struct _lv_global_t {
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    lv_draw_sw_shadow_cache_t sw_shadow_cache;
-#endif
 #if LV_DRAW_SW_COMPLEX
-    lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
+    lv_cache_t * sw_mask_cache;
 #endif
 
 #if LV_USE_LOG
@@ -210,6 +207,8 @@ typedef struct _lv_global_t {
 #if LV_USE_FONT_COMPRESSED
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
+    lv_font_fmt_txt_glyph_cache_t font_fmt_txt_glyph_cache;
+    lv_font_fmt_txt_lookup_info_t font_fmt_txt_lookup;
 
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
@@ -268,6 +267,7 @@ typedef struct _lv_global_t {
     uint32_t freertos_non_idle_time_sum;
     uint32_t freertos_task_switch_timestamp;
     bool freertos_idle_task_running;
+    SemaphoreHandle_t freertos_tickless_wakeup;
 #endif
 
 #if LV_USE_EVDEV
@@ -40,6 +40,8 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static int64_t join_area_cost(const lv_display_t * disp, const lv_area_t * a1, const lv_area_t * a2);
+static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area_p);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
@@ -49,6 +51,10 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    static bool flush_diff_area(lv_display_t * disp, lv_area_t * area, uint8_t ** px_map);
+    static uint32_t flush_diff_hash(const uint8_t * data, uint32_t size);
+#endif
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out);
 static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
@@ -317,20 +323,25 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_result_t res = lv_display_send_event(disp, LV_EVENT_INVALIDATE_AREA, &com_area);
     if(res != LV_RESULT_OK) return;
 
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    /*Redrawing the whole screen is also the way to restore the content of the panel, so flush all rows*/
+    if(lv_area_is_in(&scr_area, &com_area, 0)) lv_display_flush_diff_reset(disp);
+#endif
+
     /*Save only if this area is not in one of the saved areas*/
     uint16_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    /*Save the area. If there is no place for it join the areas which are the cheapest to join.*/
+    if(disp->inv_p < LV_INV_BUF_SIZE) {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
+    }
+    else {
+        inv_area_join_cheapest(disp, &com_area);
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -432,10 +443,6 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
 refr_finish:
 
-#if LV_DRAW_SW_COMPLEX == 1
-    lv_draw_sw_mask_cleanup();
-#endif
-
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -603,42 +610,96 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the invalidated areas while it makes the refresh cheaper.
+ * Always the pair with the largest saving is joined first.
  */
 static void lv_refr_join_area(void)
 {
     LV_PROFILER_REFR_BEGIN;
-    uint32_t join_from;
-    uint32_t join_in;
-    lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
+    while(1) {
+        int64_t best_cost = 0;
+        uint32_t best_in = 0;
+        uint32_t best_from = 0;
+        uint32_t join_in;
+        uint32_t join_from;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            for(join_from = join_in + 1; join_from < disp_refr->inv_p; join_from++) {
+                if(disp_refr->inv_area_joined[join_from] != 0) continue;
+
+                int64_t cost = join_area_cost(disp_refr, &disp_refr->inv_areas[join_in],
+                                              &disp_refr->inv_areas[join_from]);
+                if(cost < best_cost) {
+                    best_cost = cost;
+                    best_in = join_in;
+                    best_from = join_from;
+                }
             }
+        }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+        /*No joining makes the refresh cheaper*/
+        if(best_cost == 0) break;
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+        lv_area_join(&disp_refr->inv_areas[best_in], &disp_refr->inv_areas[best_in], &disp_refr->inv_areas[best_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+        /*Mark 'best_from' as joined into 'best_in'*/
+        disp_refr->inv_area_joined[best_from] = 1;
+    }
+    LV_PROFILER_REFR_END;
+}
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+/**
+ * Estimate how the cost of the refresh changes if two areas are joined
+ * @param disp      the display whose costs should be used
+ * @param a1        an area
+ * @param a2        another area
+ * @return          negative if refreshing the joined area is cheaper than refreshing the two areas
+ */
+static int64_t join_area_cost(const lv_display_t * disp, const lv_area_t * a1, const lv_area_t * a2)
+{
+    lv_area_t joined_area;
+    lv_area_join(&joined_area, a1, a2);
+
+    int64_t extra_px = (int64_t)lv_area_get_size(&joined_area) - lv_area_get_size(a1) - lv_area_get_size(a2);
+    return extra_px * disp->refr_px_cost - disp->refr_area_cost;
+}
+
+/**
+ * Save a new invalidated area when the buffer of the invalidated areas is full.
+ * Of the saved areas and the new area the two whose joining increases the cost
+ * of the refresh the least are joined.
+ * @param disp      the display
+ * @param area_p    the new area
+ */
+static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area_p)
+{
+    /*Index `LV_INV_BUF_SIZE` means the new area*/
+    int64_t best_cost = join_area_cost(disp, &disp->inv_areas[0], area_p);
+    uint32_t best_in = 0;
+    uint32_t best_from = LV_INV_BUF_SIZE;
+    uint32_t join_in;
+    uint32_t join_from;
+    for(join_in = 0; join_in < LV_INV_BUF_SIZE; join_in++) {
+        for(join_from = join_in + 1; join_from <= LV_INV_BUF_SIZE; join_from++) {
+            const lv_area_t * from_p = join_from == LV_INV_BUF_SIZE ? area_p : &disp->inv_areas[join_from];
+            int64_t cost = join_area_cost(disp, &disp->inv_areas[join_in], from_p);
+            if(cost < best_cost) {
+                best_cost = cost;
+                best_in = join_in;
+                best_from = join_from;
             }
         }
     }
-    LV_PROFILER_REFR_END;
+
+    if(best_from == LV_INV_BUF_SIZE) {
+        lv_area_join(&disp->inv_areas[best_in], &disp->inv_areas[best_in], area_p);
+        return;
+    }
+
+    /*Join two saved areas and store the new area in the freed place*/
+    lv_area_join(&disp->inv_areas[best_in], &disp->inv_areas[best_in], &disp->inv_areas[best_from]);
+    disp->inv_areas[best_from] = *area_p;
 }
 
 /**
@@ -1367,6 +1428,17 @@ static void draw_buf_flush(lv_display_t * disp)
         lv_draw_dispatch();
     }
 
+    lv_area_t flush_area = disp->refreshed_area;
+    uint8_t * px_map = layer->draw_buf->data;
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    if(!flush_diff_area(disp, &flush_area, &px_map)) {
+        /*Nothing has changed so the same buffer can be used for the next area*/
+        LV_TRACE_REFR("Skipping flush of the unchanged (%d;%d)(%d;%d) area",
+                      (int)flush_area.x1, (int)flush_area.y1, (int)flush_area.x2, (int)flush_area.y2);
+        return;
+    }
+#endif
+
     /* In double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer.
      * If we need to wait here it means that the content of one buffer is being sent to display
@@ -1383,7 +1455,7 @@ static void draw_buf_flush(lv_display_t * disp)
     bool flushing_last = disp->flushing_last;
 
     if(disp->flush_cb) {
-        call_flush_cb(disp, &disp->refreshed_area, layer->draw_buf->data);
+        call_flush_cb(disp, &flush_area, px_map);
     }
     /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
     if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
@@ -1425,6 +1497,98 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
     LV_PROFILER_REFR_END;
 }
 
+#if LV_USE_DISPLAY_FLUSH_DIFF
+/**
+ * Compare the rows of a rendered area with the last flushed content of the display
+ * and shrink the area to the changed rows.
+ * @param disp      the display being refreshed
+ * @param area      the rendered area. Shrunk to the first and last changed rows.
+ * @param px_map    the rendered pixels. Moved to the first changed row.
+ * @return          true: `area` needs to be flushed; false: nothing has changed
+ */
+static bool flush_diff_area(lv_display_t * disp, lv_area_t * area, uint8_t ** px_map)
+{
+    if(!disp->flush_diff || disp->render_mode != LV_DISPLAY_RENDER_MODE_PARTIAL) return true;
+
+    /*Skip the formats having a palette before the pixels or multiple pixels in a byte*/
+    lv_draw_buf_t * draw_buf = disp->layer_head->draw_buf;
+    lv_color_format_t cf = draw_buf->header.cf;
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf) || lv_color_format_get_bpp(cf) < 8) return true;
+
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    if(disp->flush_diff_row_cnt != (uint32_t)ver_res) {
+        lv_free(disp->flush_diff_rows);
+        disp->flush_diff_row_cnt = 0;
+        disp->flush_diff_rows = lv_malloc(ver_res * sizeof(lv_display_flush_diff_row_t));
+        LV_ASSERT_MALLOC(disp->flush_diff_rows);
+        if(disp->flush_diff_rows == NULL) return true;
+        disp->flush_diff_row_cnt = ver_res;
+
+        /*The content is unknown*/
+        lv_display_flush_diff_reset(disp);
+    }
+
+    LV_PROFILER_REFR_BEGIN;
+    uint32_t row_size = lv_area_get_width(area) * lv_color_format_get_size(cf);
+    uint32_t stride = draw_buf->header.stride;
+    const uint8_t * row_px = *px_map;
+    int32_t changed_y1 = LV_COORD_MAX;
+    int32_t changed_y2 = LV_COORD_MIN;
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        uint32_t hash = flush_diff_hash(row_px, row_size);
+        row_px += stride;
+
+        if(y >= 0 && y < ver_res) {
+            lv_display_flush_diff_row_t * row = &disp->flush_diff_rows[y];
+            if(row->x1 == area->x1 && row->x2 == area->x2 && row->hash == hash) continue;
+
+            row->x1 = area->x1;
+            row->x2 = area->x2;
+            row->hash = hash;
+        }
+
+        if(changed_y1 == LV_COORD_MAX) changed_y1 = y;
+        changed_y2 = y;
+    }
+    LV_PROFILER_REFR_END;
+
+    if(changed_y1 == LV_COORD_MAX) {
+        /*The driver might do something on the last flush of a refresh (e.g. swap buffers), so flush at least a row*/
+        if(!disp->last_area || !disp->last_part) return false;
+        changed_y1 = area->y1;
+        changed_y2 = area->y1;
+    }
+
+    *px_map += (changed_y1 - area->y1) * stride;
+    area->y1 = changed_y1;
+    area->y2 = changed_y2;
+    return true;
+}
+
+static uint32_t flush_diff_hash(const uint8_t * data, uint32_t size)
+{
+    /*Rotate, xor and multiply with a large odd number. Each step is reversible,
+     *so a single changed word or byte always results in a different hash.*/
+    uint32_t hash = 0;
+    if(((lv_uintptr_t)data & 0x3) == 0) {
+        const uint32_t * data32 = (const uint32_t *)data;
+        for(; size >= 4; size -= 4) {
+            hash = (((hash << 5) | (hash >> 27)) ^ *data32) * 0x9E3779B1;
+            data32++;
+        }
+        data = (const uint8_t *)data32;
+    }
+
+    for(; size > 0; size--) {
+        hash = (((hash << 5) | (hash >> 27)) ^ *data) * 0x9E3779B1;
+        data++;
+    }
+
+    return hash;
+}
+#endif /*LV_USE_DISPLAY_FLUSH_DIFF*/
+
 static void wait_for_flushing(lv_display_t * disp)
 {
     LV_PROFILER_REFR_BEGIN;
@@ -97,6 +97,8 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->layer_head->color_format = disp->color_format;
 
     disp->inv_en_cnt = 1;
+    disp->refr_px_cost = 1;
+    disp->refr_area_cost = 0;
     disp->last_activity_time = lv_tick_get();
 
     lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
@@ -214,6 +216,9 @@ void lv_display_delete(lv_display_t * disp)
     }
 
     lv_ll_clear(&disp->sync_areas);
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    lv_free(disp->flush_diff_rows);
+#endif
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -449,6 +454,10 @@ void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_d
     disp->buf_act = disp->buf_1;
 
     disp->stride_is_auto = 0;
+
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    lv_display_flush_diff_reset(disp);
+#endif
 }
 
 void lv_display_set_3rd_draw_buffer(lv_display_t * disp, lv_draw_buf_t * buf3)
@@ -591,6 +600,41 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+#if LV_USE_DISPLAY_FLUSH_DIFF
+
+void lv_display_set_flush_diff(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->flush_diff = en;
+
+    /*Allocated again on the next flush if enabled*/
+    lv_free(disp->flush_diff_rows);
+    disp->flush_diff_rows = NULL;
+    disp->flush_diff_row_cnt = 0;
+}
+
+bool lv_display_get_flush_diff(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->flush_diff;
+}
+
+void lv_display_flush_diff_reset(lv_display_t * disp)
+{
+    /*Make sure no rows match. The rows are allocated again on the next flush only if the resolution has changed.*/
+    uint32_t y;
+    for(y = 0; y < disp->flush_diff_row_cnt; y++) {
+        disp->flush_diff_rows[y].x1 = 0;
+        disp->flush_diff_rows[y].x2 = -1;
+    }
+}
+
+#endif /*LV_USE_DISPLAY_FLUSH_DIFF*/
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     LV_LOG_WARN("Disabling anti-aliasing is not supported since v9. This function will be removed.");
@@ -938,6 +982,11 @@ void lv_display_set_rotation(lv_display_t * disp, lv_display_rotation_t rotation
 
     disp->rotation = rotation;
     update_resolution(disp);
+
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    /*The rows are at other places of the panel now*/
+    lv_display_flush_diff_reset(disp);
+#endif
 }
 
 lv_display_rotation_t lv_display_get_rotation(lv_display_t * disp)
@@ -1046,6 +1095,31 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp)
     return (disp->inv_en_cnt > 0);
 }
 
+void lv_display_set_refr_cost(lv_display_t * disp, uint32_t px_cost, uint32_t area_cost)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    disp->refr_px_cost = px_cost;
+    disp->refr_area_cost = area_cost;
+}
+
+uint32_t lv_display_get_refr_px_cost(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->refr_px_cost;
+}
+
+uint32_t lv_display_get_refr_area_cost(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->refr_area_cost;
+}
+
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
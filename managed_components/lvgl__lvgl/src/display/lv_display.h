@@ -357,6 +357,32 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+#if LV_USE_DISPLAY_FLUSH_DIFF
+
+/**
+ * Compare the rendered areas with the previously flushed content and call `flush_cb`
+ * only with the changed rows. If nothing has changed `flush_cb` is not called at all,
+ * except for the last area of a refresh, in which case a single row is flushed.
+ * Works only with `LV_DISPLAY_RENDER_MODE_PARTIAL`.
+ * The previous content is forgotten when the whole screen is invalidated, the rotation or the buffers are set.
+ * So if the content of the display is changed without LVGL (e.g. the panel was reset)
+ * invalidate the whole screen.
+ * The rows are compared by a 32 bit hash, so a changed row is skipped if its hash happens
+ * to be the same as before. It's unlikely (about 1 in 4 billion per row), but not impossible.
+ * @param disp      pointer to a display
+ * @param en        true: enable; false: disable
+ */
+void lv_display_set_flush_diff(lv_display_t * disp, bool en);
+
+/**
+ * Get if only the changed rows are flushed
+ * @param disp      pointer to a display
+ * @return          true: enabled; false: disabled
+ */
+bool lv_display_get_flush_diff(lv_display_t * disp);
+
+#endif /*LV_USE_DISPLAY_FLUSH_DIFF*/
+
 /**
  * Disabling anti-aliasing is not supported since v9. This function will be removed.
  * Enable anti-aliasing for the render engine
@@ -595,6 +621,32 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en);
  */
 bool lv_display_is_invalidation_enabled(lv_display_t * disp);
 
+/**
+ * Set the estimated cost of refreshing the invalidated areas.
+ * Two invalidated areas are joined if refreshing their bounding box is cheaper
+ * than refreshing them separately, i.e. if the cost of the extra pixels is less than `area_cost`.
+ * By default `px_cost` is 1 and `area_cost` is 0, so only overlapping areas are joined.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param px_cost   cost of rendering and flushing a pixel
+ * @param area_cost fixed cost of rendering and flushing an area in the same unit,
+ *                  e.g. the overhead of starting a flush
+ */
+void lv_display_set_refr_cost(lv_display_t * disp, uint32_t px_cost, uint32_t area_cost);
+
+/**
+ * Get the estimated cost of refreshing a pixel
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the cost of a pixel set by `lv_display_set_refr_cost`
+ */
+uint32_t lv_display_get_refr_px_cost(lv_display_t * disp);
+
+/**
+ * Get the estimated fixed cost of refreshing an area
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the cost of an area set by `lv_display_set_refr_cost`
+ */
+uint32_t lv_display_get_refr_area_cost(lv_display_t * disp);
+
 /**
  * Get a pointer to the screen refresher timer to
  * modify its parameters with `lv_timer_...` functions.
@@ -33,6 +33,15 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_DISPLAY_FLUSH_DIFF
+/** The last flushed content of a row of the display*/
+typedef struct {
+    int32_t x1;     /**< First flushed column*/
+    int32_t x2;     /**< Last flushed column*/
+    uint32_t hash;  /**< Hash of the pixels between `x1` and `x2`*/
+} lv_display_flush_diff_row_t;
+#endif
+
 struct _lv_display_t {
 
     /*---------------------
@@ -107,9 +116,21 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+    /** Estimated cost of refreshing a pixel and the fixed cost of refreshing an area.
+     * Used to decide which invalidated areas to join.*/
+    uint32_t refr_px_cost;
+    uint32_t refr_area_cost;
+
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
+#if LV_USE_DISPLAY_FLUSH_DIFF
+    /** The last flushed content of each row. Allocated on the first flush if `flush_diff` is enabled*/
+    lv_display_flush_diff_row_t * flush_diff_rows;
+    uint32_t flush_diff_row_cnt;
+    uint32_t flush_diff : 1;  /**< 1: flush only the changed rows of the rendered areas*/
+#endif
+
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
     /*---------------------
@@ -177,6 +198,14 @@ struct _lv_display_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_DISPLAY_FLUSH_DIFF
+/**
+ * Forget the last flushed content of the rows, so that all rows are flushed on the next refresh.
+ * @param disp      pointer to a display
+ */
+void lv_display_flush_diff_reset(lv_display_t * disp);
+#endif
+
 /**********************
  *      MACROS
  **********************/
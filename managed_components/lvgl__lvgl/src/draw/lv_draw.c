@@ -28,14 +28,60 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*Build the task index of a layer only if at least this many older draw tasks needed to be checked*/
+#define TASK_INDEX_MIN_TASK_CNT     32
+#define TASK_INDEX_MAX_BINS         16      /*Max. number of bins in a row or column of the task index*/
+#define TASK_INDEX_MIN_BIN_SIZE     32      /*Min. width and height of a bin in pixels*/
+#define TASK_INDEX_NODES_PER_BLOCK  64
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*An entry of a draw task in a bin. A draw task has an entry in every bin it overlaps*/
+typedef struct _task_index_node_t {
+    lv_draw_task_t * task;
+    struct _task_index_node_t * next;
+} task_index_node_t;
+
+typedef struct {
+    task_index_node_t * head;
+    task_index_node_t * tail;
+} task_index_bin_t;
+
+typedef struct _task_index_block_t {
+    struct _task_index_block_t * next;
+    task_index_node_t nodes[TASK_INDEX_NODES_PER_BLOCK];
+} task_index_block_t;
+
+/**
+ * Grid of bins over a layer. Each bin lists the draw tasks overlapping it ordered by their creation,
+ * so to tell if a draw task is independent only the older draw tasks around it need to be checked.
+ */
+struct _lv_draw_task_index_t {
+    lv_area_t area;                     /**< Covered by the bins. Draw tasks outside go to the bins on the edges.*/
+    int32_t bin_w;
+    int32_t bin_h;
+    uint32_t col_cnt;
+    uint32_t row_cnt;
+    uint32_t seq_next;                  /**< `index_seq` of the next added draw task*/
+    task_index_node_t * free_nodes;
+    task_index_block_t * blocks;
+    task_index_bin_t * bins;
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id);
+static bool is_independent_indexed(lv_draw_task_index_t * index, lv_draw_task_t * t_check, uint8_t draw_unit_id);
+static lv_draw_task_index_t * task_index_create(lv_layer_t * layer);
+static void task_index_delete(lv_layer_t * layer);
+static bool task_index_add(lv_draw_task_index_t * index, lv_draw_task_t * t);
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t);
+static void task_index_update(lv_layer_t * layer, lv_draw_task_t * t);
+static void task_index_get_bins(const lv_draw_task_index_t * index, const lv_area_t * area,
+                                uint32_t * col1, uint32_t * row1, uint32_t * col2, uint32_t * row2);
 static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
 static inline size_t get_draw_dsc_size(lv_draw_task_type_t type);
 static lv_draw_task_t * get_first_available_task(lv_layer_t * layer);
@@ -81,6 +127,8 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+    lv_draw_task_pool_deinit();
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -102,8 +150,10 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
-    lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    size_t task_size = LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size;
+    lv_draw_task_t * new_task = lv_draw_task_pool_alloc(layer, task_size);
     LV_ASSERT_MALLOC(new_task);
+    lv_memzero(new_task, task_size);
     new_task->area = *coords;
     new_task->_real_area = *coords;
     new_task->target_layer = layer;
@@ -127,6 +177,11 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
         tail->next = new_task;
     }
 
+    if(layer->task_index) {
+        new_task->index_seq = layer->task_index->seq_next++;
+        if(!task_index_add(layer->task_index, new_task)) task_index_delete(layer);
+    }
+
     LV_PROFILER_DRAW_END;
     return new_task;
 }
@@ -165,6 +220,10 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             }
             u = u->next;
         }
+
+        /*The area might be changed since the draw task was added*/
+        task_index_update(layer, t);
+
         if(t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE) {
             LV_LOG_WARN("the draw task was not taken by any units");
             t->state = LV_DRAW_TASK_STATE_FINISHED;
@@ -188,6 +247,8 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             }
             u = u->next;
         }
+
+        task_index_update(layer, t);
     }
     LV_PROFILER_DRAW_END;
 }
@@ -255,6 +316,11 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+    if(layer->draw_task_head == NULL) {
+        if(layer->task_index) task_index_delete(layer);
+        lv_draw_task_pool_reset(layer);
+    }
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -551,10 +617,29 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t draw_unit_id)
 {
     LV_PROFILER_DRAW_BEGIN;
+
+    if(layer->task_index) {
+        bool res = is_independent_indexed(layer->task_index, t_check, draw_unit_id);
+        LV_PROFILER_DRAW_END;
+        return res;
+    }
+
     lv_draw_task_t * t = layer->draw_task_head;
+    uint32_t checked_cnt = 0;
 
     /*If t_check is outside of the older tasks then it's independent*/
     while(t && t != t_check) {
+        /*There are many draw tasks, index them to not walk the whole list for every draw task*/
+        if(checked_cnt == TASK_INDEX_MIN_TASK_CNT) {
+            layer->task_index = task_index_create(layer);
+            if(layer->task_index) {
+                bool res = is_independent_indexed(layer->task_index, t_check, draw_unit_id);
+                LV_PROFILER_DRAW_END;
+                return res;
+            }
+        }
+        checked_cnt++;
+
         /*It's independent of finished draw tasks, and queued draw tasks of the same draw unit,
          *so no need to check it*/
         if(t->state == LV_DRAW_TASK_STATE_FINISHED ||
@@ -575,6 +660,240 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check, uint8_t
     return true;
 }
 
+/**
+ * Same as `is_independent()` but check only the older draw tasks in the bins overlapped by `t_check`
+ * @param index         the task index of the layer of `t_check`
+ * @param t_check       check this task if it overlaps with the older ones
+ * @param draw_unit_id  draw unit ID for which the independence check is called
+ * @return              true: `t_check` is not overlapping with older tasks so it's independent
+ */
+static bool is_independent_indexed(lv_draw_task_index_t * index, lv_draw_task_t * t_check, uint8_t draw_unit_id)
+{
+    uint32_t col1, row1, col2, row2;
+    task_index_get_bins(index, &t_check->_real_area, &col1, &row1, &col2, &row2);
+
+    uint32_t row;
+    uint32_t col;
+    for(row = row1; row <= row2; row++) {
+        for(col = col1; col <= col2; col++) {
+            task_index_node_t * node = index->bins[row * index->col_cnt + col].head;
+            /*The bins are ordered by creation so stop at the first not older draw task*/
+            while(node && node->task->index_seq < t_check->index_seq) {
+                lv_draw_task_t * t = node->task;
+                node = node->next;
+
+                if(t->state == LV_DRAW_TASK_STATE_FINISHED ||
+                   (t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == draw_unit_id)) {
+                    continue;
+                }
+
+                lv_area_t a;
+                if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Create a task index for a layer and add its current draw tasks to it
+ * @param layer     pointer to a layer
+ * @return          the new task index or NULL on error
+ */
+static lv_draw_task_index_t * task_index_create(lv_layer_t * layer)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    int32_t w = lv_area_get_width(&layer->buf_area);
+    int32_t h = lv_area_get_height(&layer->buf_area);
+    uint32_t col_cnt = LV_CLAMP(1, (w + TASK_INDEX_MIN_BIN_SIZE - 1) / TASK_INDEX_MIN_BIN_SIZE, TASK_INDEX_MAX_BINS);
+    uint32_t row_cnt = LV_CLAMP(1, (h + TASK_INDEX_MIN_BIN_SIZE - 1) / TASK_INDEX_MIN_BIN_SIZE, TASK_INDEX_MAX_BINS);
+
+    lv_draw_task_index_t * index = lv_malloc_zeroed(sizeof(lv_draw_task_index_t) +
+                                                    col_cnt * row_cnt * sizeof(task_index_bin_t));
+    if(index == NULL) {
+        LV_PROFILER_DRAW_END;
+        return NULL;
+    }
+
+    index->area = layer->buf_area;
+    index->col_cnt = col_cnt;
+    index->row_cnt = row_cnt;
+    index->bin_w = LV_MAX((w + (int32_t)col_cnt - 1) / (int32_t)col_cnt, 1);
+    index->bin_h = LV_MAX((h + (int32_t)row_cnt - 1) / (int32_t)row_cnt, 1);
+    index->bins = (task_index_bin_t *)(index + 1);
+
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        t->index_seq = index->seq_next++;
+        if(!task_index_add(index, t)) {
+            layer->task_index = index;
+            task_index_delete(layer);
+            LV_PROFILER_DRAW_END;
+            return NULL;
+        }
+        t = t->next;
+    }
+
+    LV_PROFILER_DRAW_END;
+    return index;
+}
+
+/**
+ * Free the task index of a layer
+ * @param layer     pointer to a layer with a task index
+ */
+static void task_index_delete(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = layer->task_index;
+    task_index_block_t * block = index->blocks;
+    while(block) {
+        task_index_block_t * block_next = block->next;
+        lv_free(block);
+        block = block_next;
+    }
+
+    lv_free(index);
+    layer->task_index = NULL;
+}
+
+/**
+ * Add a draw task to the bins overlapped by its `_real_area`. `index_seq` needs to be set already.
+ * @param index     pointer to a task index
+ * @param t         the draw task to add
+ * @return          false: out of memory, the task index can't be used anymore
+ */
+static bool task_index_add(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    uint32_t col1, row1, col2, row2;
+    task_index_get_bins(index, &t->_real_area, &col1, &row1, &col2, &row2);
+    t->index_col1 = (uint8_t)col1;
+    t->index_row1 = (uint8_t)row1;
+    t->index_col2 = (uint8_t)col2;
+    t->index_row2 = (uint8_t)row2;
+
+    uint32_t row;
+    uint32_t col;
+    for(row = row1; row <= row2; row++) {
+        for(col = col1; col <= col2; col++) {
+            if(index->free_nodes == NULL) {
+                task_index_block_t * block = lv_malloc(sizeof(task_index_block_t));
+                if(block == NULL) return false;
+                block->next = index->blocks;
+                index->blocks = block;
+
+                uint32_t i;
+                for(i = 0; i < TASK_INDEX_NODES_PER_BLOCK - 1; i++) {
+                    block->nodes[i].next = &block->nodes[i + 1];
+                }
+                block->nodes[TASK_INDEX_NODES_PER_BLOCK - 1].next = NULL;
+                index->free_nodes = &block->nodes[0];
+            }
+
+            task_index_node_t * node = index->free_nodes;
+            index->free_nodes = node->next;
+            node->task = t;
+
+            /*Usually the newest draw task is added so append it*/
+            task_index_bin_t * bin = &index->bins[row * index->col_cnt + col];
+            if(bin->tail == NULL) {
+                node->next = NULL;
+                bin->head = node;
+                bin->tail = node;
+            }
+            else if(bin->tail->task->index_seq < t->index_seq) {
+                node->next = NULL;
+                bin->tail->next = node;
+                bin->tail = node;
+            }
+            else {
+                task_index_node_t * prev = NULL;
+                task_index_node_t * next = bin->head;
+                while(next->task->index_seq < t->index_seq) {
+                    prev = next;
+                    next = next->next;
+                }
+                node->next = next;
+                if(prev) prev->next = node;
+                else bin->head = node;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Remove a draw task from the bins where it was added
+ * @param index     pointer to a task index
+ * @param t         the draw task to remove
+ */
+static void task_index_remove(lv_draw_task_index_t * index, lv_draw_task_t * t)
+{
+    uint32_t row;
+    uint32_t col;
+    for(row = t->index_row1; row <= t->index_row2; row++) {
+        for(col = t->index_col1; col <= t->index_col2; col++) {
+            /*Usually the oldest draw tasks are removed so they are at the beginning*/
+            task_index_bin_t * bin = &index->bins[row * index->col_cnt + col];
+            task_index_node_t * prev = NULL;
+            task_index_node_t * node = bin->head;
+            while(node && node->task != t) {
+                prev = node;
+                node = node->next;
+            }
+            if(node == NULL) continue;
+
+            if(prev) prev->next = node->next;
+            else bin->head = node->next;
+            if(bin->tail == node) bin->tail = prev;
+
+            node->next = index->free_nodes;
+            index->free_nodes = node;
+        }
+    }
+}
+
+/**
+ * Move a draw task to other bins if its `_real_area` has changed
+ * @param layer     the layer of the draw task
+ * @param t         pointer to a draw task
+ */
+static void task_index_update(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    if(layer->task_index == NULL) return;
+
+    uint32_t col1, row1, col2, row2;
+    task_index_get_bins(layer->task_index, &t->_real_area, &col1, &row1, &col2, &row2);
+    if(col1 == t->index_col1 && row1 == t->index_row1 && col2 == t->index_col2 && row2 == t->index_row2) return;
+
+    task_index_remove(layer->task_index, t);
+    if(!task_index_add(layer->task_index, t)) task_index_delete(layer);
+}
+
+/**
+ * Get the range of bins overlapped by an area. Areas outside of the index are clamped to the edge bins.
+ * @param index     pointer to a task index
+ * @param area      the area to check
+ * @param col1      store the first column here
+ * @param row1      store the first row here
+ * @param col2      store the last column here
+ * @param row2      store the last row here
+ */
+static void task_index_get_bins(const lv_draw_task_index_t * index, const lv_area_t * area,
+                                uint32_t * col1, uint32_t * row1, uint32_t * col2, uint32_t * row2)
+{
+    const lv_area_t * ia = &index->area;
+    *col1 = (LV_CLAMP(ia->x1, area->x1, ia->x2) - ia->x1) / index->bin_w;
+    *col2 = (LV_CLAMP(ia->x1, area->x2, ia->x2) - ia->x1) / index->bin_w;
+    *row1 = (LV_CLAMP(ia->y1, area->y1, ia->y2) - ia->y1) / index->bin_h;
+    *row2 = (LV_CLAMP(ia->y1, area->y2, ia->y2) - ia->y1) / index->bin_h;
+
+    /*Due to rounding the last bin might be smaller*/
+    if(*col2 >= index->col_cnt) *col2 = index->col_cnt - 1;
+    if(*row2 >= index->row_cnt) *row2 = index->row_cnt - 1;
+}
+
 /**
  * Get the size of the draw descriptor of a draw task
  * @param type      type of the draw task
@@ -672,16 +991,20 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 disp->layer_deinit(disp, layer_drawn);
                 LV_PROFILER_DRAW_END_TAG("layer_deinit");
             }
+            if(layer_drawn->task_index) task_index_delete(layer_drawn);
+            lv_draw_task_pool_reset(layer_drawn);
             lv_free(layer_drawn);
         }
     }
+    if(t->target_layer && t->target_layer->task_index) task_index_remove(t->target_layer->task_index, t);
+
     lv_draw_label_dsc_t * draw_label_dsc = lv_draw_task_get_label_dsc(t);
     if(draw_label_dsc && draw_label_dsc->text_local) {
         lv_free((void *)draw_label_dsc->text);
         draw_label_dsc->text = NULL;
     }
 
-    lv_free(t);
+    lv_draw_task_pool_free(t);
     LV_PROFILER_DRAW_END;
 }
 
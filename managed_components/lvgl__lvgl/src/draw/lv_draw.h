@@ -99,6 +99,14 @@ struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** Spatial index of the draw tasks to quickly find the independent ones.
+     *  Created on demand and freed when all draw tasks are finished.*/
+    lv_draw_task_index_t * task_index;
+
+    /** The chunk of memory where the draw tasks of this layer are allocated from.
+     *  Released when all draw tasks are finished.*/
+    lv_draw_task_pool_chunk_t * task_pool_chunk;
+
     /** Parent layer */
     lv_layer_t * parent;
 
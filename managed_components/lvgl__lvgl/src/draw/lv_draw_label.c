@@ -110,6 +110,16 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_layer_t * layer, const lv_draw_label
     LV_PROFILER_DRAW_BEGIN;
     lv_draw_task_t * t = lv_draw_add_task(layer, coords, LV_DRAW_TASK_TYPE_LABEL);
 
+#if LV_DRAW_SW_DRAW_UNIT_CNT > 1
+    /*The lines are not wrapped so they can be wider than `coords` and are drawn until the edges of the clip area.
+     *Other draw units shouldn't render the overlapping draw tasks there at the same time.
+     *With a single draw unit the tasks are rendered one by one so it's not required.*/
+    if(dsc->flag & LV_TEXT_FLAG_EXPAND) {
+        t->_real_area.x1 = LV_MIN(t->_real_area.x1, t->clip_area.x1);
+        t->_real_area.x2 = LV_MAX(t->_real_area.x2, t->clip_area.x2);
+    }
+#endif
+
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
 
     /*The text is stored in a local variable so malloc memory for it*/
@@ -621,27 +631,12 @@ void lv_draw_unit_draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  co
     }
 
     if(g.resolved_font) {
-        lv_draw_buf_t * draw_buf = NULL;
-        if(LV_FONT_GLYPH_FORMAT_NONE < g.format && g.format < LV_FONT_GLYPH_FORMAT_IMAGE) {
-            /*Only check draw buf for bitmap glyph*/
-            draw_buf = lv_draw_buf_reshape(dsc->_draw_buf, 0, g.box_w, g.box_h, LV_STRIDE_AUTO);
-            if(draw_buf == NULL) {
-                if(dsc->_draw_buf) lv_draw_buf_destroy(dsc->_draw_buf);
-
-                uint32_t h = LV_ROUND_UP(g.box_h, 32); /*Assume a larger size to avoid many reallocations*/
-                draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, g.box_w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
-                LV_ASSERT_MALLOC(draw_buf);
-                draw_buf->header.h = g.box_h;
-                dsc->_draw_buf = draw_buf;
-            }
-        }
-
         dsc->format = g.format;
 
         if(g.format == LV_FONT_GLYPH_FORMAT_VECTOR) {
 
             /*Load the outline of the glyph, even if the function says bitmap*/
-            dsc->glyph_data = (void *) lv_font_get_glyph_bitmap(dsc->g, draw_buf);
+            dsc->glyph_data = (void *) lv_font_get_glyph_bitmap(dsc->g, NULL);
             dsc->format = dsc->glyph_data ? g.format : LV_FONT_GLYPH_FORMAT_NONE;
         }
     }
@@ -661,3 +656,24 @@ exit:
     }
     LV_PROFILER_DRAW_END;
 }
+
+const void * lv_draw_glyph_get_bitmap(lv_draw_glyph_dsc_t * dsc)
+{
+    lv_font_glyph_dsc_t * g = dsc->g;
+    lv_draw_buf_t * draw_buf = NULL;
+    if(LV_FONT_GLYPH_FORMAT_NONE < g->format && g->format < LV_FONT_GLYPH_FORMAT_IMAGE) {
+        /*Only check draw buf for bitmap glyph*/
+        draw_buf = lv_draw_buf_reshape(dsc->_draw_buf, 0, g->box_w, g->box_h, LV_STRIDE_AUTO);
+        if(draw_buf == NULL) {
+            if(dsc->_draw_buf) lv_draw_buf_destroy(dsc->_draw_buf);
+
+            uint32_t h = LV_ROUND_UP(g->box_h, 32); /*Assume a larger size to avoid many reallocations*/
+            draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, g->box_w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+            LV_ASSERT_MALLOC(draw_buf);
+            draw_buf->header.h = g->box_h;
+            dsc->_draw_buf = draw_buf;
+        }
+    }
+
+    return lv_font_get_glyph_bitmap(g, draw_buf);
+}
@@ -237,6 +237,15 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 void lv_draw_unit_draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                               const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
 
+/**
+ * Get the bitmap of the glyph being drawn in a `lv_draw_glyph_cb_t`.
+ * If the glyph needs to be converted to A8, the draw buffer for it is allocated here,
+ * so it's not allocated at all for glyphs which are drawn without calling this function.
+ * @param dsc           pointer to the glyph draw descriptor passed to the callback
+ * @return              the glyph's bitmap (e.g. a draw buffer) or NULL on error
+ */
+const void * lv_draw_glyph_get_bitmap(lv_draw_glyph_dsc_t * dsc);
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
@@ -84,6 +84,14 @@ struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /** Creation order in the task index of the layer. Smaller value means older draw task.*/
+    uint32_t index_seq;
+
+    /** The first and last column and row of the bins of the task index containing this draw task*/
+    uint8_t index_col1;
+    uint8_t index_row1;
+    uint8_t index_col2;
+    uint8_t index_row2;
 };
 
 struct _lv_draw_mask_t {
@@ -191,14 +199,46 @@ typedef struct {
 #else
     volatile int dispatch_req;
 #endif
-    lv_mutex_t circle_cache_mutex;
     bool task_running;
+
+    lv_draw_task_pool_chunk_t * task_pool_free_chunks;  /**< Cached chunks for the draw task pools*/
+    uint32_t task_pool_free_chunk_cnt;
+    size_t task_pool_size;  /**< Size of all draw task pool chunks in bytes*/
+    size_t task_pool_used;  /**< Bytes allocated for not yet freed draw tasks and descriptors*/
 } lv_draw_global_info_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Allocate memory for a draw task or its data from the layer's draw task pool.
+ * The memory is 8 byte aligned and stays valid until `lv_draw_task_pool_free` is called on it.
+ * @param layer     the layer whose draw task will use the memory
+ * @param size      number of bytes to allocate
+ * @return          pointer to the allocated memory or NULL on error
+ */
+void * lv_draw_task_pool_alloc(lv_layer_t * layer, size_t size);
+
+/**
+ * Free a memory allocated by `lv_draw_task_pool_alloc`.
+ * The pool's chunk is reset or released when all allocations in it are freed.
+ * @param p         pointer to the memory to free
+ */
+void lv_draw_task_pool_free(void * p);
+
+/**
+ * Release the current chunk of a layer's draw task pool.
+ * Called when all draw tasks of the layer are finished.
+ * @param layer     pointer to a layer
+ */
+void lv_draw_task_pool_reset(lv_layer_t * layer);
+
+/**
+ * Free the cached chunks of the draw task pools.
+ */
+void lv_draw_task_pool_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,188 @@
+/**
+ * @file lv_draw_task_pool.c
+ *
+ * Draw tasks are created and freed in large numbers in every refresh.
+ * Instead of using the heap for each of them they are allocated from larger chunks
+ * by bumping a pointer. A chunk is reused as soon as all of its allocations are freed.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_private.h"
+#include "../misc/lv_assert.h"
+#include "../core/lv_global.h"
+#include "../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+
+#define CHUNK_HEADER_SIZE   LV_ALIGN_UP(sizeof(lv_draw_task_pool_chunk_t), 8)
+#define ALLOC_HEADER_SIZE   LV_ALIGN_UP(sizeof(alloc_header_t), 8)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_draw_task_pool_chunk_t {
+    /** The layer using this chunk to allocate from or NULL if it's not used for new allocations*/
+    lv_layer_t * layer;
+
+    /** Next chunk in the list of cached chunks*/
+    lv_draw_task_pool_chunk_t * next_free;
+
+    uint32_t size;      /**< Size of the chunk including the header*/
+    uint32_t used;      /**< Bytes already allocated including the header*/
+    uint32_t alloc_cnt; /**< Number of allocations not freed yet*/
+};
+
+typedef struct {
+    lv_draw_task_pool_chunk_t * chunk;
+    size_t size;
+} alloc_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_draw_task_pool_chunk_t * chunk_create(uint32_t size);
+static void chunk_release(lv_draw_task_pool_chunk_t * chunk);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void * lv_draw_task_pool_alloc(lv_layer_t * layer, size_t size)
+{
+    LV_ASSERT_NULL(layer);
+
+    uint32_t alloc_size = ALLOC_HEADER_SIZE + LV_ALIGN_UP(size, 8);
+    lv_draw_task_pool_chunk_t * chunk = layer->task_pool_chunk;
+
+    if(chunk == NULL || chunk->size - chunk->used < alloc_size) {
+        if(alloc_size > LV_DRAW_TASK_POOL_CHUNK_SIZE - CHUNK_HEADER_SIZE) {
+            /*Doesn't fit into a normal chunk so allocate a dedicated one*/
+            chunk = chunk_create(CHUNK_HEADER_SIZE + alloc_size);
+            if(chunk == NULL) return NULL;
+        }
+        else {
+            /*The current chunk will be released when its last allocation is freed*/
+            if(chunk) {
+                chunk->layer = NULL;
+                layer->task_pool_chunk = NULL;
+                if(chunk->alloc_cnt == 0) chunk_release(chunk);
+            }
+
+            if(_draw_info.task_pool_free_chunks) {
+                chunk = _draw_info.task_pool_free_chunks;
+                _draw_info.task_pool_free_chunks = chunk->next_free;
+                _draw_info.task_pool_free_chunk_cnt--;
+                chunk->next_free = NULL;
+            }
+            else {
+                chunk = chunk_create(LV_DRAW_TASK_POOL_CHUNK_SIZE);
+                if(chunk == NULL) return NULL;
+            }
+
+            chunk->layer = layer;
+            layer->task_pool_chunk = chunk;
+        }
+    }
+
+    alloc_header_t * header = (alloc_header_t *)((uint8_t *)chunk + chunk->used);
+    header->chunk = chunk;
+    header->size = alloc_size;
+    chunk->used += alloc_size;
+    chunk->alloc_cnt++;
+    _draw_info.task_pool_used += alloc_size;
+
+    return (uint8_t *)header + ALLOC_HEADER_SIZE;
+}
+
+void lv_draw_task_pool_free(void * p)
+{
+    if(p == NULL) return;
+
+    alloc_header_t * header = (alloc_header_t *)((uint8_t *)p - ALLOC_HEADER_SIZE);
+    lv_draw_task_pool_chunk_t * chunk = header->chunk;
+    LV_ASSERT(chunk->alloc_cnt > 0);
+
+    _draw_info.task_pool_used -= header->size;
+    chunk->alloc_cnt--;
+    if(chunk->alloc_cnt > 0) return;
+
+    /*Everything is freed in the chunk. If a layer still allocates from it just start from the beginning again.*/
+    if(chunk->layer) chunk->used = CHUNK_HEADER_SIZE;
+    else chunk_release(chunk);
+}
+
+void lv_draw_task_pool_reset(lv_layer_t * layer)
+{
+    lv_draw_task_pool_chunk_t * chunk = layer->task_pool_chunk;
+    if(chunk == NULL) return;
+
+    layer->task_pool_chunk = NULL;
+    chunk->layer = NULL;
+
+    /*Normally all draw tasks are freed at this point. If not, the last free will release the chunk.*/
+    if(chunk->alloc_cnt == 0) chunk_release(chunk);
+}
+
+void lv_draw_task_pool_deinit(void)
+{
+    lv_draw_task_pool_chunk_t * chunk = _draw_info.task_pool_free_chunks;
+    while(chunk) {
+        lv_draw_task_pool_chunk_t * next = chunk->next_free;
+        _draw_info.task_pool_size -= chunk->size;
+        lv_free(chunk);
+        chunk = next;
+    }
+
+    _draw_info.task_pool_free_chunks = NULL;
+    _draw_info.task_pool_free_chunk_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_draw_task_pool_chunk_t * chunk_create(uint32_t size)
+{
+    lv_draw_task_pool_chunk_t * chunk = lv_malloc(size);
+    LV_ASSERT_MALLOC(chunk);
+    if(chunk == NULL) return NULL;
+
+    chunk->layer = NULL;
+    chunk->next_free = NULL;
+    chunk->size = size;
+    chunk->used = CHUNK_HEADER_SIZE;
+    chunk->alloc_cnt = 0;
+
+    _draw_info.task_pool_size += size;
+    return chunk;
+}
+
+static void chunk_release(lv_draw_task_pool_chunk_t * chunk)
+{
+    /*Keep some normal sized chunks for the next draw tasks*/
+    if(chunk->size == LV_DRAW_TASK_POOL_CHUNK_SIZE &&
+       _draw_info.task_pool_free_chunk_cnt < LV_DRAW_TASK_POOL_CACHE_CNT) {
+        chunk->used = CHUNK_HEADER_SIZE;
+        chunk->next_free = _draw_info.task_pool_free_chunks;
+        _draw_info.task_pool_free_chunks = chunk;
+        _draw_info.task_pool_free_chunk_cnt++;
+        return;
+    }
+
+    _draw_info.task_pool_size -= chunk->size;
+    lv_free(chunk);
+}
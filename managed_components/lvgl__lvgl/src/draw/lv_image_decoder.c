@@ -12,6 +12,7 @@
 #include "../misc/lv_ll.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../tick/lv_tick.h"
 
 /*********************
  *      DEFINES
@@ -150,8 +151,13 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
      * If decoder open failed, free the source and return error.
      * If decoder open succeed, add the image to cache if enabled.
      * */
+    dsc->open_start = lv_tick_get();
     lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
 
+    if(res == LV_RESULT_OK && dsc->time_to_open == 0) {
+        dsc->time_to_open = lv_tick_elaps(dsc->open_start);
+    }
+
     if(res == LV_RESULT_OK && dsc->decoded != NULL) {
         LV_ASSERT_MSG(dsc->decoded->unaligned_data && dsc->decoded->handlers, "Invalid draw buffer");
 
@@ -272,6 +278,12 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
     return cache_entry;
 }
 
+uint32_t lv_image_decoder_get_time_to_open(const lv_image_decoder_dsc_t * dsc)
+{
+    if(dsc->time_to_open) return dsc->time_to_open;
+    return lv_tick_elaps(dsc->open_start);
+}
+
 lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded)
 {
     if(decoded == NULL) return NULL; /*No need to adjust*/
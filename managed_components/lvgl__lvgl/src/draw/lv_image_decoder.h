@@ -179,6 +179,15 @@ void lv_image_decoder_set_get_area_cb(lv_image_decoder_t * decoder, lv_image_dec
  */
 void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decoder_close_f_t close_cb);
 
+/**
+ * Add a decoded image to the image cache.
+ * @param decoder       pointer to the image decoder
+ * @param search_key    the source of the image, and its size and cost in `slot`.
+ *                      They are copied to the new entry while the cache is locked.
+ * @param decoded       the decoded image
+ * @param user_data     decoder data to free when the entry is dropped from the cache
+ * @return              the new, acquired cache entry or NULL on error
+ */
 lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data);
@@ -100,9 +100,13 @@ struct _lv_image_decoder_dsc_t {
     uint32_t palette_size;
 
     /** How much time did it take to open the image. [ms]
-     *  If not set `lv_image_cache` will measure and set the time to open*/
+     *  If not set `lv_image_decoder_open` will measure and set the time to open.
+     *  It's the cost of the image in the image cache.*/
     uint32_t time_to_open;
 
+    /** The tick when `lv_image_decoder_open` started to open the image*/
+    uint32_t open_start;
+
     /**A text to display instead of the image when the image can't be opened.
      * Can be set in `open` function or set NULL.*/
     const char * error_msg;
@@ -133,6 +137,15 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void);
 
+/**
+ * Get the time spent on opening an image so far. Decoders set it as `slot.cost` of the
+ * search key passed to `lv_image_decoder_add_to_cache`.
+ * @param dsc   pointer to a decoder descriptor being opened
+ * @return      `time_to_open` if the decoder has set it, else the time elapsed since
+ *              `lv_image_decoder_open` was called [ms]
+ */
+uint32_t lv_image_decoder_get_time_to_open(const lv_image_decoder_dsc_t * dsc);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,47 @@
+/**
+ * @file lv_blend_esp32s3.h
+ *
+ */
+
+#ifndef LV_BLEND_ESP32S3_H
+#define LV_BLEND_ESP32S3_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3
+
+#if !defined(__ASSEMBLY__)
+#include "lv_draw_sw_blend_esp32s3_to_rgb565.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_ESP32S3_H*/
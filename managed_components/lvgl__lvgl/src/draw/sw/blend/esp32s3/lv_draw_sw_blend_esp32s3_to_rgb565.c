@@ -0,0 +1,375 @@
+/**
+ * @file lv_draw_sw_blend_esp32s3_to_rgb565.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_esp32s3_to_rgb565.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3
+
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_types.h"
+#include "../../../../stdlib/lv_string.h"
+#include "../lv_draw_sw_blend_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Number of mask bytes copied to an aligned buffer at once if the mask is not aligned for the kernels*/
+#define MASK_CHUNK  64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride);
+static inline int32_t LV_ATTRIBUTE_FAST_MEM head_px(const uint16_t * dest, int32_t w);
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM mix_to_5bit(uint32_t opa);
+
+static void LV_ATTRIBUTE_FAST_MEM fill_mask_row(uint16_t * dest, int32_t cnt, uint16_t color, const uint8_t * mask,
+                                                uint32_t opa);
+static void LV_ATTRIBUTE_FAST_MEM copy_mask_row(uint16_t * dest, int32_t cnt, const uint16_t * src,
+                                                const uint8_t * mask, uint32_t opa);
+
+static lv_result_t color_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t opa);
+static lv_result_t image_mask_blend(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t opa);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    const int32_t w = dsc->dest_w;
+    const int32_t h = dsc->dest_h;
+    const uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+
+    for(int32_t y = 0; y < h; y++) {
+        const int32_t head = head_px(dest_buf_u16, w);
+        const int32_t cnt = (w - head) >> 3;
+        int32_t x;
+        for(x = 0; x < head; x++) dest_buf_u16[x] = color16;
+        lv_esp32s3_rgb565_fill(&dest_buf_u16[x], cnt, color16);
+        for(x += cnt << 3; x < w; x++) dest_buf_u16[x] = color16;
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    const int32_t w = dsc->dest_w;
+    const int32_t h = dsc->dest_h;
+    const lv_opa_t opa = dsc->opa;
+    const uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+
+    for(int32_t y = 0; y < h; y++) {
+        const int32_t head = head_px(dest_buf_u16, w);
+        const int32_t cnt = (w - head) >> 3;
+        int32_t x;
+        for(x = 0; x < head; x++) dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], opa);
+        lv_esp32s3_rgb565_fill_mix(&dest_buf_u16[x], cnt, color16, mix_to_5bit(opa));
+        for(x += cnt << 3; x < w; x++) dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], opa);
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    return color_mask_blend(dsc, 256);
+}
+
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    return color_mask_blend(dsc, dsc->opa);
+}
+
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    const int32_t w = dsc->dest_w;
+    const int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+
+    /*The kernel reads 16 bit pixels, an odd source address can't be shifted into place*/
+    if((lv_uintptr_t)src_buf_u16 & 0x1) return LV_RESULT_INVALID;
+
+    for(int32_t y = 0; y < h; y++) {
+        const int32_t head = head_px(dest_buf_u16, w);
+        const int32_t cnt = (w - head) >> 3;
+        int32_t x;
+        for(x = 0; x < head; x++) dest_buf_u16[x] = src_buf_u16[x];
+        lv_esp32s3_rgb565_copy(&dest_buf_u16[x], cnt, &src_buf_u16[x]);
+        for(x += cnt << 3; x < w; x++) dest_buf_u16[x] = src_buf_u16[x];
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    const int32_t w = dsc->dest_w;
+    const int32_t h = dsc->dest_h;
+    const lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+
+    if((lv_uintptr_t)src_buf_u16 & 0x1) return LV_RESULT_INVALID;
+
+    for(int32_t y = 0; y < h; y++) {
+        const int32_t head = head_px(dest_buf_u16, w);
+        const int32_t cnt = (w - head) >> 3;
+        int32_t x;
+        for(x = 0; x < head; x++) dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], opa);
+        lv_esp32s3_rgb565_copy_mix(&dest_buf_u16[x], cnt, &src_buf_u16[x], mix_to_5bit(opa));
+        for(x += cnt << 3; x < w; x++) dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], opa);
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    return image_mask_blend(dsc, 256);
+}
+
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    return image_mask_blend(dsc, dsc->opa);
+}
+
+#if !defined(__XTENSA__)
+
+/* Portable model of the PIE kernels in `lv_blend_esp32s3.S`.
+ * It follows the vector code lane by lane so the C fallback paths and the tests
+ * can check the wrappers (alignment, head and tail handling) on any host.*/
+
+static inline uint16_t mix_px(uint16_t f, uint16_t d, int32_t mix)
+{
+    int32_t fb = f & 0x1F;
+    int32_t db = d & 0x1F;
+    int32_t fg = (f >> 5) & 0x3F;
+    int32_t dg = (d >> 5) & 0x3F;
+    int32_t fr = f >> 11;
+    int32_t dr = d >> 11;
+
+    /*Arithmetic shift as `ee.vmul.s16`*/
+    int32_t b = db + (((fb - db) * mix) >> 5);
+    int32_t g = dg + (((fg - dg) * mix) >> 5);
+    int32_t r = dr + (((fr - dr) * mix) >> 5);
+
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+void lv_esp32s3_rgb565_fill(uint16_t * dest, uint32_t cnt, uint32_t color)
+{
+    for(uint32_t i = 0; i < cnt * 8; i++) dest[i] = (uint16_t)color;
+}
+
+void lv_esp32s3_rgb565_fill_mix(uint16_t * dest, uint32_t cnt, uint32_t color, uint32_t mix)
+{
+    for(uint32_t i = 0; i < cnt * 8; i++) dest[i] = mix_px((uint16_t)color, dest[i], mix);
+}
+
+void lv_esp32s3_rgb565_fill_mask(uint16_t * dest, uint32_t cnt, uint32_t color, const uint8_t * mask, uint32_t opa)
+{
+    /*The end of a short row is passed with `cnt == 0`, the kernel doesn't access it then*/
+    LV_ASSERT(cnt == 0 || ((lv_uintptr_t)dest & 0xF) == 0);
+    LV_ASSERT(cnt == 0 || ((lv_uintptr_t)mask & 0x7) == 0);
+    for(uint32_t i = 0; i < cnt * 8; i++) {
+        dest[i] = mix_px((uint16_t)color, dest[i], mix_to_5bit((mask[i] * opa) >> 8));
+    }
+}
+
+void lv_esp32s3_rgb565_copy(uint16_t * dest, uint32_t cnt, const uint16_t * src)
+{
+    lv_memcpy(dest, src, cnt * 16);
+}
+
+void lv_esp32s3_rgb565_copy_mix(uint16_t * dest, uint32_t cnt, const uint16_t * src, uint32_t mix)
+{
+    for(uint32_t i = 0; i < cnt * 8; i++) dest[i] = mix_px(src[i], dest[i], mix);
+}
+
+void lv_esp32s3_rgb565_copy_mask(uint16_t * dest, uint32_t cnt, const uint16_t * src, const uint8_t * mask,
+                                 uint32_t opa)
+{
+    LV_ASSERT(cnt == 0 || ((lv_uintptr_t)dest & 0xF) == 0);
+    LV_ASSERT(cnt == 0 || ((lv_uintptr_t)mask & 0x7) == 0);
+    for(uint32_t i = 0; i < cnt * 8; i++) {
+        dest[i] = mix_px(src[i], dest[i], mix_to_5bit((mask[i] * opa) >> 8));
+    }
+}
+
+#endif /*!defined(__XTENSA__)*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t color_mask_blend(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t opa)
+{
+    const int32_t w = dsc->dest_w;
+    const int32_t h = dsc->dest_h;
+    const uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * mask = dsc->mask_buf;
+
+    for(int32_t y = 0; y < h; y++) {
+        const int32_t head = head_px(dest_buf_u16, w);
+        const int32_t cnt = (w - head) >> 3;
+        int32_t x;
+        for(x = 0; x < head; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], (mask[x] * opa) >> 8);
+        }
+        fill_mask_row(&dest_buf_u16[x], cnt, color16, &mask[x], opa);
+        for(x += cnt << 3; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], (mask[x] * opa) >> 8);
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t image_mask_blend(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t opa)
+{
+    const int32_t w = dsc->dest_w;
+    const int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const uint8_t * mask = dsc->mask_buf;
+
+    if((lv_uintptr_t)src_buf_u16 & 0x1) return LV_RESULT_INVALID;
+
+    for(int32_t y = 0; y < h; y++) {
+        const int32_t head = head_px(dest_buf_u16, w);
+        const int32_t cnt = (w - head) >> 3;
+        int32_t x;
+        for(x = 0; x < head; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], (mask[x] * opa) >> 8);
+        }
+        copy_mask_row(&dest_buf_u16[x], cnt, &src_buf_u16[x], &mask[x], opa);
+        for(x += cnt << 3; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], (mask[x] * opa) >> 8);
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Run the fill kernel on `cnt` groups of 8 pixels.
+ * The kernel loads the mask with 64 bit loads, so an unaligned mask is copied in chunks first.
+ */
+static void LV_ATTRIBUTE_FAST_MEM fill_mask_row(uint16_t * dest, int32_t cnt, uint16_t color, const uint8_t * mask,
+                                                uint32_t opa)
+{
+    if(((lv_uintptr_t)mask & 0x7) == 0) {
+        lv_esp32s3_rgb565_fill_mask(dest, cnt, color, mask, opa);
+        return;
+    }
+
+    uint64_t mask_aligned[MASK_CHUNK / sizeof(uint64_t)];
+    while(cnt > 0) {
+        int32_t chunk = LV_MIN(cnt, MASK_CHUNK / 8);
+        lv_memcpy(mask_aligned, mask, chunk * 8);
+        lv_esp32s3_rgb565_fill_mask(dest, chunk, color, (const uint8_t *)mask_aligned, opa);
+        dest += chunk * 8;
+        mask += chunk * 8;
+        cnt -= chunk;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM copy_mask_row(uint16_t * dest, int32_t cnt, const uint16_t * src,
+                                                const uint8_t * mask, uint32_t opa)
+{
+    if(((lv_uintptr_t)mask & 0x7) == 0) {
+        lv_esp32s3_rgb565_copy_mask(dest, cnt, src, mask, opa);
+        return;
+    }
+
+    uint64_t mask_aligned[MASK_CHUNK / sizeof(uint64_t)];
+    while(cnt > 0) {
+        int32_t chunk = LV_MIN(cnt, MASK_CHUNK / 8);
+        lv_memcpy(mask_aligned, mask, chunk * 8);
+        lv_esp32s3_rgb565_copy_mask(dest, chunk, src, (const uint8_t *)mask_aligned, opa);
+        dest += chunk * 8;
+        src += chunk * 8;
+        mask += chunk * 8;
+        cnt -= chunk;
+    }
+}
+
+/**
+ * Number of pixels to blend one by one until `dest` is 16 byte aligned for the kernels.
+ * The whole row is blended one by one if `dest` can't be aligned.
+ */
+static inline int32_t LV_ATTRIBUTE_FAST_MEM head_px(const uint16_t * dest, int32_t w)
+{
+    lv_uintptr_t offset = (lv_uintptr_t)dest & 0xF;
+    if(offset & 0x1) return w;
+    int32_t head = offset ? (int32_t)((16 - offset) >> 1) : 0;
+    return LV_MIN(head, w);
+}
+
+/**
+ * Convert an opacity to the 0..32 weight `lv_color_16_16_mix()` works with
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM mix_to_5bit(uint32_t opa)
+{
+    return (opa + 4) >> 3;
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3*/
@@ -0,0 +1,101 @@
+/**
+ * @file lv_draw_sw_blend_esp32s3_to_rgb565.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_ESP32S3_TO_RGB565_H
+#define LV_DRAW_SW_BLEND_ESP32S3_TO_RGB565_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3
+
+#include "../../../../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) lv_draw_sw_blend_esp32s3_color_to_rgb565(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) lv_draw_sw_blend_esp32s3_color_to_rgb565_with_mask(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa_mask(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc) lv_draw_sw_blend_esp32s3_rgb565_to_rgb565(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc) lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc) lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_mask(dsc)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc) lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa_mask(dsc)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc);
+
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc);
+lv_result_t lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc);
+
+/*
+ * Row kernels processing `cnt` groups of 8 pixels. `dest` has to be 16 byte aligned and `mask` 8 byte aligned
+ * unless `cnt` is 0.
+ * `mix` is the 0..32 weight used by `lv_color_16_16_mix()`, `opa` is 256 to use the mask as it is.
+ * They are implemented with PIE instructions in `lv_blend_esp32s3.S` on the ESP32-S3 and
+ * with a portable, bit-exact C model of the vector code everywhere else.
+ */
+void lv_esp32s3_rgb565_fill(uint16_t * dest, uint32_t cnt, uint32_t color);
+void lv_esp32s3_rgb565_fill_mix(uint16_t * dest, uint32_t cnt, uint32_t color, uint32_t mix);
+void lv_esp32s3_rgb565_fill_mask(uint16_t * dest, uint32_t cnt, uint32_t color, const uint8_t * mask, uint32_t opa);
+void lv_esp32s3_rgb565_copy(uint16_t * dest, uint32_t cnt, const uint16_t * src);
+void lv_esp32s3_rgb565_copy_mix(uint16_t * dest, uint32_t cnt, const uint16_t * src, uint32_t mix);
+void lv_esp32s3_rgb565_copy_mask(uint16_t * dest, uint32_t cnt, const uint16_t * src, const uint8_t * mask,
+                                 uint32_t opa);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3 */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_ESP32S3_TO_RGB565_H*/
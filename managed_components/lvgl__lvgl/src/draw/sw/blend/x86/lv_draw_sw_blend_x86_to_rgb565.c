@@ -0,0 +1,335 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_rgb565.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_to_rgb565.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_types.h"
+#include "../lv_draw_sw_blend_private.h"
+#include <immintrin.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The AVX2 kernels are compiled for AVX2 regardless of the compiler flags and only called if the CPU has it*/
+#define AVX2_FUNC __attribute__((target("avx2")))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef void (*fill_row_cb_t)(uint16_t * dest, int32_t w, uint16_t color);
+typedef void (*copy_row_cb_t)(uint16_t * dest, const uint16_t * src, int32_t w);
+typedef void (*blend_row_cb_t)(uint16_t * dest, const uint16_t * src, uint16_t color, const uint8_t * mask,
+                               uint32_t opa, int32_t w);
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void blend_rows(void * dest_buf, int32_t dest_stride, const void * src_buf, int32_t src_stride, uint16_t color,
+                       const uint8_t * mask, int32_t mask_stride, uint32_t opa, int32_t w, int32_t h);
+
+static inline void blend_px(uint16_t * dest, const uint16_t * src, uint16_t color, const uint8_t * mask, uint32_t opa,
+                            int32_t x);
+
+static void fill_row_sse2(uint16_t * dest, int32_t w, uint16_t color);
+static void copy_row_sse2(uint16_t * dest, const uint16_t * src, int32_t w);
+static void blend_row_sse2(uint16_t * dest, const uint16_t * src, uint16_t color, const uint8_t * mask, uint32_t opa,
+                           int32_t w);
+static inline __m128i mix_rgb565_sse2(__m128i fg, __m128i bg, __m128i mix);
+
+static void AVX2_FUNC fill_row_avx2(uint16_t * dest, int32_t w, uint16_t color);
+static void AVX2_FUNC copy_row_avx2(uint16_t * dest, const uint16_t * src, int32_t w);
+static void AVX2_FUNC blend_row_avx2(uint16_t * dest, const uint16_t * src, uint16_t color, const uint8_t * mask,
+                                    uint32_t opa, int32_t w);
+static inline __m256i AVX2_FUNC mix_rgb565_avx2(__m256i fg, __m256i bg, __m256i mix);
+
+static inline bool has_avx2(void);
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    fill_row_cb_t fill_row = has_avx2() ? fill_row_avx2 : fill_row_sse2;
+    const uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+
+    for(int32_t y = 0; y < dsc->dest_h; y++) {
+        fill_row(dest_buf_u16, dsc->dest_w, color16);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    blend_rows(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u16(dsc->color), NULL, 0, dsc->opa,
+               dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    blend_rows(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u16(dsc->color), dsc->mask_buf, dsc->mask_stride,
+               256, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb565_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    blend_rows(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u16(dsc->color), dsc->mask_buf, dsc->mask_stride,
+               dsc->opa, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    copy_row_cb_t copy_row = has_avx2() ? copy_row_avx2 : copy_row_sse2;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+
+    for(int32_t y = 0; y < dsc->dest_h; y++) {
+        copy_row(dest_buf_u16, src_buf_u16, dsc->dest_w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, dsc->opa,
+               dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf, dsc->mask_stride,
+               256, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf, dsc->mask_stride,
+               dsc->opa, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Blend `src_buf` (or `color` if `src_buf` is NULL) to `dest_buf`.
+ * Without a mask every pixel is mixed with `opa`. With a mask the mix is `mask * opa >> 8`,
+ * so `opa` has to be 256 to use the mask as it is.
+ */
+static void blend_rows(void * dest_buf, int32_t dest_stride, const void * src_buf, int32_t src_stride, uint16_t color,
+                       const uint8_t * mask, int32_t mask_stride, uint32_t opa, int32_t w, int32_t h)
+{
+    blend_row_cb_t blend_row = has_avx2() ? blend_row_avx2 : blend_row_sse2;
+    uint16_t * dest_buf_u16 = dest_buf;
+    const uint16_t * src_buf_u16 = src_buf;
+
+    for(int32_t y = 0; y < h; y++) {
+        blend_row(dest_buf_u16, src_buf_u16, color, mask, opa, w);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        if(src_buf_u16) src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+/**
+ * Blend a single pixel of a row the same way as the vector code
+ */
+static inline void blend_px(uint16_t * dest, const uint16_t * src, uint16_t color, const uint8_t * mask, uint32_t opa,
+                            int32_t x)
+{
+    uint16_t fg = src ? src[x] : color;
+    uint32_t mix = mask ? (mask[x] * opa) >> 8 : opa;
+    dest[x] = lv_color_16_16_mix(fg, dest[x], (uint8_t)mix);
+}
+
+static void fill_row_sse2(uint16_t * dest, int32_t w, uint16_t color)
+{
+    const __m128i color_v = _mm_set1_epi16((int16_t)color);
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        _mm_storeu_si128((__m128i *)&dest[x], color_v);
+    }
+    for(; x < w; x++) dest[x] = color;
+}
+
+static void copy_row_sse2(uint16_t * dest, const uint16_t * src, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        _mm_storeu_si128((__m128i *)&dest[x], _mm_loadu_si128((const __m128i *)&src[x]));
+    }
+    for(; x < w; x++) dest[x] = src[x];
+}
+
+static void blend_row_sse2(uint16_t * dest, const uint16_t * src, uint16_t color, const uint8_t * mask, uint32_t opa,
+                           int32_t w)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i four = _mm_set1_epi16(4);
+    const __m128i color_v = _mm_set1_epi16((int16_t)color);
+    const __m128i opa_v = _mm_set1_epi16((int16_t)opa);
+    const __m128i mix_opa = _mm_set1_epi16((int16_t)((opa + 4) >> 3));
+
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        __m128i fg = src ? _mm_loadu_si128((const __m128i *)&src[x]) : color_v;
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        __m128i mix = mix_opa;
+        if(mask) {
+            __m128i m = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&mask[x]), zero);
+            m = _mm_srli_epi16(_mm_mullo_epi16(m, opa_v), 8);
+            mix = _mm_srli_epi16(_mm_add_epi16(m, four), 3);
+        }
+        _mm_storeu_si128((__m128i *)&dest[x], mix_rgb565_sse2(fg, bg, mix));
+    }
+    for(; x < w; x++) blend_px(dest, src, color, mask, opa, x);
+}
+
+/**
+ * Mix 8 RGB565 pixels bit-exact with `lv_color_16_16_mix()`.
+ * `mix` is the 0..32 weight of `fg` on each 16 bit lane.
+ * The channels are blended separately as `bg + (((fg - bg) * mix) >> 5)`.
+ */
+static inline __m128i mix_rgb565_sse2(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+
+    __m128i fb = _mm_and_si128(fg, mask5);
+    __m128i bb = _mm_and_si128(bg, mask5);
+    __m128i b = _mm_add_epi16(bb, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fb, bb), mix), 5));
+
+    __m128i fgr = _mm_and_si128(_mm_srli_epi16(fg, 5), mask6);
+    __m128i bgr = _mm_and_si128(_mm_srli_epi16(bg, 5), mask6);
+    __m128i g = _mm_add_epi16(bgr, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fgr, bgr), mix), 5));
+
+    __m128i fr = _mm_srli_epi16(fg, 11);
+    __m128i br = _mm_srli_epi16(bg, 11);
+    __m128i r = _mm_add_epi16(br, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fr, br), mix), 5));
+
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+}
+
+static void AVX2_FUNC fill_row_avx2(uint16_t * dest, int32_t w, uint16_t color)
+{
+    const __m256i color_v = _mm256_set1_epi16((int16_t)color);
+    int32_t x;
+    for(x = 0; x <= w - 16; x += 16) {
+        _mm256_storeu_si256((__m256i *)&dest[x], color_v);
+    }
+    for(; x < w; x++) dest[x] = color;
+}
+
+static void AVX2_FUNC copy_row_avx2(uint16_t * dest, const uint16_t * src, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x <= w - 16; x += 16) {
+        _mm256_storeu_si256((__m256i *)&dest[x], _mm256_loadu_si256((const __m256i *)&src[x]));
+    }
+    for(; x < w; x++) dest[x] = src[x];
+}
+
+static void AVX2_FUNC blend_row_avx2(uint16_t * dest, const uint16_t * src, uint16_t color, const uint8_t * mask,
+                                     uint32_t opa, int32_t w)
+{
+    const __m256i four = _mm256_set1_epi16(4);
+    const __m256i color_v = _mm256_set1_epi16((int16_t)color);
+    const __m256i opa_v = _mm256_set1_epi16((int16_t)opa);
+    const __m256i mix_opa = _mm256_set1_epi16((int16_t)((opa + 4) >> 3));
+
+    int32_t x;
+    for(x = 0; x <= w - 16; x += 16) {
+        __m256i fg = src ? _mm256_loadu_si256((const __m256i *)&src[x]) : color_v;
+        __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+        __m256i mix = mix_opa;
+        if(mask) {
+            __m256i m = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&mask[x]));
+            m = _mm256_srli_epi16(_mm256_mullo_epi16(m, opa_v), 8);
+            mix = _mm256_srli_epi16(_mm256_add_epi16(m, four), 3);
+        }
+        _mm256_storeu_si256((__m256i *)&dest[x], mix_rgb565_avx2(fg, bg, mix));
+    }
+    for(; x < w; x++) blend_px(dest, src, color, mask, opa, x);
+}
+
+/**
+ * The AVX2 version of `mix_rgb565_sse2()` for 16 pixels
+ */
+static inline __m256i AVX2_FUNC mix_rgb565_avx2(__m256i fg, __m256i bg, __m256i mix)
+{
+    const __m256i mask5 = _mm256_set1_epi16(0x1F);
+    const __m256i mask6 = _mm256_set1_epi16(0x3F);
+
+    __m256i fb = _mm256_and_si256(fg, mask5);
+    __m256i bb = _mm256_and_si256(bg, mask5);
+    __m256i b = _mm256_add_epi16(bb, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(fb, bb), mix), 5));
+
+    __m256i fgr = _mm256_and_si256(_mm256_srli_epi16(fg, 5), mask6);
+    __m256i bgr = _mm256_and_si256(_mm256_srli_epi16(bg, 5), mask6);
+    __m256i g = _mm256_add_epi16(bgr, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(fgr, bgr), mix), 5));
+
+    __m256i fr = _mm256_srli_epi16(fg, 11);
+    __m256i br = _mm256_srli_epi16(bg, 11);
+    __m256i r = _mm256_add_epi16(br, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(fr, br), mix), 5));
+
+    return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), b);
+}
+
+static inline bool has_avx2(void)
+{
+    return __builtin_cpu_supports("avx2");
+}
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86*/
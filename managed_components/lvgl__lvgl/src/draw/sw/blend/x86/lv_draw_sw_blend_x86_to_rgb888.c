@@ -0,0 +1,510 @@
+/**
+ * @file lv_draw_sw_blend_x86_to_rgb888.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_to_rgb888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_math.h"
+#include "../../../../misc/lv_types.h"
+#include "../lv_draw_sw_blend_private.h"
+#include <immintrin.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The AVX2 kernels are compiled for AVX2 regardless of the compiler flags and only called if the CPU has it*/
+#define AVX2_FUNC __attribute__((target("avx2")))
+
+/*Length of the repeated color used to fill RGB888 buffers. A multiple of 3 and of the vector sizes.*/
+#define PATTERN_SIZE 96
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef void (*fill_row_cb_t)(uint32_t * dest, int32_t w, uint32_t color);
+typedef void (*blend_row_cb_t)(uint32_t * dest, const uint32_t * src, uint32_t color, const uint8_t * mask,
+                               uint32_t opa, bool src_alpha, int32_t w);
+typedef void (*mix_bytes_cb_t)(uint8_t * dest, const uint8_t * src, int32_t len, uint32_t opa);
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void fill_rows(void * dest_buf, int32_t dest_stride, uint32_t color, int32_t w, int32_t h);
+static void blend_rows(void * dest_buf, int32_t dest_stride, const void * src_buf, int32_t src_stride, uint32_t color,
+                       const uint8_t * mask, int32_t mask_stride, uint32_t opa, bool src_alpha, int32_t w, int32_t h);
+
+static inline void blend_px(uint32_t * dest, const uint32_t * src, uint32_t color, const uint8_t * mask, uint32_t opa,
+                            bool src_alpha, int32_t x);
+static inline void mix_byte(uint8_t * dest, const uint8_t * src, uint32_t opa, int32_t i);
+
+static void fill_row_sse2(uint32_t * dest, int32_t w, uint32_t color);
+static void blend_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color, const uint8_t * mask, uint32_t opa,
+                           bool src_alpha, int32_t w);
+static void mix_bytes_sse2(uint8_t * dest, const uint8_t * src, int32_t len, uint32_t opa);
+static inline __m128i mix_xrgb8888_sse2(__m128i fg, __m128i bg, __m128i mix);
+
+static void AVX2_FUNC fill_row_avx2(uint32_t * dest, int32_t w, uint32_t color);
+static void AVX2_FUNC blend_row_avx2(uint32_t * dest, const uint32_t * src, uint32_t color, const uint8_t * mask,
+                                     uint32_t opa, bool src_alpha, int32_t w);
+static void AVX2_FUNC mix_bytes_avx2(uint8_t * dest, const uint8_t * src, int32_t len, uint32_t opa);
+static inline __m256i AVX2_FUNC mix_xrgb8888_avx2(__m256i fg, __m256i bg, __m256i mix);
+
+static inline bool has_avx2(void);
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    /*The generic code fills the first row and copies it, which is already as fast for RGB888*/
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    fill_rows(dsc->dest_buf, dsc->dest_stride, lv_color_to_u32(dsc->color), dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+
+    if(dest_px_size == 4) {
+        blend_rows(dsc->dest_buf, dsc->dest_stride, NULL, 0, color32, NULL, 0, dsc->opa, false,
+                   dsc->dest_w, dsc->dest_h);
+        return LV_RESULT_OK;
+    }
+
+    /*All bytes are mixed with the same opacity, so RGB888 can be handled as a stream of bytes*/
+    if(dsc->opa == LV_OPA_TRANSP) return LV_RESULT_OK;
+
+    uint8_t pattern[PATTERN_SIZE];
+    for(int32_t i = 0; i < PATTERN_SIZE; i += 3) {
+        pattern[i + 0] = dsc->color.blue;
+        pattern[i + 1] = dsc->color.green;
+        pattern[i + 2] = dsc->color.red;
+    }
+
+    mix_bytes_cb_t mix_bytes = has_avx2() ? mix_bytes_avx2 : mix_bytes_sse2;
+    const int32_t len = dsc->dest_w * 3;
+    uint8_t * dest_buf_u8 = dsc->dest_buf;
+    for(int32_t y = 0; y < dsc->dest_h; y++) {
+        for(int32_t i = 0; i < len; i += PATTERN_SIZE) {
+            mix_bytes(&dest_buf_u8[i], pattern, LV_MIN(PATTERN_SIZE, len - i), dsc->opa);
+        }
+        dest_buf_u8 += dsc->dest_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), dsc->mask_buf, dsc->mask_stride,
+               256, false, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_rgb888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                               uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), dsc->mask_buf, dsc->mask_stride,
+               dsc->opa, false, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_rgb888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                           uint32_t dest_px_size, uint32_t src_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    if(dest_px_size != src_px_size) return LV_RESULT_INVALID;
+
+    if(dest_px_size == 4) {
+        blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, dsc->opa, false,
+                   dsc->dest_w, dsc->dest_h);
+        return LV_RESULT_OK;
+    }
+
+    if(dsc->opa == LV_OPA_TRANSP) return LV_RESULT_OK;
+
+    mix_bytes_cb_t mix_bytes = has_avx2() ? mix_bytes_avx2 : mix_bytes_sse2;
+    uint8_t * dest_buf_u8 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    for(int32_t y = 0; y < dsc->dest_h; y++) {
+        mix_bytes(dest_buf_u8, src_buf_u8, dsc->dest_w * 3, dsc->opa);
+        dest_buf_u8 += dsc->dest_stride;
+        src_buf_u8 += dsc->src_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_rgb888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                            uint32_t dest_px_size, uint32_t src_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    if(dest_px_size != 4 || src_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf, dsc->mask_stride,
+               256, false, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_rgb888_to_rgb888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                uint32_t dest_px_size, uint32_t src_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    if(dest_px_size != 4 || src_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf, dsc->mask_stride,
+               dsc->opa, false, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, 256, true,
+               dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, dsc->opa, true,
+               dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf, dsc->mask_stride,
+               256, true, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_argb8888_to_rgb888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t dest_px_size)
+{
+    LV_ASSERT(dsc->opa < LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf != NULL);
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    blend_rows(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf, dsc->mask_stride,
+               dsc->opa, true, dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    LV_ASSERT(dsc->opa >= LV_OPA_MAX);
+    LV_ASSERT(dsc->mask_buf == NULL);
+    fill_rows(dsc->dest_buf, dsc->dest_stride, lv_color_to_u32(dsc->color), dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void fill_rows(void * dest_buf, int32_t dest_stride, uint32_t color, int32_t w, int32_t h)
+{
+    fill_row_cb_t fill_row = has_avx2() ? fill_row_avx2 : fill_row_sse2;
+    uint32_t * dest_buf_u32 = dest_buf;
+
+    for(int32_t y = 0; y < h; y++) {
+        fill_row(dest_buf_u32, w, color);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dest_stride);
+    }
+}
+
+/**
+ * Blend `src_buf` (or `color` if `src_buf` is NULL) to an XRGB8888 `dest_buf`.
+ * The mix of a pixel is the product of the source alpha (if `src_alpha`), the mask and `opa` as in
+ * `LV_OPA_MIX2()`/`LV_OPA_MIX3()`. `opa` has to be 256 if only the alpha or the mask is used.
+ * The alpha byte of `dest_buf` is kept as it is.
+ */
+static void blend_rows(void * dest_buf, int32_t dest_stride, const void * src_buf, int32_t src_stride, uint32_t color,
+                       const uint8_t * mask, int32_t mask_stride, uint32_t opa, bool src_alpha, int32_t w, int32_t h)
+{
+    blend_row_cb_t blend_row = has_avx2() ? blend_row_avx2 : blend_row_sse2;
+    uint32_t * dest_buf_u32 = dest_buf;
+    const uint32_t * src_buf_u32 = src_buf;
+
+    for(int32_t y = 0; y < h; y++) {
+        blend_row(dest_buf_u32, src_buf_u32, color, mask, opa, src_alpha, w);
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dest_stride);
+        if(src_buf_u32) src_buf_u32 = drawbuf_next_row(src_buf_u32, src_stride);
+        if(mask) mask += mask_stride;
+    }
+}
+
+/**
+ * Blend a single pixel of a row the same way as `lv_color_24_24_mix()` in the generic code
+ */
+static inline void blend_px(uint32_t * dest, const uint32_t * src, uint32_t color, const uint8_t * mask, uint32_t opa,
+                            bool src_alpha, int32_t x)
+{
+    uint32_t fg = src ? src[x] : color;
+    uint32_t mix;
+    if(src_alpha) mix = mask ? ((fg >> 24) * mask[x] * opa) >> 16 : ((fg >> 24) * opa) >> 8;
+    else mix = mask ? (mask[x] * opa) >> 8 : opa;
+
+    if(mix == 0) return;
+
+    const uint8_t * fg_u8 = (const uint8_t *)&fg;
+    uint8_t * dest_u8 = (uint8_t *)&dest[x];
+    if(mix >= LV_OPA_MAX) {
+        dest_u8[0] = fg_u8[0];
+        dest_u8[1] = fg_u8[1];
+        dest_u8[2] = fg_u8[2];
+    }
+    else {
+        uint32_t mix_inv = 255 - mix;
+        dest_u8[0] = (fg_u8[0] * mix + dest_u8[0] * mix_inv) >> 8;
+        dest_u8[1] = (fg_u8[1] * mix + dest_u8[1] * mix_inv) >> 8;
+        dest_u8[2] = (fg_u8[2] * mix + dest_u8[2] * mix_inv) >> 8;
+    }
+}
+
+static inline void mix_byte(uint8_t * dest, const uint8_t * src, uint32_t opa, int32_t i)
+{
+    dest[i] = (src[i] * opa + dest[i] * (255 - opa)) >> 8;
+}
+
+static void fill_row_sse2(uint32_t * dest, int32_t w, uint32_t color)
+{
+    const __m128i color_v = _mm_set1_epi32((int32_t)color);
+    int32_t x;
+    for(x = 0; x <= w - 4; x += 4) {
+        _mm_storeu_si128((__m128i *)&dest[x], color_v);
+    }
+    for(; x < w; x++) dest[x] = color;
+}
+
+static void blend_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color, const uint8_t * mask, uint32_t opa,
+                           bool src_alpha, int32_t w)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i color_v = _mm_set1_epi32((int32_t)color);
+    const __m128i opa_v = _mm_set1_epi16((int16_t)opa);
+    const __m128i mix_opa = _mm_set1_epi32((int32_t)opa);
+
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        __m128i mask_lo = zero;
+        __m128i mask_hi = zero;
+        if(mask) {
+            __m128i m = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&mask[x]), zero);
+            mask_lo = _mm_unpacklo_epi16(m, zero);
+            mask_hi = _mm_unpackhi_epi16(m, zero);
+        }
+
+        for(int32_t i = 0; i < 2; i++) {
+            __m128i fg = src ? _mm_loadu_si128((const __m128i *)&src[x + i * 4]) : color_v;
+            __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x + i * 4]);
+            __m128i mask_v = i == 0 ? mask_lo : mask_hi;
+            __m128i mix = mix_opa;
+            /*The values are less than 256 so 16 bit multiplications on the 32 bit lanes are enough*/
+            if(src_alpha) {
+                mix = _mm_srli_epi32(fg, 24);
+                if(mask) mix = _mm_mulhi_epu16(_mm_mullo_epi16(mix, mask_v), opa_v);
+                else mix = _mm_srli_epi32(_mm_mullo_epi16(mix, opa_v), 8);
+            }
+            else if(mask) {
+                mix = _mm_srli_epi32(_mm_mullo_epi16(mask_v, opa_v), 8);
+            }
+            _mm_storeu_si128((__m128i *)&dest[x + i * 4], mix_xrgb8888_sse2(fg, bg, mix));
+        }
+    }
+    for(; x < w; x++) blend_px(dest, src, color, mask, opa, src_alpha, x);
+}
+
+static void mix_bytes_sse2(uint8_t * dest, const uint8_t * src, int32_t len, uint32_t opa)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opa_v = _mm_set1_epi16((int16_t)opa);
+    const __m128i opa_inv_v = _mm_set1_epi16((int16_t)(255 - opa));
+
+    int32_t i;
+    for(i = 0; i <= len - 16; i += 16) {
+        __m128i fg = _mm_loadu_si128((const __m128i *)&src[i]);
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[i]);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), opa_v),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), opa_inv_v));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), opa_v),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), opa_inv_v));
+        _mm_storeu_si128((__m128i *)&dest[i], _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+    }
+    for(; i < len; i++) mix_byte(dest, src, opa, i);
+}
+
+/**
+ * Mix 4 XRGB8888 pixels bit-exact with `lv_color_24_24_mix()`.
+ * `mix` is the 0..255 opacity of `fg` on each 32 bit lane.
+ */
+static inline __m128i mix_xrgb8888_sse2(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v255 = _mm_set1_epi16(255);
+    const __m128i alpha_mask = _mm_set1_epi32((int32_t)0xFF000000);
+
+    /*Spread the mix of each pixel to the 16 bit lanes of its 4 channels*/
+    __m128i mix16 = _mm_or_si128(mix, _mm_slli_epi32(mix, 16));
+    __m128i mix_lo = _mm_unpacklo_epi32(mix16, mix16);
+    __m128i mix_hi = _mm_unpackhi_epi32(mix16, mix16);
+
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), mix_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(v255, mix_lo)));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), mix_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(v255, mix_hi)));
+    __m128i res = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+    /*Fully opaque pixels are copied and transparent ones are kept as they are*/
+    __m128i cover = _mm_cmpgt_epi32(mix, _mm_set1_epi32(LV_OPA_MAX - 1));
+    res = _mm_or_si128(_mm_and_si128(cover, fg), _mm_andnot_si128(cover, res));
+    __m128i transp = _mm_cmpeq_epi32(mix, zero);
+    res = _mm_or_si128(_mm_and_si128(transp, bg), _mm_andnot_si128(transp, res));
+
+    return _mm_or_si128(_mm_andnot_si128(alpha_mask, res), _mm_and_si128(alpha_mask, bg));
+}
+
+static void AVX2_FUNC fill_row_avx2(uint32_t * dest, int32_t w, uint32_t color)
+{
+    const __m256i color_v = _mm256_set1_epi32((int32_t)color);
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        _mm256_storeu_si256((__m256i *)&dest[x], color_v);
+    }
+    for(; x < w; x++) dest[x] = color;
+}
+
+static void AVX2_FUNC blend_row_avx2(uint32_t * dest, const uint32_t * src, uint32_t color, const uint8_t * mask,
+                                     uint32_t opa, bool src_alpha, int32_t w)
+{
+    const __m256i color_v = _mm256_set1_epi32((int32_t)color);
+    const __m256i opa_v = _mm256_set1_epi16((int16_t)opa);
+    const __m256i mix_opa = _mm256_set1_epi32((int32_t)opa);
+
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        __m256i fg = src ? _mm256_loadu_si256((const __m256i *)&src[x]) : color_v;
+        __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+        __m256i mask_v = mask ? _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&mask[x])) : _mm256_setzero_si256();
+        __m256i mix = mix_opa;
+        if(src_alpha) {
+            mix = _mm256_srli_epi32(fg, 24);
+            if(mask) mix = _mm256_mulhi_epu16(_mm256_mullo_epi16(mix, mask_v), opa_v);
+            else mix = _mm256_srli_epi32(_mm256_mullo_epi16(mix, opa_v), 8);
+        }
+        else if(mask) {
+            mix = _mm256_srli_epi32(_mm256_mullo_epi16(mask_v, opa_v), 8);
+        }
+        _mm256_storeu_si256((__m256i *)&dest[x], mix_xrgb8888_avx2(fg, bg, mix));
+    }
+    for(; x < w; x++) blend_px(dest, src, color, mask, opa, src_alpha, x);
+}
+
+static void AVX2_FUNC mix_bytes_avx2(uint8_t * dest, const uint8_t * src, int32_t len, uint32_t opa)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i opa_v = _mm256_set1_epi16((int16_t)opa);
+    const __m256i opa_inv_v = _mm256_set1_epi16((int16_t)(255 - opa));
+
+    int32_t i;
+    for(i = 0; i <= len - 32; i += 32) {
+        __m256i fg = _mm256_loadu_si256((const __m256i *)&src[i]);
+        __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[i]);
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(fg, zero), opa_v),
+                                      _mm256_mullo_epi16(_mm256_unpacklo_epi8(bg, zero), opa_inv_v));
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(fg, zero), opa_v),
+                                      _mm256_mullo_epi16(_mm256_unpackhi_epi8(bg, zero), opa_inv_v));
+        _mm256_storeu_si256((__m256i *)&dest[i], _mm256_packus_epi16(_mm256_srli_epi16(lo, 8),
+                                                                     _mm256_srli_epi16(hi, 8)));
+    }
+    for(; i < len; i++) mix_byte(dest, src, opa, i);
+}
+
+/**
+ * The AVX2 version of `mix_xrgb8888_sse2()` for 8 pixels.
+ * The unpack and pack instructions work within the 128 bit halves, so the pixels stay in order.
+ */
+static inline __m256i AVX2_FUNC mix_xrgb8888_avx2(__m256i fg, __m256i bg, __m256i mix)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i v255 = _mm256_set1_epi16(255);
+    const __m256i alpha_mask = _mm256_set1_epi32((int32_t)0xFF000000);
+
+    __m256i mix16 = _mm256_or_si256(mix, _mm256_slli_epi32(mix, 16));
+    __m256i mix_lo = _mm256_unpacklo_epi32(mix16, mix16);
+    __m256i mix_hi = _mm256_unpackhi_epi32(mix16, mix16);
+
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(fg, zero), mix_lo),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(bg, zero), _mm256_sub_epi16(v255, mix_lo)));
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(fg, zero), mix_hi),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(bg, zero), _mm256_sub_epi16(v255, mix_hi)));
+    __m256i res = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+
+    __m256i cover = _mm256_cmpgt_epi32(mix, _mm256_set1_epi32(LV_OPA_MAX - 1));
+    res = _mm256_blendv_epi8(res, fg, cover);
+    __m256i transp = _mm256_cmpeq_epi32(mix, zero);
+    res = _mm256_blendv_epi8(res, bg, transp);
+
+    return _mm256_blendv_epi8(res, bg, alpha_mask);
+}
+
+static inline bool has_avx2(void)
+{
+    return __builtin_cpu_supports("avx2");
+}
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86*/
@@ -39,6 +39,11 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+#if LV_DRAW_SW_USE_TILE_SPLIT
+    #define TILE_SPLIT_MIN_AREA     (16 * 1024)     /*Split only the draw tasks larger than this many pixels*/
+    #define TILE_SPLIT_MIN_BAND_H   16              /*Min. height of a band in pixels*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -51,6 +56,12 @@
 #endif
 
 static void execute_drawing(lv_draw_task_t * t);
+#if LV_DRAW_SW_USE_TILE_SPLIT
+    static bool execute_split_drawing(lv_draw_sw_thread_dsc_t * thread_dsc);
+    static bool steal_band(lv_draw_sw_thread_dsc_t * thread_dsc);
+    static void execute_band(const lv_draw_sw_band_t * band, uint32_t thread_idx);
+    static void finish_band(lv_draw_sw_thread_dsc_t * owner_dsc);
+#endif
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
@@ -90,11 +101,16 @@ void lv_draw_sw_init(void)
 #endif
 
 #if LV_USE_OS
+    draw_sw_unit->thread_cnt = LV_DRAW_SW_DRAW_UNIT_CNT;
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
         thread_dsc->idx = i;
         thread_dsc->draw_unit = (void *) draw_sw_unit;
+#if LV_DRAW_SW_USE_TILE_SPLIT
+        lv_mutex_init(&thread_dsc->band_mutex);
+#endif
         lv_thread_init(&thread_dsc->thread, "swdraw", LV_DRAW_THREAD_PRIO, render_thread_cb,
                        LV_DRAW_THREAD_STACK_SIZE, thread_dsc);
     }
@@ -141,6 +157,13 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_delete(&thread_dsc->thread);
     }
 
+#if LV_DRAW_SW_USE_TILE_SPLIT
+    /*Delete the band mutexes only when no thread can try to steal a band anymore*/
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_mutex_delete(&draw_sw_unit->thread_dscs[i].band_mutex);
+    }
+#endif
+
     return 0;
 #else
     LV_UNUSED(draw_unit);
@@ -262,7 +285,7 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
 
     /*If at least one is busy, it's not all idle*/
     bool all_idle = true;
-    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+    for(i = 0; i < draw_sw_unit->thread_cnt; i++) {
         if(draw_sw_unit->thread_dscs[i].task_act) {
             all_idle = false;
             break;
@@ -270,7 +293,7 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     }
 
     lv_draw_task_t * t = NULL;
-    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+    for(i = 0; i < draw_sw_unit->thread_cnt; i++) {
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
 
         /*Do nothing if busy*/
@@ -354,6 +377,10 @@ static void render_thread_cb(void * ptr)
             if(thread_dsc->exit_status) {
                 break;
             }
+#if LV_DRAW_SW_USE_TILE_SPLIT
+            /*Help the other threads while there is nothing else to do*/
+            if(steal_band(thread_dsc)) continue;
+#endif
             lv_thread_sync_wait(&thread_dsc->sync);
         }
 
@@ -362,10 +389,15 @@ static void render_thread_cb(void * ptr)
             break;
         }
 
-        execute_drawing(thread_dsc->task_act);
+#if LV_DRAW_SW_USE_TILE_SPLIT
+        if(!execute_split_drawing(thread_dsc))
+#endif
+        {
+            execute_drawing(thread_dsc->task_act);
 #if LV_USE_PARALLEL_DRAW_DEBUG
-        parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
+            parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
 #endif
+        }
         thread_dsc->task_act->state = LV_DRAW_TASK_STATE_FINISHED;
         thread_dsc->task_act = NULL;
 
@@ -380,6 +412,171 @@ static void render_thread_cb(void * ptr)
 }
 #endif
 
+#if LV_DRAW_SW_USE_TILE_SPLIT
+/**
+ * Split the active draw task of a thread into horizontal bands if it's large enough.
+ * The thread renders the bands from the end while the idle threads can steal them from the start.
+ * Returns only when all bands are rendered.
+ * @param thread_dsc    the thread whose `task_act` should be rendered
+ * @return              false if the draw task wasn't split and should be rendered normally
+ */
+static bool execute_split_drawing(lv_draw_sw_thread_dsc_t * thread_dsc)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *)thread_dsc->draw_unit;
+    if(draw_sw_unit->thread_cnt < 2) return false;
+
+    lv_draw_task_t * t = thread_dsc->task_act;
+
+    /*Split only the draw tasks whose parts can be rendered independently by only clipping them.
+     *E.g. box shadows might use a shared cache and masks or vector graphics have internal states.*/
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL: {
+                /*Complex gradients store their state in the draw descriptor*/
+                lv_draw_fill_dsc_t * draw_dsc = t->draw_dsc;
+                if(draw_dsc->grad.dir >= LV_GRAD_DIR_LINEAR) return false;
+            }
+            break;
+        case LV_DRAW_TASK_TYPE_BORDER:
+            break;
+        case LV_DRAW_TASK_TYPE_LABEL: {
+                /*The lines above the band are skipped without parsing, so the recolor commands in them would be lost.
+                 *The bands would also read and write the shared `hint` concurrently.*/
+                lv_draw_label_dsc_t * draw_dsc = t->draw_dsc;
+                if(draw_dsc->flag & LV_TEXT_FLAG_RECOLOR) return false;
+                if(draw_dsc->hint) return false;
+            }
+            break;
+        case LV_DRAW_TASK_TYPE_LAYER: {
+                /*The bitmap mask is applied on the whole layer in place*/
+                lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+                if(draw_dsc->bitmap_mask_src) return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return false;
+    if(lv_area_get_size(&draw_area) < TILE_SPLIT_MIN_AREA) return false;
+
+    int32_t h = lv_area_get_height(&draw_area);
+    uint32_t band_cnt = LV_MIN(LV_DRAW_SW_TILE_SPLIT_BAND_MAX, (uint32_t)(h / TILE_SPLIT_MIN_BAND_H));
+    if(band_cnt < 2) return false;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    lv_mutex_lock(&thread_dsc->band_mutex);
+    uint32_t i;
+    for(i = 0; i < band_cnt; i++) {
+        thread_dsc->bands[i].task = t;
+        thread_dsc->bands[i].y1 = draw_area.y1 + (int32_t)(h * i / band_cnt);
+        thread_dsc->bands[i].y2 = draw_area.y1 + (int32_t)(h * (i + 1) / band_cnt) - 1;
+    }
+    thread_dsc->band_start = 0;
+    thread_dsc->band_end = band_cnt;
+    thread_dsc->band_remaining = band_cnt;
+    lv_mutex_unlock(&thread_dsc->band_mutex);
+
+    /*Wake up the idle threads to steal bands*/
+    for(i = 0; i < draw_sw_unit->thread_cnt; i++) {
+        lv_draw_sw_thread_dsc_t * other_dsc = &draw_sw_unit->thread_dscs[i];
+        if(other_dsc != thread_dsc && other_dsc->task_act == NULL && other_dsc->inited) {
+            lv_thread_sync_signal(&other_dsc->sync);
+        }
+    }
+
+    /*Render the own bands from the end*/
+    while(1) {
+        lv_draw_sw_band_t band;
+        lv_mutex_lock(&thread_dsc->band_mutex);
+        bool has_band = thread_dsc->band_start < thread_dsc->band_end;
+        if(has_band) {
+            thread_dsc->band_end--;
+            band = thread_dsc->bands[thread_dsc->band_end];
+        }
+        lv_mutex_unlock(&thread_dsc->band_mutex);
+        if(!has_band) break;
+
+        execute_band(&band, thread_dsc->idx);
+        finish_band(thread_dsc);
+    }
+
+    /*Wait for the stolen bands. The thread finishing the last band will signal.*/
+    while(1) {
+        lv_mutex_lock(&thread_dsc->band_mutex);
+        uint32_t remaining = thread_dsc->band_remaining;
+        lv_mutex_unlock(&thread_dsc->band_mutex);
+        if(remaining == 0) break;
+
+        lv_thread_sync_wait(&thread_dsc->sync);
+    }
+
+    LV_PROFILER_DRAW_END;
+    return true;
+}
+
+/**
+ * Take a band from an other thread and render it.
+ * @param thread_dsc    the idle thread
+ * @return              true if a band was rendered
+ */
+static bool steal_band(lv_draw_sw_thread_dsc_t * thread_dsc)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *)thread_dsc->draw_unit;
+    uint32_t thread_cnt = draw_sw_unit->thread_cnt;
+    if(thread_dsc->idx >= thread_cnt) return false;
+
+    uint32_t i;
+    for(i = 1; i < thread_cnt; i++) {
+        lv_draw_sw_thread_dsc_t * victim_dsc = &draw_sw_unit->thread_dscs[(thread_dsc->idx + i) % thread_cnt];
+
+        lv_draw_sw_band_t band;
+        lv_mutex_lock(&victim_dsc->band_mutex);
+        bool has_band = victim_dsc->band_start < victim_dsc->band_end;
+        if(has_band) {
+            band = victim_dsc->bands[victim_dsc->band_start];
+            victim_dsc->band_start++;
+        }
+        lv_mutex_unlock(&victim_dsc->band_mutex);
+
+        if(has_band) {
+            execute_band(&band, thread_dsc->idx);
+            finish_band(victim_dsc);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void execute_band(const lv_draw_sw_band_t * band, uint32_t thread_idx)
+{
+    /*Render a copy of the draw task clipped to the band*/
+    lv_draw_task_t band_task = *band->task;
+    band_task.clip_area.y1 = LV_MAX(band_task.clip_area.y1, band->y1);
+    band_task.clip_area.y2 = LV_MIN(band_task.clip_area.y2, band->y2);
+
+    execute_drawing(&band_task);
+#if LV_USE_PARALLEL_DRAW_DEBUG
+    parallel_debug_draw(&band_task, thread_idx);
+#else
+    LV_UNUSED(thread_idx);
+#endif
+}
+
+static void finish_band(lv_draw_sw_thread_dsc_t * owner_dsc)
+{
+    lv_mutex_lock(&owner_dsc->band_mutex);
+    owner_dsc->band_remaining--;
+    bool last = owner_dsc->band_remaining == 0;
+    lv_mutex_unlock(&owner_dsc->band_mutex);
+
+    /*The owner might wait for the stolen bands*/
+    if(last) lv_thread_sync_signal(&owner_dsc->sync);
+}
+#endif /*LV_DRAW_SW_USE_TILE_SPLIT*/
+
 static void execute_drawing(lv_draw_task_t * t)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -28,10 +28,6 @@
 #define SHADOW_UPSCALE_SHIFT    6
 #define SHADOW_ENHANCE          1
 
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    #define shadow_cache LV_GLOBAL_DEFAULT()->sw_shadow_cache
-#endif
-
 /**********************
  *      TYPEDEFS
  **********************/
@@ -42,6 +38,8 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+static void shadow_mirror_corner(lv_opa_t * sh_buf, int32_t size);
+static bool shadow_corner_create_cb(lv_draw_sw_mask_cache_data_t * data, void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -97,34 +95,32 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
-
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
+    /*The size of the blurred area matters only if its other corners reach into this corner.
+     *Clamp it to make all the large enough areas share the same cache entry.*/
+    lv_draw_sw_mask_cache_data_t key = {
+        .slot.size = sizeof(lv_draw_sw_mask_cache_data_t) + 2 * corner_size * corner_size,
+        .type = LV_DRAW_SW_MASK_CACHE_SHADOW,
+        .radius = r_sh,
+        .width = dsc->width,
+        .w = LV_MIN(lv_area_get_width(&core_area), 2 * corner_size + 2),
+        .h = LV_MIN(lv_area_get_height(&core_area), 2 * corner_size + 2),
+    };
+
+    /*The corner is followed by its horizontally mirrored version for the left side*/
+    lv_opa_t * sh_corner_buf;
+    lv_cache_entry_t * sh_entry = lv_draw_sw_mask_cache_acquire_or_create(&key, shadow_corner_create_cb, &core_area);
+    if(sh_entry) {
+        sh_corner_buf = ((lv_draw_sw_mask_cache_data_t *)lv_cache_entry_get_data(sh_entry))->shadow_corner;
     }
     else {
         /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        LV_ASSERT_MALLOC(sh_buf);
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
+        uint16_t * sh_ups_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
+        LV_ASSERT_MALLOC(sh_ups_buf);
+        shadow_draw_corner_buf(&core_area, sh_ups_buf, dsc->width, r_sh);
+        sh_corner_buf = (lv_opa_t *)sh_ups_buf;
+        shadow_mirror_corner(sh_corner_buf, corner_size);
     }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    LV_ASSERT_MALLOC(sh_buf);
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+    const lv_opa_t * sh_buf = sh_corner_buf;
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
@@ -141,7 +137,7 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     lv_opa_t * mask_buf = lv_malloc(lv_area_get_width(&shadow_area));
     lv_area_t blend_area;
     lv_area_t clip_area_sub;
-    lv_opa_t * sh_buf_tmp;
+    const lv_opa_t * sh_buf_tmp;
     int32_t y;
     bool simple_sub;
 
@@ -382,22 +378,8 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
         }
     }
 
-    /*Mirror the shadow corner buffer horizontally*/
-    sh_buf_tmp = sh_buf ;
-    for(y = 0; y < corner_size; y++) {
-        int32_t x;
-        lv_opa_t * start = sh_buf_tmp;
-        lv_opa_t * end = sh_buf_tmp + corner_size - 1;
-        for(x = 0; x < corner_size / 2; x++) {
-            lv_opa_t tmp = *start;
-            *start = *end;
-            *end = tmp;
-
-            start++;
-            end--;
-        }
-        sh_buf_tmp += corner_size;
-    }
+    /*Use the horizontally mirrored shadow corner buffer*/
+    sh_buf = sh_corner_buf + corner_size * corner_size;
 
     /*Left side*/
     blend_area.x1 = shadow_area.x1;
@@ -555,7 +537,8 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
-    lv_free(sh_buf);
+    if(sh_entry) lv_draw_sw_mask_cache_release(sh_entry);
+    else lv_free(sh_corner_buf);
     lv_free(mask_buf);
 }
 
@@ -563,6 +546,42 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
  *   STATIC FUNCTIONS
  **********************/
 
+static bool shadow_corner_create_cb(lv_draw_sw_mask_cache_data_t * data, void * user_data)
+{
+    const lv_area_t * core_area = user_data;
+    int32_t corner_size = data->width + data->radius;
+
+    /*A larger buffer is required for calculation*/
+    uint16_t * sh_ups_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(sh_ups_buf);
+    if(sh_ups_buf == NULL) return false;
+    shadow_draw_corner_buf(core_area, sh_ups_buf, data->width, data->radius);
+
+    data->shadow_corner = (lv_opa_t *)sh_ups_buf;
+    shadow_mirror_corner(data->shadow_corner, corner_size);
+    return true;
+}
+
+/**
+ * Write the horizontally mirrored version of a shadow corner after it
+ * @param sh_buf    the `size * size` opacities of the corner followed by `size * size` free bytes
+ * @param size      the size of the corner
+ */
+static void shadow_mirror_corner(lv_opa_t * sh_buf, int32_t size)
+{
+    const lv_opa_t * src = sh_buf;
+    lv_opa_t * dest = sh_buf + size * size;
+    int32_t y;
+    for(y = 0; y < size; y++) {
+        int32_t x;
+        for(x = 0; x < size; x++) {
+            dest[x] = src[size - 1 - x];
+        }
+        src += size;
+        dest += size;
+    }
+}
+
 /**
  * Calculate a blurred corner
  * @param coords Coordinates of the shadow
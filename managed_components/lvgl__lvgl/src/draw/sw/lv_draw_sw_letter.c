@@ -23,19 +23,27 @@
 #include "../../display/lv_display.h"
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_assert.h"
-#include "../../misc/lv_area.h"
+#include "../../misc/lv_area_private.h"
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
+#include "../../font/lv_font_fmt_txt.h"
 #include "../../core/lv_refr_private.h"
 #include "../../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define GLYPH_MASK_BUF_SIZE 512 /*Bytes on the stack to convert 2 and 4 bpp glyph rows to opacities*/
+#define GLYPH_SPAN_MAX      16  /*Max. number of spans collected from a row of a 1 bpp glyph at once*/
 
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct {
+    int32_t x1;
+    int32_t x2;
+} glyph_span_t;
+
 #if LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 
 typedef struct {
@@ -52,6 +60,15 @@ typedef struct {
 
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_draw_dsc,
                                                        lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area);
+static bool draw_letter_packed(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_draw_dsc);
+static void draw_letter_a1(lv_draw_task_t * t, const lv_draw_glyph_dsc_t * glyph_draw_dsc, const uint8_t * bitmap,
+                           uint32_t row_bits, const lv_area_t * clip_area);
+static void draw_letter_a2_a4(lv_draw_task_t * t, const lv_draw_glyph_dsc_t * glyph_draw_dsc, const uint8_t * bitmap,
+                              uint32_t row_bits, uint32_t bpp, const lv_area_t * clip_area);
+static uint32_t get_a1_spans(const uint8_t * bitmap, uint32_t bit_ofs, int32_t x, int32_t x_max,
+                             glyph_span_t * spans, int32_t * x_next);
+static void blend_spans(lv_draw_task_t * t, lv_draw_sw_blend_dsc_t * blend_dsc, const glyph_span_t * spans,
+                        uint32_t cnt, int32_t y1, int32_t y2);
 
 #if LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 
@@ -63,6 +80,13 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cb(lv_draw_task_t * t, lv_dr
 /**********************
  *  STATIC VARIABLES
  **********************/
+static const uint8_t opa2_table[4] = {0, 85, 170, 255};
+
+static const uint8_t opa4_table[16] = {0,  17, 34,  51,
+                                       68, 85, 102, 119,
+                                       136, 153, 170, 187,
+                                       204, 221, 238, 255
+                                      };
 
 /**********************
  *  GLOBAL VARIABLES
@@ -168,8 +192,11 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
                             blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                             lv_draw_sw_blend(t, &blend_dsc);
                         }
+                        else if(draw_letter_packed(t, glyph_draw_dsc)) {
+                            /*Blended from the packed bitmap, nothing else to do*/
+                        }
                         else {
-                            glyph_draw_dsc->glyph_data = lv_font_get_glyph_bitmap(glyph_draw_dsc->g, glyph_draw_dsc->_draw_buf);
+                            glyph_draw_dsc->glyph_data = lv_draw_glyph_get_bitmap(glyph_draw_dsc);
                             if(glyph_draw_dsc->glyph_data == NULL) {
                                 LV_LOG_WARN("Couldn't get the bitmap of a glyph");
                                 break;
@@ -190,7 +217,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
                         }
                     }
                     else {
-                        glyph_draw_dsc->glyph_data = lv_font_get_glyph_bitmap(glyph_draw_dsc->g, glyph_draw_dsc->_draw_buf);
+                        glyph_draw_dsc->glyph_data = lv_draw_glyph_get_bitmap(glyph_draw_dsc);
                         lv_draw_image_dsc_t img_dsc;
                         lv_draw_image_dsc_init(&img_dsc);
                         img_dsc.rotation = glyph_draw_dsc->rotation;
@@ -224,6 +251,248 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_cb(lv_draw_task_t * t, lv_draw_gly
     }
 }
 
+/**
+ * Blend a glyph of a built-in font directly from its packed 1, 2 or 4 bpp bitmap,
+ * without converting it to an A8 draw buffer first.
+ * @param t                 pointer to a draw task
+ * @param glyph_draw_dsc    the glyph to draw
+ * @return                  true: the glyph is drawn; false: the glyph's bitmap is not packed
+ *                          in a supported format, it should be drawn as A8
+ */
+static bool LV_ATTRIBUTE_FAST_MEM draw_letter_packed(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_draw_dsc)
+{
+    lv_font_glyph_dsc_t * g = glyph_draw_dsc->g;
+    const lv_font_t * font = g->resolved_font;
+    if(font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) return false;
+
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) return false;
+    if(fdsc->bpp != 1 && fdsc->bpp != 2 && fdsc->bpp != 4) return false;
+
+    lv_area_t clip_area;
+    if(!lv_area_intersect(&clip_area, glyph_draw_dsc->letter_coords, &t->clip_area)) return true;
+    if(fdsc->bpp != 1 && lv_area_get_width(&clip_area) > GLYPH_MASK_BUF_SIZE) return false;
+
+    const uint8_t save_req = g->req_raw_bitmap;
+    g->req_raw_bitmap = 1;
+    const uint8_t * bitmap = font->get_glyph_bitmap(g, NULL);
+    g->req_raw_bitmap = save_req;
+    if(bitmap == NULL) return false;
+
+    /*The rows are either aligned to `stride` bytes or continue on the next bit*/
+    uint32_t row_bits = g->stride ? g->stride * 8 : (uint32_t)g->box_w * fdsc->bpp;
+    if(fdsc->bpp == 1) draw_letter_a1(t, glyph_draw_dsc, bitmap, row_bits, &clip_area);
+    else draw_letter_a2_a4(t, glyph_draw_dsc, bitmap, row_bits, fdsc->bpp, &clip_area);
+
+    return true;
+}
+
+/**
+ * Blend a 1 bpp glyph as spans of set pixels. The consecutive rows having the
+ * same spans (e.g. the vertical strokes of large digits) are blended together.
+ * @param t                 pointer to a draw task
+ * @param glyph_draw_dsc    the glyph to draw
+ * @param bitmap            the packed bitmap of the glyph
+ * @param row_bits          the distance of the rows in `bitmap` in bits
+ * @param clip_area         the part of the glyph to draw
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_a1(lv_draw_task_t * t, const lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                                                 const uint8_t * bitmap, uint32_t row_bits, const lv_area_t * clip_area)
+{
+    const lv_area_t * letter_coords = glyph_draw_dsc->letter_coords;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = glyph_draw_dsc->color;
+    /*Use the same opacity as an A8 mask of 0xFF pixels would result in*/
+    blend_dsc.opa = glyph_draw_dsc->opa >= LV_OPA_MAX ? glyph_draw_dsc->opa : LV_OPA_MIX2(LV_OPA_COVER, glyph_draw_dsc->opa);
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_FULL_COVER;
+
+    glyph_span_t span_buf[2][GLYPH_SPAN_MAX];
+    glyph_span_t * spans = span_buf[0];
+    glyph_span_t * next_spans = span_buf[1];
+    uint32_t bit_ofs = (clip_area->y1 - letter_coords->y1) * row_bits + (clip_area->x1 - letter_coords->x1);
+    int32_t x_next;
+    uint32_t cnt = get_a1_spans(bitmap, bit_ofs, clip_area->x1, clip_area->x2, spans, &x_next);
+
+    int32_t y = clip_area->y1;
+    while(1) {
+        if(x_next <= clip_area->x2) {
+            /*Too many spans in the row, blend them and continue the row*/
+            blend_spans(t, &blend_dsc, spans, cnt, y, y);
+            bit_ofs = (y - letter_coords->y1) * row_bits + (x_next - letter_coords->x1);
+            cnt = get_a1_spans(bitmap, bit_ofs, x_next, clip_area->x2, spans, &x_next);
+            continue;
+        }
+
+        /*Blend the rows below together if they have the same spans*/
+        int32_t y2 = y;
+        uint32_t next_cnt = 0;
+        int32_t next_x_next = clip_area->x2 + 1;
+        while(y2 < clip_area->y2) {
+            bit_ofs = (y2 + 1 - letter_coords->y1) * row_bits + (clip_area->x1 - letter_coords->x1);
+            next_cnt = get_a1_spans(bitmap, bit_ofs, clip_area->x1, clip_area->x2, next_spans, &next_x_next);
+            if(next_x_next <= clip_area->x2 || next_cnt != cnt) break;
+            if(cnt && lv_memcmp(spans, next_spans, cnt * sizeof(glyph_span_t)) != 0) break;
+            y2++;
+        }
+
+        blend_spans(t, &blend_dsc, spans, cnt, y, y2);
+        if(y2 >= clip_area->y2) break;
+
+        /*The next row's spans are already collected*/
+        glyph_span_t * tmp = spans;
+        spans = next_spans;
+        next_spans = tmp;
+        cnt = next_cnt;
+        x_next = next_x_next;
+        y = y2 + 1;
+    }
+}
+
+/**
+ * Blend a 2 or 4 bpp glyph by converting a few rows at once to opacities
+ * in a buffer on the stack.
+ * @param t                 pointer to a draw task
+ * @param glyph_draw_dsc    the glyph to draw
+ * @param bitmap            the packed bitmap of the glyph
+ * @param row_bits          the distance of the rows in `bitmap` in bits
+ * @param bpp               2 or 4
+ * @param clip_area         the part of the glyph to draw, at most `GLYPH_MASK_BUF_SIZE` wide
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_a2_a4(lv_draw_task_t * t, const lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                                                    const uint8_t * bitmap, uint32_t row_bits, uint32_t bpp,
+                                                    const lv_area_t * clip_area)
+{
+    const lv_area_t * letter_coords = glyph_draw_dsc->letter_coords;
+    const uint8_t * opa_table = bpp == 2 ? opa2_table : opa4_table;
+    const uint32_t bit_mask = (1 << bpp) - 1;
+    const int32_t w = lv_area_get_width(clip_area);
+    const int32_t row_cnt = GLYPH_MASK_BUF_SIZE / w;
+
+    uint8_t mask_buf[GLYPH_MASK_BUF_SIZE];
+    lv_area_t mask_area = *clip_area;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = glyph_draw_dsc->color;
+    blend_dsc.opa = glyph_draw_dsc->opa;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_area = &mask_area;
+    blend_dsc.mask_stride = w;
+    blend_dsc.blend_area = &mask_area;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+    int32_t y;
+    for(y = clip_area->y1; y <= clip_area->y2; y += row_cnt) {
+        mask_area.y1 = y;
+        mask_area.y2 = LV_MIN(y + row_cnt - 1, clip_area->y2);
+
+        uint8_t * mask_row = mask_buf;
+        int32_t row;
+        for(row = mask_area.y1; row <= mask_area.y2; row++) {
+            uint32_t bit_ofs = (row - letter_coords->y1) * row_bits + (clip_area->x1 - letter_coords->x1) * bpp;
+            int32_t x;
+            for(x = 0; x < w; x++) {
+                uint32_t shift = 8 - bpp - (bit_ofs & 0x7);
+                mask_row[x] = opa_table[(bitmap[bit_ofs >> 3] >> shift) & bit_mask];
+                bit_ofs += bpp;
+            }
+            mask_row += w;
+        }
+
+        lv_draw_sw_blend(t, &blend_dsc);
+    }
+}
+
+/**
+ * Collect the spans of set pixels from a row of a 1 bpp bitmap.
+ * Whole bytes of set or cleared pixels are skipped at once.
+ * @param bitmap    the packed bitmap
+ * @param bit_ofs   index of the bit belonging to `x`
+ * @param x         the first pixel to check
+ * @param x_max     the last pixel to check
+ * @param spans     store the spans here
+ * @param x_next    the first pixel not checked yet. It's greater than `x_max`
+ *                  unless there were more than `GLYPH_SPAN_MAX` spans.
+ * @return          the number of spans
+ */
+static uint32_t LV_ATTRIBUTE_FAST_MEM get_a1_spans(const uint8_t * bitmap, uint32_t bit_ofs, int32_t x, int32_t x_max,
+                                                   glyph_span_t * spans, int32_t * x_next)
+{
+    uint32_t cnt = 0;
+    while(x <= x_max) {
+        /*Skip the cleared pixels*/
+        while(x <= x_max) {
+            uint32_t i = bit_ofs & 0x7;
+            uint8_t bits = (uint8_t)(bitmap[bit_ofs >> 3] << i);
+            if(bits == 0) {
+                x += 8 - i;
+                bit_ofs += 8 - i;
+                continue;
+            }
+            while((bits & 0x80) == 0) {
+                bits <<= 1;
+                x++;
+                bit_ofs++;
+            }
+            break;
+        }
+        if(x > x_max) break;
+
+        if(cnt == GLYPH_SPAN_MAX) break;
+        spans[cnt].x1 = x;
+
+        /*Find the end of the set pixels. Shifting in zeros means "set pixels" here,
+         *so a byte ending in set pixels continues in the next byte*/
+        while(x <= x_max) {
+            uint32_t i = bit_ofs & 0x7;
+            uint8_t bits = (uint8_t)((uint8_t)~bitmap[bit_ofs >> 3] << i);
+            if(bits == 0) {
+                x += 8 - i;
+                bit_ofs += 8 - i;
+                continue;
+            }
+            while((bits & 0x80) == 0) {
+                bits <<= 1;
+                x++;
+                bit_ofs++;
+            }
+            break;
+        }
+        spans[cnt].x2 = LV_MIN(x - 1, x_max);
+        cnt++;
+    }
+
+    *x_next = x;
+    return cnt;
+}
+
+/**
+ * Fill the spans in the given rows.
+ * @param t         pointer to a draw task
+ * @param blend_dsc the blend descriptor with the color and opacity set
+ * @param spans     the spans to fill
+ * @param cnt       number of spans
+ * @param y1        the first row
+ * @param y2        the last row
+ */
+static void LV_ATTRIBUTE_FAST_MEM blend_spans(lv_draw_task_t * t, lv_draw_sw_blend_dsc_t * blend_dsc,
+                                              const glyph_span_t * spans, uint32_t cnt, int32_t y1, int32_t y2)
+{
+    lv_area_t span_area;
+    span_area.y1 = y1;
+    span_area.y2 = y2;
+    blend_dsc->blend_area = &span_area;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        span_area.x1 = spans[i].x1;
+        span_area.x2 = spans[i].x2;
+        lv_draw_sw_blend(t, blend_dsc);
+    }
+}
+
 #if LV_USE_FREETYPE && LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 
 /*
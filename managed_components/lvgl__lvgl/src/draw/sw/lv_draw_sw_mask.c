@@ -15,21 +15,24 @@
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_log.h"
 #include "../../misc/lv_assert.h"
-#include "../../osal/lv_os_private.h"
 #include "../../stdlib/lv_string.h"
+#include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
  *********************/
-#define CIRCLE_CACHE_LIFE_MAX           1000
-#define CIRCLE_CACHE_AGING(life, r)     life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
-#define circle_cache_mutex              LV_GLOBAL_DEFAULT()->draw_info.circle_cache_mutex
-#define _circle_cache                   LV_GLOBAL_DEFAULT()->sw_circle_cache
+#define CACHE_NAME      "SW_MASK"
+#define mask_cache_p    (LV_GLOBAL_DEFAULT()->sw_mask_cache)
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    lv_draw_sw_mask_cache_create_cb_t create_cb;
+    void * user_data;
+} mask_cache_create_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -65,6 +68,11 @@ static void circ_calc_aa4(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radiu
 static lv_opa_t * get_next_line(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t y, int32_t * len,
                                 int32_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+static bool circle_create_cb(lv_draw_sw_mask_cache_data_t * data, void * user_data);
+static lv_cache_compare_res_t mask_cache_compare_cb(const lv_draw_sw_mask_cache_data_t * lhs,
+                                                    const lv_draw_sw_mask_cache_data_t * rhs);
+static bool mask_cache_create_cb(lv_draw_sw_mask_cache_data_t * data, mask_cache_create_dsc_t * create_dsc);
+static void mask_cache_free_cb(lv_draw_sw_mask_cache_data_t * data, void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -80,12 +88,19 @@ static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, l
 
 void lv_draw_sw_mask_init(void)
 {
-    lv_mutex_init(&circle_cache_mutex);
+    mask_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_draw_sw_mask_cache_data_t), LV_DRAW_SW_MASK_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)mask_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)mask_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)mask_cache_free_cb,
+    });
+    lv_cache_set_name(mask_cache_p, CACHE_NAME);
 }
 
 void lv_draw_sw_mask_deinit(void)
 {
-    lv_mutex_delete(&circle_cache_mutex);
+    lv_cache_destroy(mask_cache_p, NULL);
+    mask_cache_p = NULL;
 }
 
 lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[], lv_opa_t * mask_buf, int32_t abs_x,
@@ -109,33 +124,44 @@ lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[]
 
 void lv_draw_sw_mask_free_param(void * p)
 {
-    lv_mutex_lock(&circle_cache_mutex);
     lv_draw_sw_mask_common_dsc_t * pdsc = p;
     if(pdsc->type == LV_DRAW_SW_MASK_TYPE_RADIUS) {
         lv_draw_sw_mask_radius_param_t * radius_p = (lv_draw_sw_mask_radius_param_t *) p;
         if(radius_p->circle) {
-            if(radius_p->circle->life < 0) {
-                lv_free(radius_p->circle->cir_opa);
+            if(radius_p->circle->cache_entry == NULL) {
+                lv_free(radius_p->circle->buf);
                 lv_free(radius_p->circle);
             }
             else {
-                radius_p->circle->used_cnt--;
+                lv_draw_sw_mask_cache_release(radius_p->circle->cache_entry);
             }
+            radius_p->circle = NULL;
         }
     }
+}
 
-    lv_mutex_unlock(&circle_cache_mutex);
+lv_cache_entry_t * lv_draw_sw_mask_cache_acquire_or_create(const lv_draw_sw_mask_cache_data_t * key,
+                                                           lv_draw_sw_mask_cache_create_cb_t create_cb,
+                                                           void * user_data)
+{
+    /*Don't let a single large shadow evict everything else*/
+    if(key->slot.size > lv_cache_get_max_size(mask_cache_p, NULL) / 4) return NULL;
+
+    mask_cache_create_dsc_t create_dsc = {
+        .create_cb = create_cb,
+        .user_data = user_data,
+    };
+    return lv_cache_acquire_or_create(mask_cache_p, key, &create_dsc);
 }
 
-void lv_draw_sw_mask_cleanup(void)
+void lv_draw_sw_mask_cache_release(lv_cache_entry_t * entry)
 {
-    uint8_t i;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].buf) {
-            lv_free(_circle_cache[i].buf);
-        }
-        lv_memzero(&(_circle_cache[i]), sizeof(_circle_cache[i]));
-    }
+    lv_cache_release(mask_cache_p, entry, NULL);
+}
+
+void lv_draw_sw_mask_cache_get_hit_stats(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    lv_cache_get_hit_stats(mask_cache_p, hit_cnt, miss_cnt);
 }
 
 void lv_draw_sw_mask_line_points_init(lv_draw_sw_mask_line_param_t * param, int32_t p1x, int32_t p1y,
@@ -311,47 +337,23 @@ void lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t * param, const l
         return;
     }
 
-    lv_mutex_lock(&circle_cache_mutex);
+    lv_draw_sw_mask_cache_data_t key = {
+        .slot.size = sizeof(lv_draw_sw_mask_cache_data_t) + radius * 6 + 6,
+        .type = LV_DRAW_SW_MASK_CACHE_CIRCLE,
+        .radius = radius,
+    };
 
-    uint32_t i;
-
-    /*Try to reuse a circle cache entry*/
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].radius == radius) {
-            _circle_cache[i].used_cnt++;
-            CIRCLE_CACHE_AGING(_circle_cache[i].life, radius);
-            param->circle = &(_circle_cache[i]);
-            lv_mutex_unlock(&circle_cache_mutex);
-            return;
-        }
-    }
-
-    /*If not cached use the free entry with lowest life*/
-    lv_draw_sw_mask_radius_circle_dsc_t * entry = NULL;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].used_cnt == 0) {
-            if(!entry) entry = &(_circle_cache[i]);
-            else if(_circle_cache[i].life < entry->life) entry = &(_circle_cache[i]);
-        }
-    }
-
-    /*There is no unused entry. Allocate one temporarily*/
-    if(!entry) {
-        entry = lv_malloc_zeroed(sizeof(lv_draw_sw_mask_radius_circle_dsc_t));
-        LV_ASSERT_MALLOC(entry);
-        entry->life = -1;
-    }
-    else {
-        entry->used_cnt++;
-        entry->life = 0;
-        CIRCLE_CACHE_AGING(entry->life, radius);
+    lv_cache_entry_t * entry = lv_draw_sw_mask_cache_acquire_or_create(&key, circle_create_cb, NULL);
+    if(entry) {
+        lv_draw_sw_mask_cache_data_t * data = lv_cache_entry_get_data(entry);
+        param->circle = &data->circle;
+        return;
     }
 
-    param->circle = entry;
-
+    /*The circle can't be cached. Allocate one temporarily*/
+    param->circle = lv_malloc_zeroed(sizeof(lv_draw_sw_mask_radius_circle_dsc_t));
+    LV_ASSERT_MALLOC(param->circle);
     circ_calc_aa4(param->circle, radius);
-    lv_mutex_unlock(&circle_cache_mutex);
-
 }
 
 void lv_draw_sw_mask_fade_init(lv_draw_sw_mask_fade_param_t * param, const lv_area_t * coords, lv_opa_t opa_top,
@@ -1234,4 +1236,38 @@ static inline lv_opa_t LV_ATTRIBUTE_FAST_MEM mask_mix(lv_opa_t mask_act, lv_opa_
     return LV_UDIV255(mask_act * mask_new);
 }
 
+static bool circle_create_cb(lv_draw_sw_mask_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    circ_calc_aa4(&data->circle, data->radius);
+    return data->circle.buf != NULL;
+}
+
+static lv_cache_compare_res_t mask_cache_compare_cb(const lv_draw_sw_mask_cache_data_t * lhs,
+                                                    const lv_draw_sw_mask_cache_data_t * rhs)
+{
+    if(lhs->type != rhs->type) return lhs->type > rhs->type ? 1 : -1;
+    if(lhs->radius != rhs->radius) return lhs->radius > rhs->radius ? 1 : -1;
+    if(lhs->width != rhs->width) return lhs->width > rhs->width ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+    return 0;
+}
+
+static bool mask_cache_create_cb(lv_draw_sw_mask_cache_data_t * data, mask_cache_create_dsc_t * create_dsc)
+{
+    lv_memzero(&data->circle, sizeof(data->circle));
+    data->shadow_corner = NULL;
+    data->circle.cache_entry = lv_cache_entry_get_entry(data, mask_cache_p->node_size);
+
+    return create_dsc->create_cb(data, create_dsc->user_data);
+}
+
+static void mask_cache_free_cb(lv_draw_sw_mask_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->circle.buf);
+    lv_free(data->shadow_corner);
+}
+
 #endif /*LV_DRAW_SW_COMPLEX*/
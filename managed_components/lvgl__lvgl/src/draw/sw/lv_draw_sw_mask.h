@@ -98,6 +98,14 @@ lv_draw_sw_mask_res_t /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_mask_apply(void * m
  */
 void lv_draw_sw_mask_free_param(void * p);
 
+/**
+ * Get how many times the circles of the radius masks and the blurred corners of the box shadows
+ * were found in the mask cache, and how many times they had to be calculated.
+ * @param hit_cnt   store the number of cache hits here
+ * @param miss_cnt  store the number of cache misses here
+ */
+void lv_draw_sw_mask_cache_get_hit_stats(uint32_t * hit_cnt, uint32_t * miss_cnt);
+
 /**
  *Initialize a line mask from two points.
  * @param param pointer to a `lv_draw_mask_param_t` to initialize
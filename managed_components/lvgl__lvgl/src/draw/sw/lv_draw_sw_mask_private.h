@@ -18,6 +18,8 @@ extern "C" {
 
 #if LV_DRAW_SW_COMPLEX
 
+#include "../../misc/cache/lv_cache_private.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -31,11 +33,40 @@ typedef struct  {
     lv_opa_t * cir_opa;         /**< Opacity of values on the circumference of an 1/4 circle */
     uint16_t * x_start_on_y;    /**< The x coordinate of the circle for each y value */
     uint16_t * opa_start_on_y;  /**< The index of `cir_opa` for each y value */
-    int32_t life;               /**< How many times the entry way used */
-    uint32_t used_cnt;          /**< Like a semaphore to count the referencing masks */
+    lv_cache_entry_t * cache_entry; /**< The entry of the mask cache holding it, or `NULL` if it's not cached */
     int32_t radius;             /**< The radius of the entry */
 } lv_draw_sw_mask_radius_circle_dsc_t;
 
+typedef enum {
+    LV_DRAW_SW_MASK_CACHE_CIRCLE,   /**< Anti-aliased 1/4 circle of radius masks */
+    LV_DRAW_SW_MASK_CACHE_SHADOW,   /**< Blurred corner of box shadows */
+} lv_draw_sw_mask_cache_type_t;
+
+/**
+ * An entry of the mask cache. The fields until `h` are the key, the others are set when the entry is created.
+ */
+typedef struct {
+    lv_cache_slot_size_t slot;          /**< Size of the entry in bytes */
+    lv_draw_sw_mask_cache_type_t type;
+    int32_t radius;
+    int32_t width;                      /**< Blur width of shadows, 0 for circles */
+    int32_t w;                          /**< Clamped size of the area a shadow is blurred from (spread included),
+                                         *   0 for circles */
+    int32_t h;
+
+    lv_draw_sw_mask_radius_circle_dsc_t circle; /**< The circle of circle entries */
+    lv_opa_t * shadow_corner;                   /**< `(width + radius)^2` opacities of shadow entries,
+                                                 *   followed by their horizontally mirrored version */
+} lv_draw_sw_mask_cache_data_t;
+
+/**
+ * Calculate the data of an entry which is not in the mask cache yet.
+ * @param data          the entry with its key set. Set `circle` or `shadow_corner` here.
+ * @param user_data     the `user_data` passed to lv_draw_sw_mask_cache_acquire_or_create()
+ * @return              true on success
+ */
+typedef bool (*lv_draw_sw_mask_cache_create_cb_t)(lv_draw_sw_mask_cache_data_t * data, void * user_data);
+
 struct _lv_draw_sw_mask_common_dsc_t {
     lv_draw_sw_mask_xcb_t cb;
     lv_draw_sw_mask_type_t type;
@@ -132,17 +163,29 @@ struct _lv_draw_sw_mask_map_param_t {
     } cfg;
 };
 
-typedef lv_draw_sw_mask_radius_circle_dsc_t lv_draw_sw_mask_radius_circle_dsc_arr_t[LV_DRAW_SW_CIRCLE_CACHE_SIZE];
-
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 /**
- * Called by LVGL the rendering of a screen is ready to clean up
- * the temporal (cache) data of the masks
+ * Get an entry from the mask cache, or create and add it if it's not cached yet.
+ * The circles of the radius masks and the corners of the box shadows share the cache,
+ * which holds at most `LV_DRAW_SW_MASK_CACHE_SIZE` bytes.
+ * @param key           the type, radius, width, w and h of the entry, and its size in `slot.size`
+ * @param create_cb     called to calculate the data if the entry is not cached
+ * @param user_data     passed to `create_cb`
+ * @return              the acquired entry, or `NULL` if it can't be cached (e.g. it's too large).
+ *                      Release it with lv_draw_sw_mask_cache_release().
+ */
+lv_cache_entry_t * lv_draw_sw_mask_cache_acquire_or_create(const lv_draw_sw_mask_cache_data_t * key,
+                                                           lv_draw_sw_mask_cache_create_cb_t create_cb,
+                                                           void * user_data);
+
+/**
+ * Release an entry acquired by lv_draw_sw_mask_cache_acquire_or_create().
+ * @param entry         the cache entry
  */
-void lv_draw_sw_mask_cleanup(void);
+void lv_draw_sw_mask_cache_release(lv_cache_entry_t * entry);
 
 /**********************
  *      MACROS
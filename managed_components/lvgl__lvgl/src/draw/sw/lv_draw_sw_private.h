@@ -23,6 +23,13 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_DRAW_SW_USE_TILE_SPLIT   (LV_DRAW_SW_TILE_SPLIT && LV_USE_OS && LV_DRAW_SW_DRAW_UNIT_CNT > 1)
+
+#if LV_DRAW_SW_USE_TILE_SPLIT
+/** Max. number of bands a draw task is split into*/
+#define LV_DRAW_SW_TILE_SPLIT_BAND_MAX  (LV_DRAW_SW_DRAW_UNIT_CNT * 2)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -31,6 +38,14 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_USE_TILE_SPLIT
+typedef struct {
+    lv_draw_task_t * task;
+    int32_t y1;
+    int32_t y2;
+} lv_draw_sw_band_t;
+#endif
+
 typedef struct {
     lv_draw_task_t * task_act;
     lv_thread_t thread;
@@ -39,25 +54,26 @@ typedef struct {
     uint32_t idx;
     volatile bool inited;
     volatile bool exit_status;
+#if LV_DRAW_SW_USE_TILE_SPLIT
+    /** Bands of `task_act`. The thread takes them from the end, the other threads steal from the start.*/
+    lv_draw_sw_band_t bands[LV_DRAW_SW_TILE_SPLIT_BAND_MAX];
+    uint32_t band_start;
+    uint32_t band_end;
+    uint32_t band_remaining;    /**< Number of not finished bands, including the stolen ones*/
+    lv_mutex_t band_mutex;      /**< Protects the bands and the counters*/
+#endif
 } lv_draw_sw_thread_dsc_t;
 
 struct _lv_draw_sw_unit_t {
     lv_draw_unit_t base_unit;
 #if LV_USE_OS
     lv_draw_sw_thread_dsc_t thread_dscs[LV_DRAW_SW_DRAW_UNIT_CNT];
+    uint32_t thread_cnt;    /**< Number of threads to use, at most `LV_DRAW_SW_DRAW_UNIT_CNT`*/
 #else
     lv_draw_task_t * task_act;
 #endif
 };
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
-} lv_draw_sw_shadow_cache_t;
-#endif
-
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -64,6 +64,10 @@
     #define LV_DRAW_SW_ROTATE270_L8(...) LV_RESULT_INVALID
 #endif
 
+/*Side length of the square blocks used by the 90 and 270 degree rotations.
+ *A block's source rows and destination rows both stay in the cache while it's transposed.*/
+#define ROTATE_TILE_SIZE 32
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -360,12 +364,17 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t by = 0; by < src_height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint32_t * d = dst + x * dst_stride + (src_height - 1);
+                const uint32_t * s = src + x;
+                for(int32_t y = by; y < y_end; ++y) {
+                    d[-y] = s[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -400,12 +409,17 @@ static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t by = 0; by < src_height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint32_t * d = dst + (src_width - x - 1) * dst_stride;
+                const uint32_t * s = src + x;
+                for(int32_t y = by; y < y_end; ++y) {
+                    d[y] = s[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -422,13 +436,19 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        for(int32_t y = 0; y < src_height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t by = 0; by < src_height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint8_t * d = dst + (src_width - x - 1) * dst_stride;
+                for(int32_t y = by; y < y_end; ++y) {
+                    int32_t srcIndex = y * src_stride + x * 3;
+                    d[y * 3] = src[srcIndex];           /*Red*/
+                    d[y * 3 + 1] = src[srcIndex + 1];   /*Green*/
+                    d[y * 3 + 2] = src[srcIndex + 2];   /*Blue*/
+                }
+            }
         }
     }
 }
@@ -458,13 +478,20 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = x * dst_stride + (height - y - 1) * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
+    for(int32_t by = 0; by < height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, height);
+        for(int32_t bx = 0; bx < width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint8_t * d = dst + x * dst_stride;
+                for(int32_t y = by; y < y_end; ++y) {
+                    int32_t srcIndex = y * src_stride + x * 3;
+                    int32_t dstIndex = (height - y - 1) * 3;
+                    d[dstIndex] = src[srcIndex];           /*Red*/
+                    d[dstIndex + 1] = src[srcIndex + 1];   /*Green*/
+                    d[dstIndex + 2] = src[srcIndex + 2];   /*Blue*/
+                }
+            }
         }
     }
 }
@@ -484,12 +511,17 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t by = 0; by < src_height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint16_t * d = dst + x * dst_stride + (src_height - 1);
+                const uint16_t * s = src + x;
+                for(int32_t y = by; y < y_end; ++y) {
+                    d[-y] = s[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -524,12 +556,17 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_wi
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t by = 0; by < src_height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint16_t * d = dst + (src_width - x - 1) * dst_stride;
+                const uint16_t * s = src + x;
+                for(int32_t y = by; y < y_end; ++y) {
+                    d[y] = s[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -547,12 +584,17 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t by = 0; by < src_height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint8_t * d = dst + (src_width - x - 1) * dst_stride;
+                const uint8_t * s = src + x;
+                for(int32_t y = by; y < y_end; ++y) {
+                    d[y] = s[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -581,12 +623,17 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
+    for(int32_t by = 0; by < src_height; by += ROTATE_TILE_SIZE) {
+        int32_t y_end = LV_MIN(by + ROTATE_TILE_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_TILE_SIZE) {
+            int32_t x_end = LV_MIN(bx + ROTATE_TILE_SIZE, src_width);
+            for(int32_t x = bx; x < x_end; ++x) {
+                uint8_t * d = dst + x * dst_stride + (src_height - 1);
+                const uint8_t * s = src + x;
+                for(int32_t y = by; y < y_end; ++y) {
+                    d[-y] = s[y * src_stride];
+                }
+            }
         }
     }
 }
@@ -507,6 +507,10 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
         stride = new_buf->header.stride;
     }
     Tvg_Canvas * canvas = tvg_swcanvas_create();
+#if LV_DRAW_SW_DRAW_UNIT_CNT > 1
+    /*The shared memory pool would be used by the draw units at the same time*/
+    tvg_swcanvas_set_mempool(canvas, TVG_MEMPOOL_POLICY_INDIVIDUAL);
+#endif
     tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
 
     _tvg_rect rc;
@@ -176,7 +176,7 @@ static void draw_letter_cb(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_draw_
                         }
                     }
                     else {
-                        glyph_draw_dsc->glyph_data = lv_font_get_glyph_bitmap(glyph_draw_dsc->g, glyph_draw_dsc->_draw_buf);
+                        glyph_draw_dsc->glyph_data = lv_draw_glyph_get_bitmap(glyph_draw_dsc);
                         if(!glyph_draw_dsc->glyph_data) {
                             return;
                         }
@@ -202,7 +202,7 @@ static void draw_letter_cb(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_draw_
 #endif /* LV_USE_FREETYPE */
 
             case LV_FONT_GLYPH_FORMAT_IMAGE: {
-                    glyph_draw_dsc->glyph_data = lv_font_get_glyph_bitmap(glyph_draw_dsc->g, glyph_draw_dsc->_draw_buf);
+                    glyph_draw_dsc->glyph_data = lv_draw_glyph_get_bitmap(glyph_draw_dsc);
                     if(!glyph_draw_dsc->glyph_data) {
                         return;
                     }
@@ -372,6 +372,7 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         search_key.src_type = dsc->src_type;
         search_key.src = dsc->src;
         search_key.slot.size = dsc->decoded->data_size;
+        search_key.slot.cost = lv_image_decoder_get_time_to_open(dsc);
 
         lv_cache_entry_t * entry = lv_image_decoder_add_to_cache(decoder, &search_key, dsc->decoded, NULL);
 
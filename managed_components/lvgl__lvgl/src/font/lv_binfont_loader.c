@@ -137,6 +137,10 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    /*The glyph cache and the lookup tables might still refer to the data of this font*/
+    lv_font_fmt_txt_glyph_cache_drop();
+    lv_font_fmt_txt_lookup_remove(font);
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
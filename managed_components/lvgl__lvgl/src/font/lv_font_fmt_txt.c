@@ -13,6 +13,7 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
 #include "../stdlib/lv_mem.h"
 
 /*********************
@@ -22,6 +23,28 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#define glyph_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache
+
+#define GLYPH_CACHE_NAME "FONT_FMT_TXT_GLYPH"
+
+#define lookup_info LV_GLOBAL_DEFAULT()->font_fmt_txt_lookup
+
+#define LOOKUP_PAGE_SIZE        256
+#define LOOKUP_KERN_NOT_BUILT   0
+#define LOOKUP_KERN_BUILT       1
+#define LOOKUP_KERN_UNAVAILABLE 2
+
+/*The lookup tables are read without locking. Whatever makes them visible to the readers (the list of
+ *lookups, the pages and the state of the kerning matrix) is published with release and read with acquire
+ *ordering, so another core never sees a table before the data it points to.*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define LOAD_ACQUIRE(p)         __atomic_load_n(p, __ATOMIC_ACQUIRE)
+    #define STORE_RELEASE(p, v)     __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#else
+    #define LOAD_ACQUIRE(p)         (*(p))
+    #define STORE_RELEASE(p, v)     (*(p) = (v))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,14 +53,38 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_font_t * font;
+    uint32_t gid;
+    uint32_t format;
+    lv_draw_buf_t * draw_buf;
+} glyph_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static const uint16_t * lookup_get_page(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t page_id);
+static const lv_font_fmt_txt_lookup_t * lookup_get_kern(const lv_font_fmt_txt_dsc_t * fdsc);
+static lv_font_fmt_txt_lookup_t * lookup_find(const lv_font_fmt_txt_dsc_t * fdsc);
+static lv_font_fmt_txt_lookup_t * lookup_get_or_create(const lv_font_fmt_txt_dsc_t * fdsc);
+static const uint16_t * lookup_build_page(lv_font_fmt_txt_lookup_t * lookup, uint32_t page_id);
+static bool lookup_fill_page(uint16_t * page, uint32_t page_start, const lv_font_fmt_txt_cmap_t * cmap);
+static bool lookup_build_kern(lv_font_fmt_txt_lookup_t * lookup);
+static void * lookup_alloc(lv_font_fmt_txt_lookup_t * lookup, uint32_t size);
+static void lookup_free(lv_font_fmt_txt_lookup_t * lookup, void * p, uint32_t size);
+static void lookup_delete(lv_font_fmt_txt_lookup_t * lookup);
+static void lookup_delete_all(void);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
+static lv_draw_buf_t * glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc);
+static bool glyph_cache_create_cb(glyph_cache_data_t * node, const lv_font_glyph_dsc_t * g_dsc);
+static void glyph_cache_free_cb(glyph_cache_data_t * node, void * user_data);
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
@@ -68,6 +115,12 @@ static const uint8_t opa3_table[8] = {0, 36, 73, 109, 146, 182, 218, 255};
 
 static const uint8_t opa2_table[4] = {0, 85, 170, 255};
 
+/*Used for the lookup pages without any glyphs*/
+static const uint16_t lookup_page_empty[LOOKUP_PAGE_SIZE];
+
+/*Marks the lookup pages which couldn't be built, e.g. because of the memory budget*/
+static const uint16_t lookup_page_unavailable[1];
+
 const lv_font_class_t lv_builtin_font_class = {
     .create_cb = builtin_font_create_cb,
     .delete_cb = builtin_font_delete_cb,
@@ -103,8 +156,13 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    uint32_t stride_in = g_dsc->stride;
+    /*Use the glyph expanded earlier if possible*/
+    if(g_dsc->entry == NULL && glyph_cache.cache && lv_cache_is_enabled(glyph_cache.cache)) {
+        lv_draw_buf_t * cached_buf = glyph_cache_acquire(g_dsc);
+        if(cached_buf) return cached_buf;
+    }
 
+    uint32_t stride_in = g_dsc->stride;
 
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
         const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
@@ -276,16 +334,196 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(glyph_cache.cache, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+void lv_font_fmt_txt_glyph_cache_init(uint32_t size)
+{
+    if(glyph_cache.cache != NULL) return;
+
+    glyph_cache.cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(glyph_cache_data_t), size,
+    (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+    });
+    lv_cache_set_name(glyph_cache.cache, GLYPH_CACHE_NAME);
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+    if(glyph_cache.cache == NULL) return;
+
+    lv_cache_destroy(glyph_cache.cache, NULL);
+    glyph_cache.cache = NULL;
+}
+
+void lv_font_fmt_txt_glyph_cache_resize(uint32_t size)
+{
+    if(glyph_cache.cache == NULL) return;
+
+    lv_cache_set_max_size(glyph_cache.cache, size, NULL);
+    lv_cache_reserve(glyph_cache.cache, size, NULL);
+}
+
+void lv_font_fmt_txt_glyph_cache_drop(void)
+{
+    if(glyph_cache.cache == NULL) return;
+
+    lv_cache_drop_all(glyph_cache.cache, NULL);
+}
+
+void lv_font_fmt_txt_glyph_cache_get_stats(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    /*Counted by the cache while it's locked*/
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    if(glyph_cache.cache) lv_cache_get_hit_stats(glyph_cache.cache, &hits, &misses);
+
+    if(hit_cnt) *hit_cnt = hits;
+    if(miss_cnt) *miss_cnt = misses;
+}
+
+void lv_font_fmt_txt_lookup_init(uint32_t mem_budget)
+{
+    lv_mutex_init(&lookup_info.lock);
+    lookup_info.head = NULL;
+    lookup_info.mem_size = 0;
+    lookup_info.mem_budget = mem_budget;
+}
+
+void lv_font_fmt_txt_lookup_deinit(void)
+{
+    lookup_delete_all();
+    lookup_info.mem_budget = 0;
+    lv_mutex_delete(&lookup_info.lock);
+}
+
+void lv_font_fmt_txt_lookup_remove(const lv_font_t * font)
+{
+    if(font == NULL || font->dsc == NULL) return;
+
+    lv_mutex_lock(&lookup_info.lock);
+    lv_font_fmt_txt_lookup_t ** link = &lookup_info.head;
+    while(*link) {
+        if((*link)->fdsc == font->dsc) {
+            lv_font_fmt_txt_lookup_t * lookup = *link;
+            STORE_RELEASE(link, lookup->next);
+            lookup_delete(lookup);
+            break;
+        }
+        link = &(*link)->next;
+    }
+    lv_mutex_unlock(&lookup_info.lock);
+}
+
+void lv_font_fmt_txt_lookup_set_mem_budget(uint32_t mem_budget)
+{
+    /*The tables are read without locking, so they can be freed only if nothing is being rendered*/
+    lookup_delete_all();
+    lookup_info.mem_budget = mem_budget;
+}
+
+uint32_t lv_font_fmt_txt_lookup_get_mem_size(void)
+{
+    return lookup_info.mem_size;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_draw_buf_t * glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc)
+{
+    const lv_font_t * font = g_dsc->resolved_font;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[g_dsc->gid.index];
+
+    glyph_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h +
+                           sizeof(lv_draw_buf_t);
+    search_key.font = font;
+    search_key.gid = g_dsc->gid.index;
+    search_key.format = g_dsc->format;
+
+    /*A glyph larger than the whole cache is only looked up, so that it's counted as a miss
+     *without evicting the other glyphs*/
+    lv_cache_entry_t * entry;
+    if(search_key.slot.size > lv_cache_get_max_size(glyph_cache.cache, NULL)) {
+        entry = lv_cache_acquire(glyph_cache.cache, &search_key, NULL);
+    }
+    else {
+        entry = lv_cache_acquire_or_create(glyph_cache.cache, &search_key, g_dsc);
+    }
+
+    /*E.g. too large or out of memory. The glyph will be expanded into the draw buffer of the caller.*/
+    if(entry == NULL) return NULL;
+
+    g_dsc->entry = entry;
+    glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->draw_buf;
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * node, const lv_font_glyph_dsc_t * g_dsc)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = node->font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[node->gid];
+
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(lv_draw_buf_get_font_handlers(), gdsc->box_w, gdsc->box_h,
+                                                     LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) return false;
+
+    /*With `entry` set the glyph is not looked up in the cache again, just expanded*/
+    lv_font_glyph_dsc_t expand_dsc = *g_dsc;
+    expand_dsc.entry = lv_cache_entry_get_entry(node, glyph_cache.cache->node_size);
+    if(lv_font_get_bitmap_fmt_txt(&expand_dsc, draw_buf) == NULL) {
+        lv_draw_buf_destroy(draw_buf);
+        return false;
+    }
+
+    node->draw_buf = draw_buf;
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_buf_destroy(node->draw_buf);
+    node->draw_buf = NULL;
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->font != rhs->font) return lhs->font > rhs->font ? 1 : -1;
+    if(lhs->gid != rhs->gid) return lhs->gid > rhs->gid ? 1 : -1;
+    if(lhs->format != rhs->format) return lhs->format > rhs->format ? 1 : -1;
+    return 0;
+}
+
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+    /*The BMP code points can be looked up from tables without searching*/
+    if(letter <= 0xFFFF && lookup_info.mem_budget > 0) {
+        const uint16_t * page = lookup_get_page(fdsc, letter >> 8);
+        if(page) return page[letter & 0xFF];
+    }
+
+    return find_glyph_dsc_id(fdsc, letter);
+}
 
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -330,7 +568,6 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
     }
 
     return 0;
-
 }
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
@@ -341,6 +578,20 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
 
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
+        if(lookup_info.mem_budget > 0) {
+            /*The pairs converted to a matrix*/
+            const lv_font_fmt_txt_lookup_t * lookup = lookup_get_kern(fdsc);
+            if(lookup) {
+                if(gid_left >= lookup->kern_glyph_cnt || gid_right >= lookup->kern_glyph_cnt) return 0;
+
+                uint32_t left_class = lookup->kern_left_class[gid_left];
+                uint32_t right_class = lookup->kern_right_class[gid_right];
+                if(left_class == 0 || right_class == 0) return 0;
+
+                return lookup->kern_values[(left_class - 1) * lookup->kern_right_class_cnt + (right_class - 1)];
+            }
+        }
+
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
         if(kdsc->glyph_ids_size == 0) {
             /*Use binary search to find the kern value.
@@ -389,6 +640,326 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+/**
+ * Get a page of the glyph ID lookup table of a font. Build it if it doesn't exist yet.
+ * @param fdsc      the font descriptor
+ * @param page_id   the code point divided by the page size
+ * @return          the glyph IDs of the code points of the page or NULL if the page is not available
+ */
+static const uint16_t * lookup_get_page(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t page_id)
+{
+    /*Lock free if the page is already built as the tables are only added to the list when they are ready*/
+    const lv_font_fmt_txt_lookup_t * lookup = lookup_find(fdsc);
+    const uint16_t * page = lookup ? LOAD_ACQUIRE(&lookup->pages[page_id]) : NULL;
+
+    if(page == NULL) {
+        /*Don't lock again and again if even the lookup structure doesn't fit*/
+        if(lookup == NULL && lookup_info.mem_size + sizeof(lv_font_fmt_txt_lookup_t) > lookup_info.mem_budget) return NULL;
+
+        lv_mutex_lock(&lookup_info.lock);
+        lv_font_fmt_txt_lookup_t * lookup_rw = lookup_get_or_create(fdsc);
+        if(lookup_rw) {
+            page = lookup_rw->pages[page_id];
+            if(page == NULL) {
+                page = lookup_build_page(lookup_rw, page_id);
+                STORE_RELEASE(&lookup_rw->pages[page_id], page);
+            }
+        }
+        lv_mutex_unlock(&lookup_info.lock);
+    }
+
+    return page == lookup_page_unavailable ? NULL : page;
+}
+
+/**
+ * Get the lookup tables of a font with the kern pairs converted to a matrix.
+ * @param fdsc      the font descriptor
+ * @return          the lookup tables or NULL if the kerning matrix is not available
+ */
+static const lv_font_fmt_txt_lookup_t * lookup_get_kern(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    const lv_font_fmt_txt_lookup_t * lookup = lookup_find(fdsc);
+
+    uint8_t kern_state = lookup ? LOAD_ACQUIRE(&lookup->kern_state) : LOOKUP_KERN_NOT_BUILT;
+    if(kern_state == LOOKUP_KERN_NOT_BUILT) {
+        if(lookup == NULL && lookup_info.mem_size + sizeof(lv_font_fmt_txt_lookup_t) > lookup_info.mem_budget) return NULL;
+
+        lv_mutex_lock(&lookup_info.lock);
+        lv_font_fmt_txt_lookup_t * lookup_rw = lookup_get_or_create(fdsc);
+        if(lookup_rw && lookup_rw->kern_state == LOOKUP_KERN_NOT_BUILT) {
+            STORE_RELEASE(&lookup_rw->kern_state,
+                          lookup_build_kern(lookup_rw) ? LOOKUP_KERN_BUILT : LOOKUP_KERN_UNAVAILABLE);
+        }
+        lookup = lookup_rw;
+        kern_state = lookup_rw ? lookup_rw->kern_state : LOOKUP_KERN_UNAVAILABLE;
+        lv_mutex_unlock(&lookup_info.lock);
+    }
+
+    return kern_state == LOOKUP_KERN_BUILT ? lookup : NULL;
+}
+
+static lv_font_fmt_txt_lookup_t * lookup_find(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_lookup_t * lookup = LOAD_ACQUIRE(&lookup_info.head);
+    while(lookup && lookup->fdsc != fdsc) {
+        lookup = LOAD_ACQUIRE(&lookup->next);
+    }
+
+    return lookup;
+}
+
+/**
+ * Get the lookup tables of a font or add new, empty tables if there are none.
+ * Needs to be called with `lookup_info.lock` taken.
+ */
+static lv_font_fmt_txt_lookup_t * lookup_get_or_create(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    lv_font_fmt_txt_lookup_t * lookup = lookup_find(fdsc);
+    if(lookup) return lookup;
+
+    lookup = lookup_alloc(NULL, sizeof(lv_font_fmt_txt_lookup_t));
+    if(lookup == NULL) return NULL;
+
+    lookup->fdsc = fdsc;
+    lookup->mem_size = sizeof(lv_font_fmt_txt_lookup_t);
+
+    /*Add it to the list only when it's initialized as the list is read without locking*/
+    lookup->next = lookup_info.head;
+    STORE_RELEASE(&lookup_info.head, lookup);
+
+    return lookup;
+}
+
+/**
+ * Create a page of the glyph ID lookup table
+ * @param lookup    the lookup tables of the font
+ * @param page_id   the code point divided by the page size
+ * @return          the new page, `lookup_page_empty` or `lookup_page_unavailable`
+ */
+static const uint16_t * lookup_build_page(lv_font_fmt_txt_lookup_t * lookup, uint32_t page_id)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = lookup->fdsc;
+    uint32_t page_start = page_id * LOOKUP_PAGE_SIZE;
+
+    /*Most pages of the BMP have no glyphs at all, they don't need memory*/
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(cmap->range_start < page_start + LOOKUP_PAGE_SIZE &&
+           cmap->range_start + cmap->range_length > page_start) break;
+    }
+    if(i == fdsc->cmap_num) return lookup_page_empty;
+
+    uint16_t * page = lookup_alloc(lookup, LOOKUP_PAGE_SIZE * sizeof(uint16_t));
+    if(page == NULL) return lookup_page_unavailable;
+
+    /*The first character map containing a code point is used when searching,
+     *so fill the page from the last map and let the earlier ones overwrite the glyph IDs*/
+    for(i = fdsc->cmap_num; i > 0; i--) {
+        if(!lookup_fill_page(page, page_start, &fdsc->cmaps[i - 1])) {
+            lookup_free(lookup, page, LOOKUP_PAGE_SIZE * sizeof(uint16_t));
+            return lookup_page_unavailable;
+        }
+    }
+
+    /*'\0' never has a glyph*/
+    if(page_id == 0) page[0] = 0;
+
+    return page;
+}
+
+/**
+ * Write the glyph IDs of the code points of a page which are in a character map
+ * @param page          the page to fill
+ * @param page_start    the first code point of the page
+ * @param cmap          the character map
+ * @return              false if a glyph ID doesn't fit into the page
+ */
+static bool lookup_fill_page(uint16_t * page, uint32_t page_start, const lv_font_fmt_txt_cmap_t * cmap)
+{
+    uint32_t first = LV_MAX(page_start, cmap->range_start);
+    uint32_t end = LV_MIN(page_start + LOOKUP_PAGE_SIZE, cmap->range_start + cmap->range_length);
+    if(first >= end) return true;
+
+    uint32_t letter;
+    uint32_t glyph_id;
+    switch(cmap->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            for(letter = first; letter < end; letter++) {
+                glyph_id = cmap->glyph_id_start + letter - cmap->range_start;
+                if(glyph_id > UINT16_MAX) return false;
+                page[letter - page_start] = (uint16_t)glyph_id;
+            }
+            break;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+                /*Offset 0 means a missing character except for the first one.
+                 *The next character maps are searched for the missing ones.*/
+                const uint8_t * gid_ofs_8 = cmap->glyph_id_ofs_list;
+                for(letter = first; letter < end; letter++) {
+                    uint32_t rcp = letter - cmap->range_start;
+                    if(gid_ofs_8[rcp] == 0 && rcp != 0) continue;
+                    glyph_id = cmap->glyph_id_start + gid_ofs_8[rcp];
+                    if(glyph_id > UINT16_MAX) return false;
+                    page[letter - page_start] = (uint16_t)glyph_id;
+                }
+            }
+            break;
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+                /*The characters not in the list are missing and the next character maps are not searched*/
+                for(letter = first; letter < end; letter++) {
+                    page[letter - page_start] = 0;
+                }
+
+                /*Find the first listed character of the page*/
+                const uint16_t * list = cmap->unicode_list;
+                uint32_t rcp_first = first - cmap->range_start;
+                uint32_t rcp_end = end - cmap->range_start;
+                uint32_t min = 0;
+                uint32_t max = cmap->list_length;
+                while(min < max) {
+                    uint32_t mid = (min + max) / 2;
+                    if(list[mid] < rcp_first) min = mid + 1;
+                    else max = mid;
+                }
+
+                const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+                uint32_t i;
+                for(i = min; i < cmap->list_length && list[i] < rcp_end; i++) {
+                    if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) glyph_id = cmap->glyph_id_start + i;
+                    else glyph_id = cmap->glyph_id_start + gid_ofs_16[i];
+                    if(glyph_id > UINT16_MAX) return false;
+                    page[cmap->range_start + list[i] - page_start] = (uint16_t)glyph_id;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+/**
+ * Convert the kern pairs of a font to a matrix where each glyph having kerning is a class on its own
+ * @param lookup    the lookup tables of the font
+ * @return          true: the matrix is built; false: it doesn't fit into the memory budget
+ */
+static bool lookup_build_kern(lv_font_fmt_txt_lookup_t * lookup)
+{
+    const lv_font_fmt_txt_kern_pair_t * kdsc = lookup->fdsc->kern_dsc;
+    if(kdsc->glyph_ids_size > 1) return false;
+
+    const uint8_t * ids_8 = kdsc->glyph_ids;
+    const uint16_t * ids_16 = kdsc->glyph_ids;
+    uint32_t pair_cnt = kdsc->pair_cnt;
+
+    /*Find the largest glyph ID having kerning*/
+    uint32_t glyph_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < pair_cnt; i++) {
+        uint32_t gid_left = kdsc->glyph_ids_size == 0 ? ids_8[i * 2] : ids_16[i * 2];
+        uint32_t gid_right = kdsc->glyph_ids_size == 0 ? ids_8[i * 2 + 1] : ids_16[i * 2 + 1];
+        glyph_cnt = LV_MAX3(glyph_cnt, gid_left + 1, gid_right + 1);
+    }
+
+    uint32_t class_size = glyph_cnt * sizeof(uint16_t);
+    uint16_t * left_class = lookup_alloc(lookup, class_size);
+    uint16_t * right_class = left_class ? lookup_alloc(lookup, class_size) : NULL;
+    if(right_class == NULL) {
+        if(left_class) lookup_free(lookup, left_class, class_size);
+        return false;
+    }
+
+    /*A class for each glyph on the left and right side*/
+    uint32_t left_class_cnt = 0;
+    uint32_t right_class_cnt = 0;
+    for(i = 0; i < pair_cnt; i++) {
+        uint32_t gid_left = kdsc->glyph_ids_size == 0 ? ids_8[i * 2] : ids_16[i * 2];
+        uint32_t gid_right = kdsc->glyph_ids_size == 0 ? ids_8[i * 2 + 1] : ids_16[i * 2 + 1];
+        if(left_class[gid_left] == 0) left_class[gid_left] = (uint16_t)++left_class_cnt;
+        if(right_class[gid_right] == 0) right_class[gid_right] = (uint16_t)++right_class_cnt;
+    }
+
+    uint64_t values_size = (uint64_t)left_class_cnt * right_class_cnt;
+    int8_t * values = values_size <= lookup_info.mem_budget ? lookup_alloc(lookup, (uint32_t)values_size) : NULL;
+    if(values == NULL) {
+        lookup_free(lookup, left_class, class_size);
+        lookup_free(lookup, right_class, class_size);
+        return false;
+    }
+
+    for(i = 0; i < pair_cnt; i++) {
+        uint32_t gid_left = kdsc->glyph_ids_size == 0 ? ids_8[i * 2] : ids_16[i * 2];
+        uint32_t gid_right = kdsc->glyph_ids_size == 0 ? ids_8[i * 2 + 1] : ids_16[i * 2 + 1];
+        values[(left_class[gid_left] - 1) * right_class_cnt + (right_class[gid_right] - 1)] = kdsc->values[i];
+    }
+
+    lookup->kern_left_class = left_class;
+    lookup->kern_right_class = right_class;
+    lookup->kern_values = values;
+    lookup->kern_glyph_cnt = glyph_cnt;
+    lookup->kern_right_class_cnt = (uint16_t)right_class_cnt;
+
+    return true;
+}
+
+/**
+ * Allocate zeroed memory for lookup tables if it fits into the memory budget
+ * @param lookup    the lookup tables of a font to account the memory to or NULL
+ * @param size      the size in bytes
+ * @return          the allocated memory or NULL
+ */
+static void * lookup_alloc(lv_font_fmt_txt_lookup_t * lookup, uint32_t size)
+{
+    if(size == 0 || lookup_info.mem_size + size > lookup_info.mem_budget) return NULL;
+
+    void * p = lv_malloc_zeroed(size);
+    if(p == NULL) return NULL;
+
+    lookup_info.mem_size += size;
+    if(lookup) lookup->mem_size += size;
+
+    return p;
+}
+
+static void lookup_free(lv_font_fmt_txt_lookup_t * lookup, void * p, uint32_t size)
+{
+    lv_free(p);
+    lookup_info.mem_size -= size;
+    lookup->mem_size -= size;
+}
+
+/**
+ * Free the lookup tables of a font. It should be already removed from the list.
+ */
+static void lookup_delete(lv_font_fmt_txt_lookup_t * lookup)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(lookup->pages) / sizeof(lookup->pages[0]); i++) {
+        const uint16_t * page = lookup->pages[i];
+        if(page && page != lookup_page_empty && page != lookup_page_unavailable) lv_free((void *)page);
+    }
+
+    lv_free(lookup->kern_left_class);
+    lv_free(lookup->kern_right_class);
+    lv_free(lookup->kern_values);
+
+    lookup_info.mem_size -= lookup->mem_size;
+    lv_free(lookup);
+}
+
+static void lookup_delete_all(void)
+{
+    lv_mutex_lock(&lookup_info.lock);
+    while(lookup_info.head) {
+        lv_font_fmt_txt_lookup_t * lookup = lookup_info.head;
+        lookup_info.head = lookup->next;
+        lookup_delete(lookup);
+    }
+    lv_mutex_unlock(&lookup_info.lock);
+}
+
 static int kern_pair_8_compare(const void * ref, const void * element)
 {
     const kern_pair_ref_t * ref8_p = ref;
@@ -224,6 +224,43 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Set the size of the cache which keeps the glyphs of `lv_font_fmt_txt` fonts converted to A8.
+ * Its initial size is `LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE`.
+ * @param size      new size of the cache in bytes. 0: don't cache the glyphs
+ */
+void lv_font_fmt_txt_glyph_cache_resize(uint32_t size);
+
+/**
+ * Drop all glyphs from the glyph cache.
+ * Needs to be called if an `lv_font_fmt_txt` font is freed, e.g. by `lv_binfont_destroy`.
+ */
+void lv_font_fmt_txt_glyph_cache_drop(void);
+
+/**
+ * Get how many times a glyph was found in the glyph cache and how many times it had to be converted.
+ * @param hit_cnt   store the number of hits here (can be NULL)
+ * @param miss_cnt  store the number of misses here (can be NULL)
+ */
+void lv_font_fmt_txt_glyph_cache_get_stats(uint32_t * hit_cnt, uint32_t * miss_cnt);
+
+/**
+ * Set the max. memory of the lookup tables of `lv_font_fmt_txt` fonts.
+ * The existing tables are freed and built again when needed.
+ * Its initial value is `LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE`.
+ * @note    The draw units read the tables without locking, so it may be called only while
+ *          no rendering is in progress, e.g. from the thread calling `lv_timer_handler()`,
+ *          but not from the draw events of the widgets.
+ * @param mem_budget    max. memory in bytes. 0: don't use lookup tables
+ */
+void lv_font_fmt_txt_lookup_set_mem_budget(uint32_t mem_budget);
+
+/**
+ * Get the memory currently used by the lookup tables of `lv_font_fmt_txt` fonts.
+ * @return          the memory used by the lookup tables in bytes
+ */
+uint32_t lv_font_fmt_txt_lookup_get_mem_size(void);
+
 /**********************
  *      MACROS
  **********************/
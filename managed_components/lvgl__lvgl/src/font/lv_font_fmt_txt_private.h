@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_font_fmt_txt.h"
+#include "../osal/lv_os_private.h"
 
 /*********************
  *      DEFINES
@@ -41,10 +42,77 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+typedef struct {
+    lv_cache_t * cache;     /**< The expanded A8 bitmaps of the glyphs*/
+} lv_font_fmt_txt_glyph_cache_t;
+
+/** Tables to find the glyphs and kerning values of a font without searching*/
+typedef struct _lv_font_fmt_txt_lookup_t {
+    struct _lv_font_fmt_txt_lookup_t * next;
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< The font data the tables belong to*/
+
+    /** Glyph IDs of the BMP code points in pages of 256 code points.
+     *  NULL: not built yet*/
+    const uint16_t * pages[256];
+
+    /** Kern pairs converted to a matrix: each glyph having kerning is a class on its own.
+     *  Class 0 means no kerning.*/
+    uint16_t * kern_left_class;
+    uint16_t * kern_right_class;
+    int8_t * kern_values;                   /**< `kern_right_class_cnt` values per left class*/
+    uint32_t kern_glyph_cnt;                /**< Length of `kern_left/right_class`*/
+    uint16_t kern_right_class_cnt;
+    uint8_t kern_state;                     /**< 0: not built yet, 1: built, 2: not available*/
+
+    uint32_t mem_size;                      /**< Memory used by the tables of this font*/
+} lv_font_fmt_txt_lookup_t;
+
+typedef struct {
+    lv_font_fmt_txt_lookup_t * head;        /**< Linked list of the lookup tables of the fonts*/
+    uint32_t mem_size;                      /**< Memory used by all lookup tables*/
+    uint32_t mem_budget;                    /**< Max. memory for the lookup tables*/
+    lv_mutex_t lock;                        /**< Protects building the tables from multiple threads*/
+} lv_font_fmt_txt_lookup_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the expanded glyph bitmaps
+ * @param size      size of the cache in bytes. 0: don't cache the glyphs
+ */
+void lv_font_fmt_txt_glyph_cache_init(uint32_t size);
+
+/**
+ * Free the cache of the expanded glyph bitmaps
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+
+/**
+ * Release the cached bitmap acquired by `lv_font_get_bitmap_fmt_txt`
+ * @param font      pointer to the font
+ * @param g_dsc     the glyph descriptor whose `entry` was set by `lv_font_get_bitmap_fmt_txt`
+ */
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
+/**
+ * Initialize the lookup tables of the `lv_font_fmt_txt` fonts
+ * @param mem_budget    max. memory of the lookup tables in bytes. 0: don't use lookup tables
+ */
+void lv_font_fmt_txt_lookup_init(uint32_t mem_budget);
+
+/**
+ * Free all lookup tables
+ */
+void lv_font_fmt_txt_lookup_deinit(void);
+
+/**
+ * Free the lookup tables of a font. Needs to be called before the font's data is freed.
+ * @param font      pointer to an `lv_font_fmt_txt` font
+ */
+void lv_font_fmt_txt_lookup_remove(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
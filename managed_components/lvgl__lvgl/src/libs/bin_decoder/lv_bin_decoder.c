@@ -10,6 +10,7 @@
 #include "lv_bin_decoder.h"
 #include "../../draw/lv_draw_image.h"
 #include "../../draw/lv_draw_buf.h"
+#include "../../draw/lv_draw_buf_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../libs/rle/lv_rle.h"
@@ -37,16 +38,23 @@
 
 /**
  * Data format for compressed image data.
+ *
+ * If `band_rows` is not 0, every `band_rows` rows are compressed independently.
+ * The data starts with an index of `band_cnt + 1` `uint32_t` offsets where
+ * band `i` is between `offset[i]` and `offset[i + 1]`, relative to the end of the index.
  */
 
 typedef struct _lv_image_compressed_t {
     uint32_t method: 4; /*Compression method, see `lv_image_compress_t`*/
-    uint32_t reserved : 28;  /*Reserved to be used later*/
+    uint32_t band_rows: 16; /*Rows per independently compressed band, 0: the whole image at once*/
+    uint32_t reserved : 12;  /*Reserved to be used later*/
     uint32_t compressed_size;  /*Compressed data size in byte*/
     uint32_t decompressed_size;  /*Decompressed data size in byte*/
     const uint8_t * data; /*Compressed data*/
 } lv_image_compressed_t;
 
+#define COMPRESSED_HEADER_SIZE 12
+
 typedef struct {
     lv_fs_file_t * f;
     lv_color32_t * palette;
@@ -56,8 +64,24 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    uint32_t * band_index;              /*Offsets of the compressed bands, if compressed in bands*/
+    uint8_t * band_buf;                 /*A compressed band read from file*/
+    uint32_t band_buf_size;             /*Size of the largest compressed band*/
+    int32_t band_decoded;               /*The band in `decoded_partial`, -1 if none*/
+    bool mapped;                        /*`decoded` uses the pixels of the file mapped to memory*/
 } decoder_data_t;
 
+/**
+ * A draw buf using the pixels of a file mapped to memory.
+ * Its `unaligned_data` points to itself to unmap the file when the draw buf is destroyed.
+ */
+typedef struct {
+    lv_draw_buf_t draw_buf;
+    lv_fs_drv_t * drv;
+    const void * map;
+    uint32_t map_size;
+} mapped_draw_buf_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -68,19 +92,37 @@ static lv_result_t load_indexed(lv_image_decoder_t * decoder, lv_image_decoder_d
 #if LV_BIN_DECODER_RAM_LOAD
     static lv_result_t decode_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 #endif
+#if LV_BIN_DECODER_MAP_FILES
+    static lv_result_t map_rgb(lv_image_decoder_dsc_t * dsc);
+    static void mapped_draw_buf_free(void * buf);
+#endif
 static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
+static lv_result_t read_compressed_header(lv_image_decoder_dsc_t * dsc);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t open_banded(lv_image_decoder_dsc_t * dsc);
+static lv_result_t get_area_banded(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                   lv_area_t * decoded_area);
+static lv_result_t decompress_band(lv_image_decoder_dsc_t * dsc, int32_t band, int32_t rows);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
+static bool compress_method_enabled(uint32_t method);
+static uint32_t decompress_data(lv_color_format_t cf, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t output_len);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+#if LV_BIN_DECODER_MAP_FILES
+static const lv_draw_buf_handlers_t mapped_draw_buf_handlers = {
+    .buf_free_cb = mapped_draw_buf_free,
+};
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -221,7 +263,11 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         lv_color_format_t cf = dsc->header.cf;
 
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
-            res = decode_compressed(decoder, dsc);
+            res = read_compressed_header(dsc);
+            if(res == LV_RESULT_OK) {
+                if(decoder_data->compressed.band_rows) res = open_banded(dsc);
+                else res = decode_compressed(decoder, dsc);
+            }
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             if(dsc->args.use_indexed) {
@@ -235,6 +281,11 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         else if(LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf)) {
             res = decode_alpha_only(decoder, dsc);
         }
+#if LV_BIN_DECODER_MAP_FILES
+        else if(map_rgb(dsc) == LV_RESULT_OK) {
+            res = LV_RESULT_OK; /*No need to read the pixels*/
+        }
+#endif
 #if LV_BIN_DECODER_RAM_LOAD
         else if(cf == LV_COLOR_FORMAT_ARGB8888      \
                 || cf == LV_COLOR_FORMAT_XRGB8888   \
@@ -262,7 +313,12 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         lv_color_format_t cf = image->header.cf;
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
-            res = decode_compressed(decoder, dsc);
+            res = read_compressed_header(dsc);
+            if(res == LV_RESULT_OK) {
+                decoder_data_t * decoder_data = dsc->user_data;
+                if(decoder_data->compressed.band_rows) res = open_banded(dsc);
+                else res = decode_compressed(decoder, dsc);
+            }
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             /*Need decoder data to store converted image*/
@@ -372,6 +428,12 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
     search_key.slot.size = dsc->decoded->data_size;
+    search_key.slot.cost = lv_image_decoder_get_time_to_open(dsc);
+
+    /*A mapped file uses no RAM, so it shouldn't evict the other images.
+     *Not 0 as an empty cache isn't searched.*/
+    decoder_data_t * decoder_data = get_decoder_data(dsc);
+    if(decoder_data->mapped) search_key.slot.size = 1;
 
     lv_cache_entry_t * cache_entry = lv_image_decoder_add_to_cache(decoder, &search_key, dsc->decoded, dsc->user_data);
     if(cache_entry == NULL) {
@@ -379,7 +441,6 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         return LV_RESULT_INVALID;
     }
     dsc->cache_entry = cache_entry;
-    decoder_data_t * decoder_data = get_decoder_data(dsc);
     decoder_data->decoded = NULL; /*Cache will take care of it*/
 
     return LV_RESULT_OK;
@@ -403,6 +464,11 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    /*Compressed images are decoded at open unless compressed in bands*/
+    if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        return get_area_banded(dsc, full_area, decoded_area);
+    }
+
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
@@ -571,6 +637,8 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
     lv_free(decoder_data->palette);
+    lv_free(decoder_data->band_index);
+    lv_free(decoder_data->band_buf);
     lv_free(decoder_data);
     dsc->user_data = NULL;
 }
@@ -830,6 +898,87 @@ static lv_result_t decode_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc
 }
 #endif
 
+#if LV_BIN_DECODER_MAP_FILES
+/**
+ * Use the pixels directly from the file if the file system can map it to memory.
+ * Returns LV_RESULT_INVALID without logging if it can't, to read the file as usual.
+ */
+static lv_result_t map_rgb(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_fs_file_t * f = decoder_data->f;
+    lv_color_format_t cf = dsc->header.cf;
+
+    bool supported = cf == LV_COLOR_FORMAT_ARGB8888  \
+                     || cf == LV_COLOR_FORMAT_XRGB8888  \
+                     || cf == LV_COLOR_FORMAT_RGB888    \
+                     || cf == LV_COLOR_FORMAT_RGB565    \
+                     || cf == LV_COLOR_FORMAT_RGB565_SWAPPED    \
+                     || cf == LV_COLOR_FORMAT_RGB565A8  \
+                     || cf == LV_COLOR_FORMAT_ARGB8565;
+    if(!supported) return LV_RESULT_INVALID;
+
+    const void * map;
+    uint32_t map_size;
+    if(lv_fs_map(f, &map, &map_size) != LV_FS_RES_OK) return LV_RESULT_INVALID;
+
+    uint32_t len = dsc->header.stride * dsc->header.h;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) {
+        len += (dsc->header.stride / 2) * dsc->header.h; /*A8 mask*/
+    }
+
+    uint8_t * data = (uint8_t *)map + sizeof(lv_image_header_t);
+    if(map_size < sizeof(lv_image_header_t) + len) {
+        LV_LOG_WARN("Mapped file too small: %" LV_PRIu32 ", expected: %" LV_PRIu32, map_size,
+                    (uint32_t)sizeof(lv_image_header_t) + len);
+        lv_fs_unmap(f->drv, map, map_size);
+        return LV_RESULT_INVALID;
+    }
+
+    /*The draw units might not handle unaligned pixels, read them to an aligned buffer instead*/
+    if(lv_draw_buf_align(data, cf) != data) {
+        LV_LOG_TRACE("Mapped pixels are not aligned");
+        lv_fs_unmap(f->drv, map, map_size);
+        return LV_RESULT_INVALID;
+    }
+
+    mapped_draw_buf_t * mapped = lv_malloc_zeroed(sizeof(mapped_draw_buf_t));
+    if(mapped == NULL) {
+        LV_LOG_ERROR("No memory for mapped draw buf");
+        lv_fs_unmap(f->drv, map, map_size);
+        return LV_RESULT_INVALID;
+    }
+
+    mapped->drv = f->drv;
+    mapped->map = map;
+    mapped->map_size = map_size;
+
+    lv_draw_buf_t * decoded = &mapped->draw_buf;
+    decoded->header.magic = LV_IMAGE_HEADER_MAGIC;
+    decoded->header.cf = cf;
+    decoded->header.w = dsc->header.w;
+    decoded->header.h = dsc->header.h;
+    decoded->header.stride = dsc->header.stride;
+    decoded->header.flags = LV_IMAGE_FLAGS_ALLOCATED; /*Not LV_IMAGE_FLAGS_MODIFIABLE, the mapping is read only*/
+    decoded->data = data;
+    decoded->data_size = len;
+    decoded->unaligned_data = mapped;
+    decoded->handlers = &mapped_draw_buf_handlers;
+
+    dsc->decoded = decoded;
+    decoder_data->decoded = decoded; /*Free when decoder closes*/
+    decoder_data->mapped = true;
+    return LV_RESULT_OK;
+}
+
+static void mapped_draw_buf_free(void * buf)
+{
+    /*Only unmap, `lv_draw_buf_destroy` frees the draw buf itself*/
+    mapped_draw_buf_t * mapped = buf;
+    lv_fs_unmap(mapped->drv, mapped->map, mapped->map_size);
+}
+#endif
+
 /**
  * Extend A1/2/4 to A8 with interpolation to reduce rounding error.
  */
@@ -924,18 +1073,20 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
     return LV_RESULT_OK;
 }
 
-static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+/**
+ * Read the compression header to `decoder_data->compressed`.
+ * Files are left positioned after the header, for variables `data` points after it.
+ */
+static lv_result_t read_compressed_header(lv_image_decoder_dsc_t * dsc)
 {
-#if LV_BIN_DECODER_RAM_LOAD
     uint32_t rn;
-    uint32_t len;
     uint32_t compressed_len;
     decoder_data_t * decoder_data = get_decoder_data(dsc);
-    lv_result_t res;
-    lv_fs_res_t fs_res;
-    uint8_t * file_buf = NULL;
-    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    if(decoder_data == NULL) {
+        return LV_RESULT_INVALID;
+    }
 
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
     lv_memzero(compressed, sizeof(lv_image_compressed_t));
 
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
@@ -948,21 +1099,53 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         }
 
         compressed_len -= sizeof(lv_image_header_t);
-        compressed_len -= 12;
+        compressed_len -= COMPRESSED_HEADER_SIZE;
 
         /*Read compress header*/
-        len = 12;
-        fs_res = fs_read_file_at(f, sizeof(lv_image_header_t), compressed, len, &rn);
-        if(fs_res != LV_FS_RES_OK || rn != len) {
-            LV_LOG_WARN("Read compressed header failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn, len);
+        lv_fs_res_t fs_res = fs_read_file_at(f, sizeof(lv_image_header_t), compressed, COMPRESSED_HEADER_SIZE, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Read compressed header failed: %d, with len: %" LV_PRIu32 ", expected: %d", fs_res, rn,
+                        COMPRESSED_HEADER_SIZE);
             return LV_RESULT_INVALID;
         }
-
-        if(compressed->compressed_size != compressed_len) {
-            LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
+    }
+    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
+        if(image->data_size < COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Compressed image too small: %" LV_PRIu32, image->data_size);
             return LV_RESULT_INVALID;
         }
 
+        /*Read compress header*/
+        compressed_len = image->data_size - COMPRESSED_HEADER_SIZE;
+        lv_memcpy(compressed, image->data, COMPRESSED_HEADER_SIZE);
+        compressed->data = image->data + COMPRESSED_HEADER_SIZE;
+    }
+    else {
+        LV_LOG_WARN("Compressed image only support file or variable");
+        return LV_RESULT_INVALID;
+    }
+
+    if(compressed->compressed_size != compressed_len) {
+        LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+#if LV_BIN_DECODER_RAM_LOAD
+    uint32_t rn;
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_result_t res;
+    lv_fs_res_t fs_res;
+    uint8_t * file_buf = NULL;
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    uint32_t compressed_len = compressed->compressed_size;
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         file_buf = lv_malloc(compressed_len);
         if(file_buf == NULL) {
             LV_LOG_WARN("No memory for compressed file");
@@ -971,7 +1154,7 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         }
 
         /*Continue to read the compressed data following compression header*/
-        fs_res = lv_fs_read(f, file_buf, compressed_len, &rn);
+        fs_res = lv_fs_read(decoder_data->f, file_buf, compressed_len, &rn);
         if(fs_res != LV_FS_RES_OK || rn != compressed_len) {
             LV_LOG_WARN("Read compressed file failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
                         compressed_len);
@@ -982,24 +1165,6 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         /*Decompress the image*/
         compressed->data = file_buf;
     }
-    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
-        lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
-        compressed_len = image->data_size;
-
-        /*Read compress header*/
-        len = 12;
-        compressed_len -= len;
-        lv_memcpy(compressed, image->data, len);
-        compressed->data = image->data + len;
-        if(compressed->compressed_size != compressed_len) {
-            LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
-            return LV_RESULT_INVALID;
-        }
-    }
-    else {
-        LV_LOG_WARN("Compressed image only support file or variable");
-        return LV_RESULT_INVALID;
-    }
 
     res = decompress_image(dsc, compressed);
     compressed->data = NULL; /*No need to store the data any more*/
@@ -1043,6 +1208,184 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 #endif
 }
 
+/**
+ * Prepare an image compressed in bands to be decompressed band by band in `get_area_cb`.
+ * Only the band index is loaded to RAM.
+ */
+static lv_result_t open_banded(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    lv_color_format_t cf = dsc->header.cf;
+
+    /*The rows of these formats are continuous, without palette or separate alpha map*/
+    bool supported = cf == LV_COLOR_FORMAT_ARGB8888  \
+                     || cf == LV_COLOR_FORMAT_XRGB8888  \
+                     || cf == LV_COLOR_FORMAT_RGB888    \
+                     || cf == LV_COLOR_FORMAT_RGB565    \
+                     || cf == LV_COLOR_FORMAT_RGB565_SWAPPED    \
+                     || cf == LV_COLOR_FORMAT_ARGB8565;
+    if(!supported) {
+        LV_LOG_WARN("CF: %d is not supported with band compression", cf);
+        return LV_RESULT_INVALID;
+    }
+
+    if(!compress_method_enabled(compressed->method)) {
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t band_cnt = (dsc->header.h + compressed->band_rows - 1) / compressed->band_rows;
+    uint32_t index_size = (band_cnt + 1) * sizeof(uint32_t);
+    if(compressed->decompressed_size != (uint32_t)dsc->header.stride * dsc->header.h
+       || compressed->compressed_size < index_size) {
+        LV_LOG_WARN("Invalid band compressed image, size: %" LV_PRIu32 ", decompressed: %" LV_PRIu32,
+                    compressed->compressed_size, compressed->decompressed_size);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t * index = lv_malloc(index_size);
+    if(index == NULL) {
+        LV_LOG_WARN("No memory for band index");
+        return LV_RESULT_INVALID;
+    }
+    decoder_data->band_index = index; /*Free on decoder close*/
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        /*The file is positioned after the compression header*/
+        uint32_t rn;
+        lv_fs_res_t fs_res = lv_fs_read(decoder_data->f, index, index_size, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != index_size) {
+            LV_LOG_WARN("Read band index failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
+                        index_size);
+            return LV_RESULT_INVALID;
+        }
+        compressed->data = NULL; /*Bands are read one by one*/
+    }
+    else {
+        lv_memcpy(index, compressed->data, index_size);
+        compressed->data += index_size;
+    }
+
+    /*The bands must follow each other up to the end of the data*/
+    if(index[0] != 0 || index[band_cnt] != compressed->compressed_size - index_size) {
+        LV_LOG_WARN("Invalid band index");
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t band_buf_size = 0;
+    for(uint32_t i = 0; i < band_cnt; i++) {
+        if(index[i + 1] < index[i]) {
+            LV_LOG_WARN("Invalid band index");
+            return LV_RESULT_INVALID;
+        }
+        band_buf_size = LV_MAX(band_buf_size, index[i + 1] - index[i]);
+    }
+
+    decoder_data->band_buf_size = band_buf_size;
+    decoder_data->band_decoded = -1;
+    return LV_RESULT_OK; /*Decompressed in get_area_cb*/
+}
+
+/**
+ * Return the full width bands intersecting `full_area` one by one.
+ * A band is decompressed only if it's not the one decompressed last time.
+ */
+static lv_result_t get_area_banded(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                   lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data == NULL || decoder_data->band_index == NULL) {
+        LV_LOG_ERROR("Unexpected null decoder data");
+        return LV_RESULT_INVALID;
+    }
+
+    int32_t band_rows = decoder_data->compressed.band_rows;
+    int32_t h = dsc->header.h;
+    int32_t y = decoded_area->y1 == LV_COORD_MIN ? LV_MAX(full_area->y1, 0) : decoded_area->y2 + 1;
+    if(y > full_area->y2 || y >= h) {
+        return LV_RESULT_INVALID;
+    }
+
+    int32_t band = y / band_rows;
+    int32_t band_y1 = band * band_rows;
+    int32_t rows = LV_MIN(band_rows, h - band_y1);
+
+    if(band != decoder_data->band_decoded) {
+        lv_result_t res = decompress_band(dsc, band, rows);
+        if(res != LV_RESULT_OK) return res;
+    }
+
+    decoded_area->x1 = 0;
+    decoded_area->x2 = dsc->header.w - 1;
+    decoded_area->y1 = band_y1;
+    decoded_area->y2 = band_y1 + rows - 1;
+    dsc->decoded = decoder_data->decoded_partial;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress a band of `rows` rows to `decoded_partial`. Only this band is read from file.
+ */
+static lv_result_t decompress_band(lv_image_decoder_dsc_t * dsc, int32_t band, int32_t rows)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+    lv_color_format_t cf = dsc->header.cf;
+    uint32_t stride = dsc->header.stride;
+
+    decoder_data->band_decoded = -1;
+
+    lv_draw_buf_t * decoded = decoder_data->decoded_partial;
+    if(decoded == NULL) {
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, compressed->band_rows, cf, stride);
+        if(decoded == NULL) {
+            LV_LOG_WARN("No memory for a band of %d rows", (int)compressed->band_rows);
+            return LV_RESULT_INVALID;
+        }
+        decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+    }
+
+    /*The last band can be shorter*/
+    decoded = lv_draw_buf_reshape(decoded, cf, dsc->header.w, rows, stride);
+    LV_ASSERT_NULL(decoded);
+
+    const uint8_t * input;
+    uint32_t offset = decoder_data->band_index[band];
+    uint32_t input_len = decoder_data->band_index[band + 1] - offset;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        if(decoder_data->band_buf == NULL) {
+            decoder_data->band_buf = lv_malloc(decoder_data->band_buf_size);
+            if(decoder_data->band_buf == NULL) {
+                LV_LOG_WARN("No memory for compressed band");
+                return LV_RESULT_INVALID;
+            }
+        }
+
+        uint32_t band_cnt = (dsc->header.h + compressed->band_rows - 1) / compressed->band_rows;
+        uint32_t pos = sizeof(lv_image_header_t) + COMPRESSED_HEADER_SIZE + (band_cnt + 1) * sizeof(uint32_t) + offset;
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, pos, decoder_data->band_buf, input_len, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != input_len) {
+            LV_LOG_WARN("Read band failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn, input_len);
+            return LV_RESULT_INVALID;
+        }
+        input = decoder_data->band_buf;
+    }
+    else {
+        input = compressed->data + offset;
+    }
+
+    uint32_t out_len = rows * stride;
+    uint32_t len = decompress_data(cf, compressed->method, input, input_len, decoded->data, out_len);
+    if(len != out_len) {
+        LV_LOG_WARN("Decompress band %" LV_PRId32 " failed: %" LV_PRIu32 ", got: %" LV_PRIu32, band, out_len, len);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->band_decoded = band;
+    return LV_RESULT_OK;
+}
+
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out)
 {
@@ -1114,20 +1457,7 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     /* At least one compression method must be enabled */
 #if (LV_USE_LZ4 || LV_USE_RLE)
     /* Check if the decompression method is enabled and valid */
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
-#if !LV_USE_RLE
-        LV_LOG_WARN("RLE decompression is not enabled");
-        return LV_RESULT_INVALID;
-#endif
-    }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
-#if !LV_USE_LZ4
-        LV_LOG_WARN("LZ4 decompression is not enabled");
-        return LV_RESULT_INVALID;
-#endif
-    }
-    else {
-        LV_LOG_WARN("Unknown compression method: %" LV_PRIu32, compressed->method);
+    if(!compress_method_enabled(compressed->method)) {
         return LV_RESULT_INVALID;
     }
 
@@ -1157,28 +1487,70 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     }
 
     img_data = decompressed->data;
+    len = decompress_data(dsc->header.cf, compressed->method, compressed->data, input_len, img_data, out_len);
 
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
+    if(len != compressed->decompressed_size) {
+        LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
+        lv_draw_buf_destroy(decompressed);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+#else
+    LV_UNUSED(dsc);
+    LV_UNUSED(compressed);
+    LV_LOG_WARN("At least one compression method must be enabled");
+    return LV_RESULT_INVALID;
+#endif /* (LV_USE_LZ4 || LV_USE_RLE) */
+}
+
+static bool compress_method_enabled(uint32_t method)
+{
+    if(method == LV_IMAGE_COMPRESS_RLE) {
+#if !LV_USE_RLE
+        LV_LOG_WARN("RLE decompression is not enabled");
+        return false;
+#endif
+    }
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
+#if !LV_USE_LZ4
+        LV_LOG_WARN("LZ4 decompression is not enabled");
+        return false;
+#endif
+    }
+    else {
+        LV_LOG_WARN("Unknown compression method: %" LV_PRIu32, method);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Decompress `input` to `output`
+ * @return the decompressed size, 0 on error
+ */
+static uint32_t decompress_data(lv_color_format_t cf, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t output_len)
+{
+    uint32_t len = 0;
+
+    if(method == LV_IMAGE_COMPRESS_RLE) {
 #if LV_USE_RLE
         /*Compress always happen on byte*/
         uint32_t pixel_byte;
-        if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8)
+        if(cf == LV_COLOR_FORMAT_RGB565A8)
             pixel_byte = 2;
         else
-            pixel_byte = (lv_color_format_get_bpp(dsc->header.cf) + 7) >> 3;
+            pixel_byte = (lv_color_format_get_bpp(cf) + 7) >> 3;
 
-        const uint8_t * input = compressed->data;
-        uint8_t * output = img_data;
-
-        len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
+        len = lv_rle_decompress(input, input_len, output, output_len, pixel_byte);
 #endif /* LV_USE_RLE */
     }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
 #if LV_USE_LZ4
-        const char * input = (const char *)compressed->data;
-        char * output = (char *)img_data;
-
-        int ret = LZ4_decompress_safe(input, output, (int)input_len, (int)out_len);
+        int ret = LZ4_decompress_safe((const char *)input, (char *)output, (int)input_len, (int)output_len);
         if(ret >= 0) {
             /* Cast is safe because of the above check */
             len = (uint32_t)ret;
@@ -1186,18 +1558,13 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
 #endif /* LV_USE_LZ4 */
     }
 
-    if(len != compressed->decompressed_size) {
-        LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
-        lv_draw_buf_destroy(decompressed);
-        return LV_RESULT_INVALID;
-    }
+#if !LV_USE_RLE && !LV_USE_LZ4
+    LV_UNUSED(cf);
+    LV_UNUSED(input);
+    LV_UNUSED(input_len);
+    LV_UNUSED(output);
+    LV_UNUSED(output_len);
+#endif
 
-    decoder_data->decompressed = decompressed; /*Free on decoder close*/
-    return LV_RESULT_OK;
-#else
-    LV_UNUSED(dsc);
-    LV_UNUSED(compressed);
-    LV_LOG_WARN("At least one compression method must be enabled");
-    return LV_RESULT_INVALID;
-#endif /* (LV_USE_LZ4 || LV_USE_RLE) */
+    return len;
 }
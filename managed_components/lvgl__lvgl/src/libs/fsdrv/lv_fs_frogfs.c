@@ -46,6 +46,7 @@ static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p);
 static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** buf_p, uint32_t * size_p);
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn, uint32_t fn_len);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -80,6 +81,7 @@ void lv_fs_frogfs_init(void)
     fs_drv_p->read_cb = fs_read;
     fs_drv_p->seek_cb = fs_seek;
     fs_drv_p->tell_cb = fs_tell;
+    fs_drv_p->map_cb = fs_map;
 
     fs_drv_p->dir_close_cb = fs_dir_close;
     fs_drv_p->dir_open_cb = fs_dir_open;
@@ -282,6 +284,22 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** buf_p, uint32_t * size_p)
+{
+    LV_UNUSED(drv);
+
+    /*Uncompressed files are in the blob as they are and stay there while the blob is registered*/
+    frogfs_fh_t * fh = file_p;
+    frogfs_stat_t st;
+    frogfs_stat(fh->fs, fh->entry, &st);
+    if(st.compression != FROGFS_COMP_ALGO_NONE) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    *size_p = frogfs_access(fh, buf_p);
+    return LV_FS_RES_OK;
+}
+
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path)
 {
     LV_UNUSED(drv);
@@ -89,6 +89,14 @@ extern "C" {
 #define lv_vector_dsc_add_path                      lv_draw_vector_dsc_add_path
 #define lv_vector_dsc_clear_area                    lv_draw_vector_dsc_clear_area
 
+#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE)
+#warning LV_DRAW_SW_SHADOW_CACHE_SIZE is deprecated. The shadow corners are cached in LV_DRAW_SW_MASK_CACHE_SIZE bytes
+#endif /* defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) */
+
+#if defined(LV_DRAW_SW_CIRCLE_CACHE_SIZE)
+#warning LV_DRAW_SW_CIRCLE_CACHE_SIZE is deprecated. The circle masks are cached in LV_DRAW_SW_MASK_CACHE_SIZE bytes
+#endif /* defined(LV_DRAW_SW_CIRCLE_CACHE_SIZE) */
+
 
 #ifdef __cplusplus
 } /*extern "C"*/
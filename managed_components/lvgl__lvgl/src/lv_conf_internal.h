@@ -28,6 +28,8 @@
 #define LV_DRAW_SW_ASM_NONE             0
 #define LV_DRAW_SW_ASM_NEON             1
 #define LV_DRAW_SW_ASM_HELIUM           2
+#define LV_DRAW_SW_ASM_ESP32S3          3
+#define LV_DRAW_SW_ASM_X86              4
 #define LV_DRAW_SW_ASM_CUSTOM           255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -253,6 +255,39 @@
     #endif
 #endif
 
+/** 1: Allow comparing the rendered areas with the previously flushed content and
+ *  calling `flush_cb` only with the changed rows. Enable it per display with `lv_display_set_flush_diff()`.
+ *  Useful for mostly static screens where redrawn areas often look the same as before. */
+#ifndef LV_USE_DISPLAY_FLUSH_DIFF
+    #ifdef CONFIG_LV_USE_DISPLAY_FLUSH_DIFF
+        #define LV_USE_DISPLAY_FLUSH_DIFF CONFIG_LV_USE_DISPLAY_FLUSH_DIFF
+    #else
+        #define LV_USE_DISPLAY_FLUSH_DIFF 0
+    #endif
+#endif
+
+/** 1: Keep the timers in a min-heap ordered by their next run time, so `lv_timer_handler()`
+ *  needs to check only the ready timers instead of all of them.
+ *  Useful with many timers. Uses 16 more bytes per timer. */
+#ifndef LV_USE_TIMER_HEAP
+    #ifdef CONFIG_LV_USE_TIMER_HEAP
+        #define LV_USE_TIMER_HEAP CONFIG_LV_USE_TIMER_HEAP
+    #else
+        #define LV_USE_TIMER_HEAP 0
+    #endif
+#endif
+
+/** 1: Evaluate the built-in ease-in/out and overshoot animation paths from lookup tables
+ *  instead of solving the cubic-bezier for each animation in each step.
+ *  A table of ~2 kB is allocated for each of these paths when it's used first. */
+#ifndef LV_USE_ANIM_PATH_LUT
+    #ifdef CONFIG_LV_USE_ANIM_PATH_LUT
+        #define LV_USE_ANIM_PATH_LUT CONFIG_LV_USE_ANIM_PATH_LUT
+    #else
+        #define LV_USE_ANIM_PATH_LUT 0
+    #endif
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -366,6 +401,25 @@
     #endif
 #endif
 
+/** Draw tasks and their descriptors are allocated from chunks of this size.
+ *  A chunk is reused when all draw tasks allocated from it are finished. */
+#ifndef LV_DRAW_TASK_POOL_CHUNK_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_POOL_CHUNK_SIZE
+        #define LV_DRAW_TASK_POOL_CHUNK_SIZE CONFIG_LV_DRAW_TASK_POOL_CHUNK_SIZE
+    #else
+        #define LV_DRAW_TASK_POOL_CHUNK_SIZE    (2 * 1024)      /**< [bytes]*/
+    #endif
+#endif
+
+/** Number of unused chunks to keep for the next draw tasks instead of freeing them. */
+#ifndef LV_DRAW_TASK_POOL_CACHE_CNT
+    #ifdef CONFIG_LV_DRAW_TASK_POOL_CACHE_CNT
+        #define LV_DRAW_TASK_POOL_CACHE_CNT CONFIG_LV_DRAW_TASK_POOL_CACHE_CNT
+    #else
+        #define LV_DRAW_TASK_POOL_CACHE_CNT     4
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -557,6 +611,17 @@
         #endif
     #endif
 
+    /** Split large draw tasks (e.g. a full screen gradient or a long label) into horizontal bands
+     *  which the idle rendering threads can steal, so all of them can work on the same draw task.
+     *  Has effect only if `LV_DRAW_SW_DRAW_UNIT_CNT > 1`. */
+    #ifndef LV_DRAW_SW_TILE_SPLIT
+        #ifdef CONFIG_LV_DRAW_SW_TILE_SPLIT
+            #define LV_DRAW_SW_TILE_SPLIT CONFIG_LV_DRAW_SW_TILE_SPLIT
+        #else
+            #define LV_DRAW_SW_TILE_SPLIT       0
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -591,26 +656,15 @@
     #endif
 
     #if LV_DRAW_SW_COMPLEX == 1
-        /** Allow buffering some shadow calculation.
-         *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-        #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
-            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
-            #else
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
-            #endif
-        #endif
-
-        /** Set number of maximally-cached circle data.
-         *  The circumference of 1/4 circle are saved for anti-aliasing.
-         *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
+        /** Byte budget of the cache of circle masks and shadow corners.
+         *  A rounded corner costs about `radius * 6` bytes and a shadow corner
+         *  `2 * (shadow_width + radius)^2` bytes. Entries larger than 1/4 of the budget are not cached.
          *  - 0: disables caching */
-        #ifndef LV_DRAW_SW_CIRCLE_CACHE_SIZE
-            #ifdef CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
-                #define LV_DRAW_SW_CIRCLE_CACHE_SIZE CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
+        #ifndef LV_DRAW_SW_MASK_CACHE_SIZE
+            #ifdef CONFIG_LV_DRAW_SW_MASK_CACHE_SIZE
+                #define LV_DRAW_SW_MASK_CACHE_SIZE CONFIG_LV_DRAW_SW_MASK_CACHE_SIZE
             #else
-                #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+                #define LV_DRAW_SW_MASK_CACHE_SIZE (8 * 1024)
             #endif
         #endif
     #endif
@@ -1446,6 +1500,27 @@
     #endif
 #endif
 
+/** 1: Evict the images which are large and fast to decode first from the image cache (GreedyDual-Size).
+ *  0: Evict the least recently used images first. */
+#ifndef LV_IMAGE_CACHE_COST_AWARE
+    #ifdef CONFIG_LV_IMAGE_CACHE_COST_AWARE
+        #define LV_IMAGE_CACHE_COST_AWARE CONFIG_LV_IMAGE_CACHE_COST_AWARE
+    #else
+        #define LV_IMAGE_CACHE_COST_AWARE 0
+    #endif
+#endif
+
+/** Split the image cache into this many parts with their own locks, so that the draw units
+ *  rarely wait for each other when they look up images in parallel (`LV_DRAW_SW_DRAW_UNIT_CNT > 1`).
+ *  Each part holds `LV_CACHE_DEF_SIZE / LV_IMAGE_CACHE_SHARD_CNT` bytes so larger images are not cached. */
+#ifndef LV_IMAGE_CACHE_SHARD_CNT
+    #ifdef CONFIG_LV_IMAGE_CACHE_SHARD_CNT
+        #define LV_IMAGE_CACHE_SHARD_CNT CONFIG_LV_IMAGE_CACHE_SHARD_CNT
+    #else
+        #define LV_IMAGE_CACHE_SHARD_CNT 1
+    #endif
+#endif
+
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #ifndef LV_IMAGE_HEADER_CACHE_DEF_CNT
@@ -1956,6 +2031,29 @@
     #endif
 #endif
 
+/** Size of the cache in bytes which keeps the glyphs of `lv_font_fmt_txt` fonts converted to A8.
+ *  Without it the glyphs are converted (e.g. from 1 bpp or compressed) every time they are drawn.
+ *  0: disable the cache */
+#ifndef LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Max. memory in bytes for the lookup tables of `lv_font_fmt_txt` fonts.
+ *  The tables are built lazily per font to find the glyphs of BMP code points and
+ *  the kerning values of kern pair fonts without searching.
+ *  0: disable the lookup tables */
+#ifndef LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE
+        #define LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE CONFIG_LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE 0
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -3072,6 +3170,16 @@
     #endif
 #endif
 
+/** Use the pixels of uncompressed bin image files directly, without copying them to RAM,
+ *  if the file system driver can map files to memory (`map_cb`) */
+#ifndef LV_BIN_DECODER_MAP_FILES
+    #ifdef CONFIG_LV_BIN_DECODER_MAP_FILES
+        #define LV_BIN_DECODER_MAP_FILES CONFIG_LV_BIN_DECODER_MAP_FILES
+    #else
+        #define LV_BIN_DECODER_MAP_FILES 0
+    #endif
+#endif
+
 /** RLE decompress library */
 #ifndef LV_USE_RLE
     #ifdef CONFIG_LV_USE_RLE
@@ -11,6 +11,7 @@
 #include "misc/lv_anim_private.h"
 #include "draw/lv_image_decoder_private.h"
 #include "draw/lv_draw_buf_private.h"
+#include "font/lv_font_fmt_txt_private.h"
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
 #include "core/lv_group_private.h"
@@ -147,11 +148,6 @@ static inline void lv_global_init(lv_global_t * global)
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
 #endif
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void lv_cleanup_devices(lv_global_t * global)
@@ -296,6 +292,9 @@ void lv_init(void)
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
+    lv_font_fmt_txt_glyph_cache_init(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+    lv_font_fmt_txt_lookup_init(LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE);
+
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
 #endif
@@ -465,6 +464,9 @@ void lv_deinit(void)
 
     lv_image_decoder_deinit();
 
+    lv_font_fmt_txt_glyph_cache_deinit();
+    lv_font_fmt_txt_lookup_deinit();
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
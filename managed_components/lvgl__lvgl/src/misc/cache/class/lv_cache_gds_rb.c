@@ -0,0 +1,453 @@
+/**
+* @file lv_cache_gds_rb.c
+*
+*/
+
+/***************************************************************\
+*                                                               *
+*  ┏ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ┓      *
+*                                                               *
+*  ┃   GreedyDual-Size Cache                             ┃      *
+*                                                               *
+*  ┃   priority = base + cost / size                     ┃      *
+*                                                               *
+*  ┃   ┌─────┐   ┌─────┐   ┌─────┐   ┌─────┐             ┃      *
+*      │  B  │──▶│  E  │──▶│  A  │──▶│  D  │  in order of use   *
+*  ┃   └─────┘   └─────┘   └─────┘   └─────┘             ┃      *
+*      base=L    base=L    base=10   base=0                     *
+*  ┃                                                     ┃      *
+*      Hit:   base = L                                          *
+*  ┃   Evict: the lowest priority, the least recently    ┃      *
+*             used one on a tie. L = its priority               *
+*  ┃                                                     ┃      *
+*  ┗ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ┛      *
+*                                                               *
+\***************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_cache_gds_rb.h"
+#include "../lv_cache_entry.h"
+#include "../../../stdlib/lv_sprintf.h"
+#include "../../../stdlib/lv_string.h"
+#include "../../lv_ll.h"
+#include "../../lv_rb_private.h"
+#include "../../lv_rb.h"
+#include "../../lv_iter.h"
+#include "../../lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Fixed point shift of `cost / size`. Keeps 1 ms / 16 MB above 0 and the priorities far from overflowing*/
+#define COST_SHIFT      24
+
+/*Rebase the priorities when `L` gets this large*/
+#define REBASE_LIMIT    ((uint64_t)1 << 62)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_rb_node_t * node;
+    uint64_t base;          /*`L` when the entry was added or last used*/
+} gds_node_t;
+
+struct _lv_gds_rb_t {
+    lv_cache_t cache;
+
+    lv_rb_t rb;
+    lv_ll_t ll;             /*`gds_node_t`s, the most recently used first*/
+
+    uint64_t inflation;     /*`L`: priority of the last evicted entry*/
+};
+typedef struct _lv_gds_rb_t lv_gds_rb_t_;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cb(lv_cache_t * cache);
+static void  destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static lv_rb_node_t * alloc_new_node(lv_gds_rb_t_ * gds, void * key);
+static void remove_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node);
+inline static gds_node_t ** get_gds_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node);
+static uint64_t get_priority(const gds_node_t * gds_node);
+static void rebase(lv_gds_rb_t_ * gds);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_cache_class_t lv_cache_class_gds_rb_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_rb_node_t * alloc_new_node(lv_gds_rb_t_ * gds, void * key)
+{
+    lv_rb_node_t * node = lv_rb_insert(&gds->rb, key);
+    if(node == NULL) return NULL;
+
+    void * data = node->data;
+    lv_memcpy(data, key, gds->cache.node_size);
+
+    gds_node_t * gds_node = lv_ll_ins_head(&gds->ll);
+    if(gds_node == NULL) {
+        lv_rb_drop_node(&gds->rb, node);
+        return NULL;
+    }
+
+    gds_node->node = node;
+    gds_node->base = gds->inflation;
+    *get_gds_node(gds, node) = gds_node;
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, gds->cache.node_size);
+    lv_cache_entry_init(entry, &gds->cache, gds->cache.node_size);
+
+    return node;
+}
+
+/*Remove a node from the tree and the list, but don't free the data*/
+static void remove_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node)
+{
+    gds_node_t * gds_node = *get_gds_node(gds, node);
+    lv_rb_remove_node(&gds->rb, node);
+    lv_ll_remove(&gds->ll, gds_node);
+    lv_free(gds_node);
+}
+
+inline static gds_node_t ** get_gds_node(lv_gds_rb_t_ * gds, lv_rb_node_t * node)
+{
+    return (gds_node_t **)((char *)node->data + gds->rb.size - sizeof(void *));
+}
+
+static uint64_t get_priority(const gds_node_t * gds_node)
+{
+    const lv_cache_slot_size_t * slot = gds_node->node->data;
+    uint64_t cost = slot->cost ? slot->cost : 1;
+    uint64_t size = slot->size ? slot->size : 1;
+    return gds_node->base + (cost << COST_SHIFT) / size;
+}
+
+/*Subtract the lowest base from all the priorities, so they don't overflow but keep their order*/
+static void rebase(lv_gds_rb_t_ * gds)
+{
+    uint64_t min_base = gds->inflation;
+    gds_node_t * gds_node;
+    LV_LL_READ(&gds->ll, gds_node) {
+        min_base = LV_MIN(min_base, gds_node->base);
+    }
+
+    LV_LL_READ(&gds->ll, gds_node) {
+        gds_node->base -= min_base;
+    }
+    gds->inflation -= min_base;
+}
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_gds_rb_t_));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_gds_rb_t_));
+    return res;
+}
+
+static bool init_cb(lv_cache_t * cache)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds->cache.ops.compare_cb);
+    LV_ASSERT_NULL(gds->cache.ops.free_cb);
+    LV_ASSERT(gds->cache.node_size >= sizeof(lv_cache_slot_size_t));
+
+    if(gds->cache.node_size < sizeof(lv_cache_slot_size_t) || gds->cache.ops.compare_cb == NULL ||
+       gds->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*add void* to store the ll node pointer*/
+    if(!lv_rb_init(&gds->rb, gds->cache.ops.compare_cb, lv_cache_entry_get_size(gds->cache.node_size) + sizeof(void *))) {
+        return false;
+    }
+    lv_ll_init(&gds->ll, sizeof(gds_node_t));
+
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    /*Restore the full value of the entry and keep the list in order of use to evict the LRU entry on a tie*/
+    gds_node_t * gds_node = *get_gds_node(gds, node);
+    gds_node->base = gds->inflation;
+    lv_ll_move_before(&gds->ll, gds_node, lv_ll_get_head(&gds->ll));
+
+    return lv_cache_entry_get_entry(node->data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * new_node = alloc_new_node(gds, (void *)key);
+    if(new_node == NULL) {
+        return NULL;
+    }
+
+    cache->size += ((const lv_cache_slot_size_t *)key)->size;
+
+    return lv_cache_entry_get_entry(new_node->data, cache->node_size);
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(entry);
+
+    if(gds == NULL || entry == NULL) {
+        return;
+    }
+
+    void * data = lv_cache_entry_get_data(entry);
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, data);
+    if(node == NULL) {
+        return;
+    }
+
+    remove_node(gds, node);
+
+    cache->size -= ((const lv_cache_slot_size_t *)data)->size;
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+    LV_ASSERT_NULL(key);
+
+    if(gds == NULL || key == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&gds->rb, key);
+    if(node == NULL) {
+        return;
+    }
+
+    void * data = node->data;
+
+    gds->cache.ops.free_cb(data, user_data);
+    cache->size -= ((const lv_cache_slot_size_t *)data)->size;
+
+    remove_node(gds, node);
+    lv_cache_entry_delete(lv_cache_entry_get_entry(data, cache->node_size));
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    gds_node_t * gds_node;
+    LV_LL_READ(&gds->ll, gds_node) {
+        /*free user handled data and do other clean up*/
+        void * search_key = gds_node->node->data;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(search_key, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            gds->cache.ops.free_cb(search_key, user_data);
+        }
+        else {
+            LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            used_cnt++;
+        }
+    }
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_rb_destroy(&gds->rb);
+    lv_ll_clear(&gds->ll);
+
+    cache->size = 0;
+    gds->inflation = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    /*Start from the least recently used entry so that it's chosen on a tie*/
+    gds_node_t * victim = NULL;
+    uint64_t victim_priority = UINT64_MAX;
+    gds_node_t * gds_node;
+    LV_LL_READ_BACK(&gds->ll, gds_node) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(gds_node->node->data, cache->node_size);
+        if(lv_cache_entry_get_ref(entry) != 0) continue;
+
+        uint64_t priority = get_priority(gds_node);
+        if(priority < victim_priority) {
+            victim = gds_node;
+            victim_priority = priority;
+        }
+    }
+
+    if(victim == NULL) {
+        return NULL;
+    }
+
+    /*Age the remaining entries: they need to be used again to stay above the next victims*/
+    gds->inflation = victim_priority;
+    if(gds->inflation >= REBASE_LIMIT) rebase(gds);
+
+    return lv_cache_entry_get_entry(victim->node->data, cache->node_size);
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)cache;
+
+    LV_ASSERT_NULL(gds);
+
+    if(gds == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    size_t data_size = key ? ((const lv_cache_slot_size_t *)key)->size : 0;
+    if(data_size > gds->cache.max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", (uint32_t)data_size,
+                     gds->cache.max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > gds->cache.max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(void *), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_gds_rb_t_ * gds = (lv_gds_rb_t_ *)instance;
+    gds_node_t ** gds_node = context;
+
+    LV_ASSERT_NULL(gds_node);
+
+    if(*gds_node == NULL) *gds_node = lv_ll_get_head(&gds->ll);
+    else *gds_node = lv_ll_get_next(&gds->ll, *gds_node);
+
+    if(*gds_node == NULL) return LV_RESULT_INVALID;
+
+    void * search_key = (*gds_node)->node->data;
+    lv_memcpy(elem, search_key, lv_cache_entry_get_size(gds->cache.node_size));
+
+    return LV_RESULT_OK;
+}
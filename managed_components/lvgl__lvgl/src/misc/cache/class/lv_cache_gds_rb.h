@@ -0,0 +1,48 @@
+/**
+* @file lv_cache_gds_rb.h
+*
+*/
+
+#ifndef LV_CACHE_GDS_RB_H
+#define LV_CACHE_GDS_RB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+/**
+ * GreedyDual-Size cache with size-based eviction policy. The data has to start with an
+ * `lv_cache_slot_size_t`. Entries that are large and cheap to recreate are evicted first,
+ * while recently used entries are kept longer.
+ */
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_cache_class_t lv_cache_class_gds_rb_size;
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CACHE_GDS_RB_H*/
@@ -33,6 +33,7 @@
 
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
 static void iter_inspect_cb(void * elem);
 
@@ -58,12 +59,19 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+#if LV_IMAGE_CACHE_COST_AWARE
+    const lv_cache_class_t * cache_class = &lv_cache_class_gds_rb_size;
+#else
+    const lv_cache_class_t * cache_class = &lv_cache_class_lru_rb_size;
+#endif
+
+    img_cache_p = lv_cache_create_sharded(cache_class,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
-    });
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
+    }, LV_IMAGE_CACHE_SHARD_CNT);
 
     lv_cache_set_name(img_cache_p, CACHE_NAME);
     return img_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
@@ -146,6 +154,27 @@ static lv_cache_compare_res_t image_cache_compare_cb(
     return image_cache_common_compare(lhs->src, lhs->src_type, rhs->src, rhs->src_type);
 }
 
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key)
+{
+    if(key->src_type == LV_IMAGE_SRC_FILE) {
+        /*FNV-1a of the path*/
+        uint32_t hash = 2166136261u;
+        for(const uint8_t * c = key->src; *c != '\0'; c++) {
+            hash = (hash ^ *c) * 16777619u;
+        }
+        return hash;
+    }
+
+    if(key->src_type == LV_IMAGE_SRC_VARIABLE) {
+        /*The image descriptors are aligned so skip the always zero low bits*/
+        uintptr_t addr = (uintptr_t)key->src;
+        return (uint32_t)((addr >> 3) ^ (addr >> 11));
+    }
+
+    /*Other sources are compared only by their type*/
+    return key->src_type;
+}
+
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
 {
     LV_UNUSED(user_data);
@@ -12,6 +12,7 @@
 #include "lv_cache_entry_private.h"
 #include "lv_cache_private.h"
 #include "../lv_profiler.h"
+#include "../lv_iter.h"
 
 /*********************
  *      DEFINES
@@ -27,6 +28,7 @@
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static lv_result_t sharded_iter_next_cb(void * instance, void * context, void * elem);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -40,6 +42,10 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
  *      MACROS
  **********************/
 
+/*The shard holding `key`, or the cache itself if it's not sharded*/
+#define GET_SHARD(cache, key) \
+    ((cache)->shards == NULL ? (cache) : (cache)->shards[(cache)->ops.hash_cb(key) % (cache)->shard_cnt])
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -56,6 +62,10 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    cache->shards = NULL;
+    cache->shard_cnt = 0;
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -68,10 +78,55 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     return cache;
 }
 
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, uint32_t shard_cnt)
+{
+    if(shard_cnt <= 1) return lv_cache_create(cache_class, node_size, max_size, ops);
+
+    LV_ASSERT_NULL(ops.hash_cb);
+
+    lv_cache_t * cache = lv_malloc_zeroed(sizeof(lv_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+
+    cache->shards = lv_malloc_zeroed(shard_cnt * sizeof(lv_cache_t *));
+    LV_ASSERT_MALLOC(cache->shards);
+    if(cache->shards == NULL) {
+        lv_free(cache);
+        return NULL;
+    }
+
+    cache->clz = cache_class;
+    cache->node_size = node_size;
+    cache->max_size = max_size;
+    cache->ops = ops;
+    cache->shard_cnt = shard_cnt;
+
+    for(uint32_t i = 0; i < shard_cnt; i++) {
+        cache->shards[i] = lv_cache_create(cache_class, node_size, max_size / shard_cnt, ops);
+        if(cache->shards[i] == NULL) {
+            lv_cache_destroy(cache, NULL);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
 void lv_cache_destroy(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards != NULL) {
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            if(cache->shards[i] != NULL) lv_cache_destroy(cache->shards[i], user_data);
+        }
+        lv_free(cache->shards);
+        lv_free(cache);
+        return;
+    }
+
     lv_mutex_lock(&cache->lock);
     cache->clz->destroy_cb(cache, user_data);
     lv_mutex_unlock(&cache->lock);
@@ -84,11 +139,14 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = GET_SHARD(cache, key);
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
 
     if(cache->size == 0) {
+        cache->miss_cnt++;
         lv_mutex_unlock(&cache->lock);
 
         LV_PROFILER_CACHE_END;
@@ -98,6 +156,10 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->hit_cnt++;
+    }
+    else {
+        cache->miss_cnt++;
     }
     lv_mutex_unlock(&cache->lock);
 
@@ -110,6 +172,14 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 
     LV_PROFILER_CACHE_BEGIN;
 
+    /*Only the last reference can free the entry, the others are dropped without taking the lock*/
+    if(lv_cache_entry_release_shared_data(entry)) {
+        LV_PROFILER_CACHE_END;
+        return;
+    }
+
+    if(cache->shards != NULL) cache = (lv_cache_t *)lv_cache_entry_get_cache(entry);
+
     lv_mutex_lock(&cache->lock);
     lv_cache_entry_release_data(entry, user_data);
 
@@ -126,6 +196,8 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = GET_SHARD(cache, key);
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -150,6 +222,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = GET_SHARD(cache, key);
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -159,6 +233,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
+            cache->hit_cnt++;
             lv_mutex_unlock(&cache->lock);
 
             LV_PROFILER_CACHE_END;
@@ -166,6 +241,8 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         }
     }
 
+    cache->miss_cnt++;
+
     if(cache->max_size == 0) {
         lv_mutex_unlock(&cache->lock);
 
@@ -180,16 +257,16 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
         LV_PROFILER_CACHE_END;
         return NULL;
     }
+    /*Acquire it before creating the data, so a `create_cb` adding entries to the same cache can't evict it*/
+    lv_cache_entry_acquire_data(entry);
     bool create_res = cache->ops.create_cb(lv_cache_entry_get_data(entry), user_data);
     if(create_res == false) {
+        lv_cache_entry_release_data(entry, user_data);
         cache->clz->remove_cb(cache, entry, user_data);
         cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
         lv_cache_entry_delete(entry);
         entry = NULL;
     }
-    else {
-        lv_cache_entry_acquire_data(entry);
-    }
     lv_mutex_unlock(&cache->lock);
 
     LV_PROFILER_CACHE_END;
@@ -199,12 +276,21 @@ void lv_cache_reserve(lv_cache_t * cache, uint32_t reserved_size, void * user_da
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards != NULL) {
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_reserve(cache->shards[i], reserved_size / cache->shard_cnt, user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
+    lv_mutex_lock(&cache->lock);
     for(lv_cache_reserve_cond_res_t reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data);
         reserve_cond_res == LV_CACHE_RESERVE_COND_NEED_VICTIM;
         reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data))
         cache_evict_one_internal_no_lock(cache, user_data);
+    lv_mutex_unlock(&cache->lock);
 
     LV_PROFILER_CACHE_END;
 }
@@ -213,6 +299,8 @@ void lv_cache_drop(lv_cache_t * cache, const void * key, void * user_data)
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    cache = GET_SHARD(cache, key);
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -225,6 +313,22 @@ bool lv_cache_evict_one(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards != NULL) {
+        /*Evict from the fullest shard first, as the shards don't know which entry is the oldest overall*/
+        uint32_t fullest = 0;
+        for(uint32_t i = 1; i < cache->shard_cnt; i++) {
+            if(cache->shards[i]->size > cache->shards[fullest]->size) fullest = i;
+        }
+        if(cache->shards[fullest]->size == 0) return false;
+        if(lv_cache_evict_one(cache->shards[fullest], user_data)) return true;
+
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            if(i == fullest || cache->shards[i]->size == 0) continue;
+            if(lv_cache_evict_one(cache->shards[i], user_data)) return true;
+        }
+        return false;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -238,6 +342,13 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards != NULL) {
+        for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_drop_all(cache->shards[i], user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     lv_mutex_lock(&cache->lock);
@@ -251,6 +362,9 @@ void lv_cache_set_max_size(lv_cache_t * cache, size_t max_size, void * user_data
 {
     LV_UNUSED(user_data);
     cache->max_size = max_size;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->max_size = max_size / cache->shard_cnt;
+    }
 }
 size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 {
@@ -260,12 +374,36 @@ size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 size_t lv_cache_get_size(lv_cache_t * cache, void * user_data)
 {
     LV_UNUSED(user_data);
-    return cache->size;
+    size_t size = cache->size;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        size += cache->shards[i]->size;
+    }
+    return size;
+}
+void lv_cache_get_hit_stats(lv_cache_t * cache, uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    LV_ASSERT_NULL(cache);
+
+    *hit_cnt = cache->hit_cnt;
+    *miss_cnt = cache->miss_cnt;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        *hit_cnt += cache->shards[i]->hit_cnt;
+        *miss_cnt += cache->shards[i]->miss_cnt;
+    }
+}
+void lv_cache_reset_hit_stats(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_reset_hit_stats(cache->shards[i]);
+    }
 }
 size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
-    return cache->max_size - cache->size;
+    return cache->max_size - lv_cache_get_size(cache, user_data);
 }
 bool lv_cache_is_enabled(lv_cache_t * cache)
 {
@@ -275,21 +413,33 @@ void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_c
 {
     LV_UNUSED(user_data);
     cache->ops.compare_cb = compare_cb;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->ops.compare_cb = compare_cb;
+    }
 }
 void lv_cache_set_create_cb(lv_cache_t * cache, lv_cache_create_cb_t alloc_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.create_cb = alloc_cb;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->ops.create_cb = alloc_cb;
+    }
 }
 void lv_cache_set_free_cb(lv_cache_t * cache, lv_cache_free_cb_t free_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.free_cb = free_cb;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->ops.free_cb = free_cb;
+    }
 }
 void lv_cache_set_name(lv_cache_t * cache, const char * name)
 {
     if(cache == NULL) return;
     cache->name = name;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        cache->shards[i]->name = name;
+    }
 }
 const char * lv_cache_get_name(lv_cache_t * cache)
 {
@@ -300,6 +450,10 @@ lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
 {
     LV_ASSERT_NULL(cache);
     if(cache == NULL || cache->clz->iter_create_cb == NULL) return NULL;
+    if(cache->shards != NULL) {
+        return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), 2 * sizeof(uint32_t),
+                              sharded_iter_next_cb);
+    }
     return cache->clz->iter_create_cb(cache);
 }
 
@@ -357,3 +511,30 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+static lv_result_t sharded_iter_next_cb(void * instance, void * context, void * elem)
+{
+    /*lv_iter can't free what's left in its context, so instead of keeping an iterator of the
+     *current shard, a new one is created and moved to the next element on every step*/
+    lv_cache_t * cache = instance;
+    uint32_t * shard_idx = context;
+    uint32_t * elem_idx = shard_idx + 1;
+
+    for(; *shard_idx < cache->shard_cnt; (*shard_idx)++, *elem_idx = 0) {
+        lv_iter_t * iter = lv_cache_iter_create(cache->shards[*shard_idx]);
+        if(iter == NULL) return LV_RESULT_INVALID;
+
+        lv_result_t res = LV_RESULT_OK;
+        for(uint32_t i = 0; i <= *elem_idx && res == LV_RESULT_OK; i++) {
+            res = lv_iter_next(iter, elem);
+        }
+        lv_iter_destroy(iter);
+
+        if(res == LV_RESULT_OK) {
+            (*elem_idx)++;
+            return LV_RESULT_OK;
+        }
+    }
+
+    return LV_RESULT_INVALID;
+}
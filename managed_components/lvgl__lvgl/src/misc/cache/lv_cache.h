@@ -49,6 +49,22 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
                              size_t node_size, size_t max_size,
                              lv_cache_ops_t ops);
 
+/**
+ * Create a cache split into `shard_cnt` independent caches of the given class, each with its own lock.
+ * The keys are assigned to the shards by `lv_cache_ops_t::hash_cb`, so threads using different keys
+ * rarely wait for each other. It can be used with all the other `lv_cache_...` functions as a normal cache.
+ * @param cache_class   The class of the shards. See lv_cache_create().
+ * @param node_size     The node size is the size of the data stored in the cache.
+ * @param max_size      The maximum size of all the shards together. Each shard can hold `max_size / shard_cnt`,
+ *                      so with size-based classes an entry larger than that can't be cached.
+ * @param ops           A set of operations that can be performed on the cache. `hash_cb` is required.
+ * @param shard_cnt     Number of shards. With 0 or 1 it's the same as lv_cache_create().
+ * @return              Returns a pointer to the created cache object on success, `NULL` on error.
+ */
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, uint32_t shard_cnt);
+
 /**
  * Destroy a cache object.
  * @param cache         The cache object pointer to destroy.
@@ -91,6 +107,7 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
 /**
  * Release a cache entry. The `lv_cache_entry_t::ref_cnt` will be decremented. If the `lv_cache_entry_t::ref_cnt` is zero, it will issue an error.
  * If the entry passed to this function is the last reference to the data and the entry is marked as invalid, the cache's policy will be used to evict the entry.
+ * Only releasing the last reference takes the cache's lock.
  * @param cache         The cache object pointer to release the entry.
  * @param entry         The cache entry pointer to release.
  * @param user_data     A user data pointer that will be passed to the free callback.
@@ -169,6 +186,20 @@ size_t lv_cache_get_size(lv_cache_t * cache, void * user_data);
  */
 size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data);
 
+/**
+ * Get how many lookups by lv_cache_acquire() and lv_cache_acquire_or_create() found their entry in the cache.
+ * @param cache         The cache object pointer to get the statistics of.
+ * @param hit_cnt       Store the number of lookups which found their entry here.
+ * @param miss_cnt      Store the number of lookups which didn't find their entry here.
+ */
+void lv_cache_get_hit_stats(lv_cache_t * cache, uint32_t * hit_cnt, uint32_t * miss_cnt);
+
+/**
+ * Restart counting the hits and misses of the cache from 0.
+ * @param cache         The cache object pointer.
+ */
+void lv_cache_reset_hit_stats(lv_cache_t * cache);
+
 /**
  * Return true if the cache is enabled.
  * Disabled cache means that when the max_size of the cache is 0. In this case, all cache operations will be no-op.
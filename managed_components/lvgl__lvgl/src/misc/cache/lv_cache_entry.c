@@ -15,6 +15,22 @@
  *      DEFINES
  *********************/
 
+/*The reference counters are changed atomically so that the references which are not the last can be
+ *released without the cache's lock. Other changes still happen with the lock taken.*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define ATOMIC_REF_CNT              1
+    #define REF_LOAD(p)                 __atomic_load_n(p, __ATOMIC_ACQUIRE)
+    #define REF_STORE(p, v)             __atomic_store_n(p, v, __ATOMIC_RELEASE)
+    #define REF_ADD(p, v)               __atomic_add_fetch(p, v, __ATOMIC_ACQ_REL)
+    #define REF_CAS(p, expected, v)     \
+    __atomic_compare_exchange_n(p, expected, v, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+    #define ATOMIC_REF_CNT              0
+    #define REF_LOAD(p)                 (*(p))
+    #define REF_STORE(p, v)             (*(p) = (v))
+    #define REF_ADD(p, v)               (*(p) += (v))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -42,29 +58,29 @@
 void lv_cache_entry_reset_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    entry->ref_cnt = 0;
+    REF_STORE(&entry->ref_cnt, 0);
 }
 
 void lv_cache_entry_inc_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    entry->ref_cnt++;
+    REF_ADD(&entry->ref_cnt, 1);
 }
 
 void lv_cache_entry_dec_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    entry->ref_cnt--;
-    if(entry->ref_cnt < 0) {
-        LV_LOG_WARN("ref_cnt(%" LV_PRIu32 ") < 0", entry->ref_cnt);
-        entry->ref_cnt = 0;
+    int32_t ref_cnt = REF_ADD(&entry->ref_cnt, -1);
+    if(ref_cnt < 0) {
+        LV_LOG_WARN("ref_cnt(%" LV_PRIu32 ") < 0", ref_cnt);
+        REF_STORE(&entry->ref_cnt, 0);
     }
 }
 
 int32_t lv_cache_entry_get_ref(lv_cache_entry_t * entry)
 {
     LV_ASSERT_NULL(entry);
-    return entry->ref_cnt;
+    return REF_LOAD(&entry->ref_cnt);
 }
 
 uint32_t lv_cache_entry_get_node_size(lv_cache_entry_t * entry)
@@ -111,6 +127,20 @@ void lv_cache_entry_release_data(lv_cache_entry_t * entry, void * user_data)
     lv_cache_entry_dec_ref(entry);
 }
 
+bool lv_cache_entry_release_shared_data(lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+
+#if ATOMIC_REF_CNT
+    int32_t ref_cnt = REF_LOAD(&entry->ref_cnt);
+    while(ref_cnt > 1) {
+        if(REF_CAS(&entry->ref_cnt, &ref_cnt, ref_cnt - 1)) return true;
+    }
+#endif
+
+    return false;
+}
+
 lv_cache_entry_t * lv_cache_entry_get_entry(void * data, const uint32_t node_size)
 {
     LV_ASSERT_NULL(data);
@@ -44,6 +44,15 @@ void   lv_cache_entry_set_node_size(lv_cache_entry_t * entry, uint32_t node_size
 void   lv_cache_entry_set_cache(lv_cache_entry_t * entry, const lv_cache_t * cache);
 void * lv_cache_entry_acquire_data(lv_cache_entry_t * entry);
 void   lv_cache_entry_release_data(lv_cache_entry_t * entry, void * user_data);
+
+/**
+ * Drop a reference to the entry if it's not the last one. It's safe to call without the cache's lock,
+ * as the last reference, which might need to free the entry, is never dropped here.
+ * @param entry     The cache entry.
+ * @return          true if the reference was dropped, false if it's the last one (or atomics are not available)
+ *                  and lv_cache_entry_release_data() needs to be called with the lock taken.
+ */
+bool   lv_cache_entry_release_shared_data(lv_cache_entry_t * entry);
 void   lv_cache_entry_set_flag(lv_cache_entry_t * entry, uint8_t flags);
 void   lv_cache_entry_remove_flag(lv_cache_entry_t * entry, uint8_t flags);
 bool   lv_cache_entry_has_flag(lv_cache_entry_t * entry, uint8_t flags);
@@ -46,6 +46,7 @@ typedef int8_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * key);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -118,6 +119,8 @@ struct _lv_cache_ops_t {
     lv_cache_compare_cb_t compare_cb;    /**< Compare function for keys */
     lv_cache_create_cb_t create_cb;      /**< Create function for nodes */
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
+    lv_cache_hash_cb_t hash_cb;          /**< Hash function for keys, keys comparing equal must have the same hash.
+                                          *   Needed only by sharded caches. */
 };
 
 /**
@@ -138,6 +141,13 @@ struct _lv_cache_t {
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< Name of the cache */
+
+    lv_cache_t ** shards;             /**< Independent caches with their own locks. The entries are spread over them
+                                       *   by `ops.hash_cb`. `NULL` if the cache is not sharded. */
+    uint32_t shard_cnt;               /**< Number of shards */
+
+    uint32_t hit_cnt;                 /**< Number of lookups which found their entry */
+    uint32_t miss_cnt;                /**< Number of lookups which didn't find their entry */
 };
 
 /**
@@ -179,6 +189,8 @@ typedef struct _lv_cache_slot_size_t lv_cache_slot_size_t;
  */
 struct _lv_cache_slot_size_t {
     size_t size;
+    uint32_t cost;      /**< Cost of recreating the data (e.g. time to decode it in ms). Used only by
+                         *   cost aware classes like lv_cache_class_gds_rb_size, 0 is the same as 1.*/
 };
 /**********************
  * GLOBAL PROTOTYPES
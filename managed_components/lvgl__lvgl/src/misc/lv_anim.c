@@ -29,8 +29,13 @@
 /**In an anim. time this bit indicates that the value is speed, and not time*/
 #define LV_ANIM_SPEED_MASK 0x80000000
 
+/**Initial number of slots in the array of animations*/
+#define ANIM_ARRAY_MIN_CAPACITY 16
+
+/**The key of an animated variable in `anim_var_keys`. The same key doesn't mean the same variable.*/
+#define ANIM_VAR_KEY(var) ((uint32_t)(lv_uintptr_t)(var))
+
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
 
 /**********************
  *      TYPEDEFS
@@ -42,13 +47,20 @@
 static void anim_timer(lv_timer_t * param);
 static void anim_vsync_event(lv_event_t * e);
 static void anim_mark_list_change(void);
-static void anim_completed_handler(lv_anim_t * a);
-static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
+static void anim_completed_handler(lv_anim_t * a, uint32_t i);
+static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, lv_anim_path_lut_t lut_id, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
+#if LV_USE_ANIM_PATH_LUT
+    static const int16_t * get_path_lut(lv_anim_path_lut_t lut_id, int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+#endif
 static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(const lv_anim_t * a_current);
-static void remove_anim(void * a);
+static void remove_anim(uint32_t i);
+static bool anims_add(lv_anim_t * a);
+static bool anims_resize(uint32_t capacity);
+static void anims_unlink(uint32_t i);
+static void anims_compact(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -69,7 +81,12 @@ static void remove_anim(void * a);
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
+    state.anims = NULL;
+    state.anim_var_keys = NULL;
+    state.anim_cnt = 0;
+    state.anim_capacity = 0;
+    state.anim_deleted_cnt = 0;
+    state.anim_read_depth = 0;
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
     state.anim_list_changed = false;
@@ -79,6 +96,20 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+    lv_free(state.anims);
+    lv_free(state.anim_var_keys);
+    state.anims = NULL;
+    state.anim_var_keys = NULL;
+    state.anim_cnt = 0;
+    state.anim_capacity = 0;
+
+#if LV_USE_ANIM_PATH_LUT
+    uint32_t i;
+    for(i = 0; i < LV_ANIM_PATH_LUT_NONE; i++) {
+        lv_free(state.path_lut[i]);
+        state.path_lut[i] = NULL;
+    }
+#endif
 }
 
 void lv_anim_enable_vsync_mode(bool enable)
@@ -125,14 +156,18 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         remove_concurrent_anims(a);
     }
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
+    /*Add the new animation to the end of the animation array*/
+    lv_anim_t * new_anim = lv_malloc(sizeof(lv_anim_t));
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
+    if(!anims_add(new_anim)) {
+        lv_free(new_anim);
+        return NULL;
+    }
     new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
     new_anim->is_paused = false;
@@ -157,7 +192,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
+    /*Creating an animation changed the animation array.
      *It's important if it happens in a ready callback. (see `anim_timer`)*/
     anim_mark_list_change();
 
@@ -181,38 +216,54 @@ uint32_t lv_anim_get_playtime(const lv_anim_t * a)
 
 bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+
+    /*The deleted slots are only set to NULL, so `a->deleted_cb` can't move the others*/
+    uint32_t key = ANIM_VAR_KEY(var);
+    state.anim_read_depth++;
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        if(var && state.anim_var_keys[i] != key) continue;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
         if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            remove_anim(a);
+            remove_anim(i);
             anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
+                                       the animation array*/
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    state.anim_read_depth--;
+    anims_compact();
 
     return del_any;
 }
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
+    state.anim_read_depth++;
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        if(state.anims[i]) remove_anim(i);
+    }
+    state.anim_read_depth--;
+    anims_compact();
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+    /*Search from the newest animation*/
+    uint32_t key = ANIM_VAR_KEY(var);
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        if(state.anim_var_keys[i] != key) continue;
+        lv_anim_t * a = state.anims[i];
+        if(a && a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
     }
@@ -227,11 +278,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)(state.anim_cnt - state.anim_deleted_cnt);
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -296,25 +343,25 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+    return lv_anim_path_cubic_bezier(a, LV_ANIM_PATH_LUT_EASE_IN, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
                                      LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
+    return lv_anim_path_cubic_bezier(a, LV_ANIM_PATH_LUT_EASE_OUT, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
                                      LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
+    return lv_anim_path_cubic_bezier(a, LV_ANIM_PATH_LUT_EASE_IN_OUT, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
                                      LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
+    return lv_anim_path_cubic_bezier(a, LV_ANIM_PATH_LUT_OVERSHOOT, 341, 0, 683, 1300);
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -380,12 +427,21 @@ int32_t lv_anim_path_step(const lv_anim_t * a)
 int32_t lv_anim_path_custom_bezier3(const lv_anim_t * a)
 {
     const lv_anim_bezier3_para_t * para = &a->parameter.bezier3;
-    return lv_anim_path_cubic_bezier(a, para->x1, para->y1, para->x2, para->y2);
+    return lv_anim_path_cubic_bezier(a, LV_ANIM_PATH_LUT_NONE, para->x1, para->y1, para->x2, para->y2);
 }
 
 void lv_anim_set_var(lv_anim_t * a, void * var)
 {
     a->var = var;
+
+    /*If `a` is a running animation, update its key too, so that it's found by the new `var`*/
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        if(state.anims[i] == a) {
+            state.anim_var_keys[i] = ANIM_VAR_KEY(var);
+            break;
+        }
+    }
 }
 
 void lv_anim_set_exec_cb(lv_anim_t * a, lv_anim_exec_xcb_t exec_cb)
@@ -570,9 +626,19 @@ static void anim_timer(lv_timer_t * param)
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+    uint32_t now = lv_tick_get();
+
+    /*Handle the animations from the newest. The animations started meanwhile are added to the end,
+     *and the deleted ones are only set to NULL, so the array can be read further even if it changes*/
+    state.anim_read_depth++;
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
+        state.anim_var_keys[i] = ANIM_VAR_KEY(a->var);
+        uint32_t elaps = lv_tick_diff(now, a->last_timer_run);
 
         if(a->is_paused) {
             const uint32_t time_paused = lv_tick_elaps(a->pause_time);
@@ -588,16 +654,15 @@ static void anim_timer(lv_timer_t * param)
         else {
             a->act_time += elaps;
         }
-        a->last_timer_run = lv_tick_get();
+        a->last_timer_run = now;
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
+        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation was
+         * started or deleted in the callbacks, and `a` might be deleted too.
          */
         state.anim_list_changed = false;
 
         if(!a->is_paused && a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+            a->run_round = state.anim_run_round; /*Animations resumed meanwhile have the new run round and are skipped*/
             /*The animation will run now for the first time. Call `start_cb`*/
             if(!a->start_cb_called && a->act_time >= 0) {
 
@@ -638,28 +703,23 @@ static void anim_timer(lv_timer_t * param)
 
                     /*If the time is elapsed the animation is ready*/
                     if(a->act_time >= a->duration) {
-                        anim_completed_handler(a);
+                        anim_completed_handler(a, i);
                     }
                 }
             }
         }
-
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
     }
-
+    state.anim_read_depth--;
+    anims_compact();
 }
 
 /**
  * Called when an animation is completed to do the necessary things
  * e.g. repeat, play in reverse, delete etc.
  * @param a pointer to an animation descriptor
+ * @param i index of `a` in the animation array
  */
-static void anim_completed_handler(lv_anim_t * a)
+static void anim_completed_handler(lv_anim_t * a, uint32_t i)
 {
     /*In the end of a forward anim decrement repeat cnt.*/
     if(a->reverse_play_in_progress == 0 && a->repeat_cnt > 0 && a->repeat_cnt != LV_ANIM_REPEAT_INFINITE) {
@@ -671,9 +731,9 @@ static void anim_completed_handler(lv_anim_t * a)
      * - no repeat, reverse play enabled (reverse_duration != 0) and reverse play is completed. */
     if(a->repeat_cnt == 0 && (a->reverse_duration == 0 || a->reverse_play_in_progress == 1)) {
 
-        /*Delete the animation from the list.
+        /*Delete the animation from the array.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
+        anims_unlink(i);
         /*Flag that the list has changed*/
         anim_mark_list_change();
 
@@ -717,7 +777,7 @@ static void anim_vsync_event(lv_event_t * e)
 static void anim_mark_list_change(void)
 {
     state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL) {
+    if(state.anim_cnt == state.anim_deleted_cnt) {
         if(state.timer) {
             lv_timer_pause(state.timer);
             return;
@@ -742,11 +802,20 @@ static void anim_mark_list_change(void)
     }
 }
 
-static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, lv_anim_path_lut_t lut_id, int32_t x1, int32_t y1,
+                                         int32_t x2, int32_t y2)
 {
     /*Calculate the current step*/
     uint32_t t = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_cubic_bezier(t, x1, y1, x2, y2);
+    int32_t step;
+#if LV_USE_ANIM_PATH_LUT
+    const int16_t * lut = get_path_lut(lut_id, x1, y1, x2, y2);
+    if(lut && t <= LV_BEZIER_VAL_MAX) step = lut[t];
+    else step = lv_cubic_bezier(t, x1, y1, x2, y2);
+#else
+    LV_UNUSED(lut_id);
+    step = lv_cubic_bezier(t, x1, y1, x2, y2);
+#endif
 
     int32_t new_value;
     new_value = step * (a->end_value - a->start_value);
@@ -756,6 +825,36 @@ static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1, int32_
     return new_value;
 }
 
+#if LV_USE_ANIM_PATH_LUT
+/**
+ * Get the values of a built-in cubic-bezier path for each time step.
+ * The table is created when the path is used for the first time.
+ * @param lut_id    which built-in path
+ * @param x1        x of control point 1 of the path
+ * @param y1        y of control point 1 of the path
+ * @param x2        x of control point 2 of the path
+ * @param y2        y of control point 2 of the path
+ * @return          `LV_BEZIER_VAL_MAX + 1` values or NULL if it's not a built-in path or out of memory
+ */
+static const int16_t * get_path_lut(lv_anim_path_lut_t lut_id, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    if(lut_id >= LV_ANIM_PATH_LUT_NONE) return NULL;
+    if(state.path_lut[lut_id]) return state.path_lut[lut_id];
+
+    /*Not asserted: without the table the values are calculated directly*/
+    int16_t * lut = lv_malloc((LV_BEZIER_VAL_MAX + 1) * sizeof(int16_t));
+    if(lut == NULL) return NULL;
+
+    int32_t t;
+    for(t = 0; t <= LV_BEZIER_VAL_MAX; t++) {
+        lut[t] = (int16_t)lv_cubic_bezier(t, x1, y1, x2, y2);
+    }
+
+    state.path_lut[lut_id] = lut;
+    return lut;
+}
+#endif
+
 static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms)
 {
 
@@ -782,11 +881,16 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
 
-    lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+    uint32_t key = ANIM_VAR_KEY(a_current->var);
+    state.anim_read_depth++;
+    uint32_t i = state.anim_cnt;
+    while(i > 0) {
+        i--;
+        if(state.anim_var_keys[i] != key) continue;
+        lv_anim_t * a = state.anims[i];
+        if(a == NULL) continue;
+
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
          *a wrapper callback is used here an the real callback data is stored in the `user_data`.
          *Therefore equality check would remove all animations.*/
@@ -795,28 +899,105 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
+            remove_anim(i);
+            /*Read by `anim_timer`. It need to know if a delete occurred in the animation array*/
             anim_mark_list_change();
 
             del_any = true;
-            del = true;
         }
-
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
     }
+    state.anim_read_depth--;
+    anims_compact();
 
     return del_any;
 }
 
-static void remove_anim(void * a)
+/**
+ * Delete an animation from the array, call its `deleted_cb` and free it
+ * @param i     index of the animation in the animation array
+ */
+static void remove_anim(uint32_t i)
 {
-    lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
-    if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
+    lv_anim_t * a = state.anims[i];
+    anims_unlink(i);
+    if(a->deleted_cb != NULL) a->deleted_cb(a);
     lv_free(a);
 }
+
+/**
+ * Add an animation to the end of the animation array
+ * @param a     pointer to an allocated animation
+ * @return      true: added; false: out of memory
+ */
+static bool anims_add(lv_anim_t * a)
+{
+    if(state.anim_cnt == state.anim_capacity) {
+        uint32_t new_capacity = state.anim_capacity ? state.anim_capacity * 2 : ANIM_ARRAY_MIN_CAPACITY;
+        if(!anims_resize(new_capacity)) return false;
+    }
+
+    state.anims[state.anim_cnt] = a;
+    state.anim_var_keys[state.anim_cnt] = ANIM_VAR_KEY(a->var);
+    state.anim_cnt++;
+    return true;
+}
+
+/**
+ * Reallocate the arrays of the animations
+ * @param capacity  the new number of slots
+ * @return          true: successfully resized; false: out of memory
+ */
+static bool anims_resize(uint32_t capacity)
+{
+    lv_anim_t ** new_anims = lv_realloc(state.anims, capacity * sizeof(lv_anim_t *));
+    LV_ASSERT_MALLOC(new_anims);
+    if(new_anims == NULL) return false;
+    state.anims = new_anims;
+
+    /*If only `anims` could be resized, the capacity is the size of the smaller array*/
+    state.anim_capacity = LV_MIN(state.anim_capacity, capacity);
+
+    uint32_t * new_keys = lv_realloc(state.anim_var_keys, capacity * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(new_keys);
+    if(new_keys == NULL) return false;
+    state.anim_var_keys = new_keys;
+
+    state.anim_capacity = capacity;
+    return true;
+}
+
+/**
+ * Clear the slot of an animation. The other animations are moved only in `anims_compact()`.
+ * @param i     index of the animation in the animation array
+ */
+static void anims_unlink(uint32_t i)
+{
+    state.anims[i] = NULL;
+    state.anim_deleted_cnt++;
+}
+
+/**
+ * Remove the cleared slots from the animation array keeping the order of the animations.
+ * Does nothing while the array is being read.
+ */
+static void anims_compact(void)
+{
+    if(state.anim_read_depth > 0 || state.anim_deleted_cnt == 0) return;
+
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < state.anim_cnt; i++) {
+        if(state.anims[i]) {
+            state.anims[cnt] = state.anims[i];
+            state.anim_var_keys[cnt] = state.anim_var_keys[i];
+            cnt++;
+        }
+    }
+    state.anim_cnt = cnt;
+    state.anim_deleted_cnt = 0;
+
+    /*Give back some memory after many animations have ended*/
+    if(state.anim_capacity > ANIM_ARRAY_MIN_CAPACITY && cnt < state.anim_capacity / 4) {
+        anims_resize(LV_MAX(state.anim_capacity / 2, ANIM_ARRAY_MIN_CAPACITY));
+    }
+}
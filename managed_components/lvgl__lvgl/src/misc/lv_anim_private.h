@@ -24,12 +24,37 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** The built-in cubic-bezier paths which can be evaluated from a lookup table*/
+typedef enum {
+    LV_ANIM_PATH_LUT_EASE_IN,
+    LV_ANIM_PATH_LUT_EASE_OUT,
+    LV_ANIM_PATH_LUT_EASE_IN_OUT,
+    LV_ANIM_PATH_LUT_OVERSHOOT,
+    LV_ANIM_PATH_LUT_NONE,      /**< Not a built-in path (e.g. custom bezier3), always calculated*/
+} lv_anim_path_lut_t;
+
 typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     bool anim_vsync_registered;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+
+    /** The running animations in the order they were started.
+     *  Deleted animations are set to `NULL` and removed only when no loop reads the array.*/
+    lv_anim_t ** anims;
+    /** `var` of the animations in `anims` as integer, to find the animations of a `var`
+     *  without reading each. Updated by `lv_anim_set_var` and in every animation step,
+     *  so `var` of a running animation can be changed meanwhile.*/
+    uint32_t * anim_var_keys;
+    uint32_t anim_cnt;          /**< Number of used slots in `anims` (including the deleted ones)*/
+    uint32_t anim_capacity;     /**< Number of allocated slots in `anims` and `anim_var_keys`*/
+    uint32_t anim_deleted_cnt;  /**< Number of `NULL` slots in `anims`*/
+    uint32_t anim_read_depth;   /**< Number of nested loops reading `anims`*/
+
+#if LV_USE_ANIM_PATH_LUT
+    /** The values of the built-in cubic-bezier paths for each time step. Created on first use.*/
+    int16_t * path_lut[LV_ANIM_PATH_LUT_NONE];
+#endif
 } lv_anim_state_t;
 
 /**********************
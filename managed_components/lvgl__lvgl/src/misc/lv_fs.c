@@ -366,6 +366,39 @@ lv_fs_res_t lv_fs_get_size(lv_fs_file_t * file_p, uint32_t * size_res)
     return ret;
 }
 
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, const void ** buf_p, uint32_t * size_p)
+{
+    *buf_p = NULL;
+    *size_p = 0;
+
+    if(file_p->drv == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->map_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    LV_PROFILER_FS_BEGIN;
+
+    lv_fs_res_t res = file_p->drv->map_cb(file_p->drv, file_p->file_d, buf_p, size_p);
+    if(res != LV_FS_RES_OK) {
+        *buf_p = NULL;
+        *size_p = 0;
+    }
+
+    LV_PROFILER_FS_END;
+
+    return res;
+}
+
+void lv_fs_unmap(lv_fs_drv_t * drv, const void * buf, uint32_t size)
+{
+    if(drv == NULL || buf == NULL) return;
+
+    if(drv->unmap_cb) drv->unmap_cb(drv, buf, size);
+}
+
 lv_fs_res_t lv_fs_path_get_size(const char * path, uint32_t * size_res)
 {
     lv_fs_file_t file;
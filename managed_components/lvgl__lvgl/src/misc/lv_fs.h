@@ -77,6 +77,8 @@ struct _lv_fs_drv_t {
     lv_fs_res_t (*write_cb)(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
     lv_fs_res_t (*seek_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+    lv_fs_res_t (*map_cb)(lv_fs_drv_t * drv, void * file_p, const void ** buf_p, uint32_t * size_p);
+    void (*unmap_cb)(lv_fs_drv_t * drv, const void * buf, uint32_t size);
 
     void * (*dir_open_cb)(lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(lv_fs_drv_t * drv, void * rddir_p, char * fn, uint32_t fn_len);
@@ -231,6 +233,25 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
  */
 lv_fs_res_t lv_fs_get_size(lv_fs_file_t * file_p, uint32_t * size_res);
 
+/**
+ * Map the whole content of an open file to memory to access it without reading.
+ * The mapped memory is read only and stays valid after the file is closed until `lv_fs_unmap` is called.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf_p     pointer to store the address of the content
+ * @param size_p    pointer to store the size of the content
+ * @return          LV_FS_RES_OK, LV_FS_RES_NOT_IMP if the driver can't map the file,
+ *                  or any error from `lv_fs_res_t`
+ */
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, const void ** buf_p, uint32_t * size_p);
+
+/**
+ * Release the memory mapped by `lv_fs_map`.
+ * @param drv       the driver of the mapped file, `file_p->drv`
+ * @param buf       the address returned by `lv_fs_map`
+ * @param size      the size returned by `lv_fs_map`
+ */
+void lv_fs_unmap(lv_fs_drv_t * drv, const void * buf, uint32_t size);
+
 /**
  * Get the size in bytes of a file at the given path.
  * @param path      the path of the file
@@ -12,6 +12,7 @@
 #include "../stdlib/lv_sprintf.h"
 #include "lv_assert.h"
 #include "lv_ll.h"
+#include "lv_math.h"
 #include "lv_profiler.h"
 
 /*********************
@@ -24,6 +25,9 @@
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
 
+/*Keep the due ticks in the heap comparable even if the tick counter wraps around*/
+#define HEAP_MAX_DELAY  (INT32_MAX / 2)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,6 +38,17 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+#if LV_USE_TIMER_HEAP
+    static uint32_t heap_run_ready(void);
+    static bool heap_reserve(uint32_t timer_cnt);
+    static uint32_t heap_get_due(const lv_timer_t * timer);
+    static void heap_insert(lv_timer_t * timer);
+    static void heap_remove(lv_timer_t * timer);
+    static void heap_update(lv_timer_t * timer);
+    static void heap_sift_up(uint32_t index);
+    static void heap_sift_down(uint32_t index);
+    static bool heap_is_before(const lv_timer_t * a, const lv_timer_t * b);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -90,6 +105,9 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_USE_TIMER_HEAP
+    uint32_t time_until_next = heap_run_ready();
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     lv_timer_t * timer_active;
@@ -127,6 +145,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
     }
+#endif /*LV_USE_TIMER_HEAP*/
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -166,6 +185,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+#if LV_USE_TIMER_HEAP
+    /*Make room for the timer in the heap first, so that it can be always scheduled*/
+    if(!heap_reserve(state.heap_timer_cnt + 1)) return NULL;
+#endif
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -178,6 +202,13 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
 
+#if LV_USE_TIMER_HEAP
+    state.heap_timer_cnt++;
+    new_timer->heap_pass = state.heap_pass - 1;
+    new_timer->heap_seq = state.heap_seq++;
+    heap_insert(new_timer);
+#endif
+
     state.timer_created = true;
 
     lv_timer_handler_resume();
@@ -193,6 +224,12 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_index != LV_TIMER_HEAP_NONE) heap_remove(timer);
+    if(state.heap_exec_timer == timer) state.heap_exec_timer = NULL;
+    state.heap_timer_cnt--;
+#endif
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,12 +240,19 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_index != LV_TIMER_HEAP_NONE) heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+#if LV_USE_TIMER_HEAP
+    /*The timer being executed is added back to the heap when its callback returns*/
+    if(timer->heap_index == LV_TIMER_HEAP_NONE && timer != state.heap_exec_timer) heap_insert(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -216,18 +260,29 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
+    lv_timer_handler_resume();
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
+    lv_timer_handler_resume();
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -246,6 +301,9 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+    heap_update(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -260,6 +318,15 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+#if LV_USE_TIMER_HEAP
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_size = 0;
+    state.heap_capacity = 0;
+    state.heap_timer_cnt = 0;
+    state.heap_exec_timer = NULL;
+#endif
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -386,3 +453,159 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+#if LV_USE_TIMER_HEAP
+
+/**
+ * Run the ready timers in the order of their due ticks. Each timer runs at most once.
+ * @return the time until the next timer is ready or `LV_NO_TIMER_READY`
+ */
+static uint32_t heap_run_ready(void)
+{
+    state.heap_pass++;
+
+    while(state.heap_size > 0) {
+        lv_timer_t * timer = state.heap[0];
+        if(timer->heap_pass == state.heap_pass) break;
+        if((int32_t)(timer->heap_due - lv_tick_get()) > 0) break;
+
+        /*Remove it while it runs so that the callback can freely pause, resume or delete it*/
+        heap_remove(timer);
+        timer->heap_pass = state.heap_pass;
+        state.heap_exec_timer = timer;
+        state.timer_deleted = false;
+
+        lv_timer_exec(timer);
+
+        if(state.heap_exec_timer) {
+            /*`last_run` has changed*/
+            if(timer->heap_index != LV_TIMER_HEAP_NONE) heap_update(timer);
+            else if(!timer->paused) heap_insert(timer);
+        }
+    }
+    state.heap_exec_timer = NULL;
+
+    if(state.heap_size == 0) return LV_NO_TIMER_READY;
+
+    int32_t time_until_next = (int32_t)(state.heap[0]->heap_due - lv_tick_get());
+    return time_until_next > 0 ? (uint32_t)time_until_next : 0;
+}
+
+/**
+ * Make sure the heap can store all timers
+ * @param timer_cnt     the number of timers
+ * @return              false if there is not enough memory
+ */
+static bool heap_reserve(uint32_t timer_cnt)
+{
+    if(timer_cnt <= state.heap_capacity) return true;
+
+    uint32_t capacity = state.heap_capacity ? state.heap_capacity * 2 : 16;
+    lv_timer_t ** heap = lv_realloc(state.heap, capacity * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(heap);
+    if(heap == NULL) return false;
+
+    state.heap = heap;
+    state.heap_capacity = capacity;
+    return true;
+}
+
+/**
+ * Get the tick when a timer is ready
+ */
+static uint32_t heap_get_due(const lv_timer_t * timer)
+{
+    /*If the repeat count is over, the timer is deleted or paused in the next `lv_timer_handler()`*/
+    if(timer->repeat_count == 0) return lv_tick_get();
+
+    return lv_tick_get() + LV_MIN(lv_timer_time_remaining((lv_timer_t *)timer), HEAP_MAX_DELAY);
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    uint32_t index = state.heap_size++;
+    timer->heap_due = heap_get_due(timer);
+    timer->heap_index = index;
+    state.heap[index] = timer;
+    heap_sift_up(index);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    timer->heap_index = LV_TIMER_HEAP_NONE;
+
+    state.heap_size--;
+    if(index == state.heap_size) return;
+
+    /*Move the last timer to the free place and restore the order*/
+    lv_timer_t * last = state.heap[state.heap_size];
+    state.heap[index] = last;
+    last->heap_index = index;
+    heap_sift_up(index);
+    heap_sift_down(last->heap_index);
+}
+
+/**
+ * Update the position of a timer after its period, last run or repeat count has changed
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_index == LV_TIMER_HEAP_NONE) return;
+
+    timer->heap_due = heap_get_due(timer);
+    heap_sift_up(timer->heap_index);
+    heap_sift_down(timer->heap_index);
+}
+
+static void heap_sift_up(uint32_t index)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[index];
+    while(index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if(!heap_is_before(timer, heap[parent])) break;
+        heap[index] = heap[parent];
+        heap[index]->heap_index = index;
+        index = parent;
+    }
+    heap[index] = timer;
+    timer->heap_index = index;
+}
+
+static void heap_sift_down(uint32_t index)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[index];
+    while(1) {
+        uint32_t child = index * 2 + 1;
+        if(child >= state.heap_size) break;
+        if(child + 1 < state.heap_size && heap_is_before(heap[child + 1], heap[child])) child++;
+        if(!heap_is_before(heap[child], timer)) break;
+        heap[index] = heap[child];
+        heap[index]->heap_index = index;
+        index = child;
+    }
+    heap[index] = timer;
+    timer->heap_index = index;
+}
+
+/**
+ * Check if a timer needs to run before an other one
+ */
+static bool heap_is_before(const lv_timer_t * a, const lv_timer_t * b)
+{
+    int32_t diff = (int32_t)(a->heap_due - b->heap_due);
+    if(diff != 0) return diff < 0;
+
+    /*The timers which already ran in this `lv_timer_handler()` call go last,
+     *so a timer with 0 period doesn't hide the others*/
+    bool a_ran = a->heap_pass == state.heap_pass;
+    bool b_ran = b->heap_pass == state.heap_pass;
+    if(a_ran != b_ran) return b_ran;
+
+    /*Run the newer timer first as the timer list does*/
+    return (int32_t)(a->heap_seq - b->heap_seq) > 0;
+}
+
+#endif /*LV_USE_TIMER_HEAP*/
@@ -20,6 +20,10 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_TIMER_HEAP
+#define LV_TIMER_HEAP_NONE  0xFFFFFFFF
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +39,12 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+#if LV_USE_TIMER_HEAP
+    uint32_t heap_due;         /**< Tick when the timer is ready. The key in the timer heap */
+    uint32_t heap_index;       /**< Position in the timer heap or `LV_TIMER_HEAP_NONE` if paused */
+    uint32_t heap_pass;        /**< The last `lv_timer_handler()` call in which the timer ran */
+    uint32_t heap_seq;         /**< Creation order. Of the timers ready at the same tick the newer runs first */
+#endif
 };
 
 typedef struct {
@@ -54,6 +64,16 @@ typedef struct {
 
     lv_timer_handler_resume_cb_t resume_cb;
     void * resume_data;
+
+#if LV_USE_TIMER_HEAP
+    lv_timer_t ** heap;        /**< The not paused timers, the one to run first at index 0 */
+    uint32_t heap_size;
+    uint32_t heap_capacity;    /**< Never less than the number of timers, so inserting can't fail */
+    uint32_t heap_timer_cnt;
+    uint32_t heap_pass;        /**< Incremented by every `lv_timer_handler()` call */
+    uint32_t heap_seq;         /**< Incremented by every created timer */
+    lv_timer_t * heap_exec_timer; /**< The timer being executed or NULL if it was deleted */
+#endif
 } lv_timer_state_t;
 
 /**********************
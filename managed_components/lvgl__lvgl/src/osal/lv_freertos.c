@@ -19,8 +19,14 @@
 
 #include "../tick/lv_tick.h"
 #include "../misc/lv_log.h"
+#include "../misc/lv_timer.h"
+#include "../misc/lv_math.h"
 #include "../core/lv_global.h"
 
+#ifdef ESP_PLATFORM
+    #include "esp_timer.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -54,6 +60,10 @@ static void prvTestAndDecrement(lv_thread_sync_t * pxCond,
                                 uint32_t ulLocalWaitingThreads);
 #endif
 
+static uint32_t prvTicklessGetTick(void);
+
+static void prvTicklessResume(void * pvData);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -424,6 +434,48 @@ void lv_sleep_ms(uint32_t ms)
     vTaskDelay(ms / portTICK_PERIOD_MS);
 }
 
+void lv_freertos_tickless_init(void)
+{
+    if(globals->freertos_tickless_wakeup == NULL) {
+        globals->freertos_tickless_wakeup = xSemaphoreCreateBinary();
+        if(globals->freertos_tickless_wakeup == NULL) {
+            LV_LOG_ERROR("xSemaphoreCreateBinary failed!");
+            return;
+        }
+    }
+
+    lv_tick_set_cb(prvTicklessGetTick);
+    lv_timer_handler_set_resume_cb(prvTicklessResume, NULL);
+}
+
+void lv_freertos_tickless_wait(uint32_t time_until_next)
+{
+    if(globals->freertos_tickless_wakeup == NULL) {
+        /* Poll as the resume callback can't wake up the task */
+        lv_sleep_ms(LV_MIN(time_until_next, LV_DEF_REFR_PERIOD));
+        return;
+    }
+
+    /* Round up so that the timer is surely due after waking up,
+     * but a timer which is already due doesn't need to wait */
+    TickType_t xTicks;
+    if(time_until_next == LV_NO_TIMER_READY) xTicks = portMAX_DELAY;
+    else xTicks = (time_until_next + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+
+    xSemaphoreTake(globals->freertos_tickless_wakeup, xTicks);
+}
+
+void lv_freertos_tickless_deinit(void)
+{
+    lv_tick_set_cb(NULL);
+    lv_timer_handler_set_resume_cb(NULL, NULL);
+
+    if(globals->freertos_tickless_wakeup) {
+        vSemaphoreDelete(globals->freertos_tickless_wakeup);
+        globals->freertos_tickless_wakeup = NULL;
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -543,6 +595,23 @@ static void prvCheckCondInitIsr(lv_thread_sync_t * pxCond)
     }
 }
 
+static uint32_t prvTicklessGetTick(void)
+{
+#ifdef ESP_PLATFORM
+    return (uint32_t)(esp_timer_get_time() / 1000);
+#else
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+#endif
+}
+
+static void prvTicklessResume(void * pvData)
+{
+    LV_UNUSED(pvData);
+
+    /* A binary semaphore: any number of wakeups before the wait results in one wakeup */
+    xSemaphoreGive(globals->freertos_tickless_wakeup);
+}
+
 #if !LV_USE_FREERTOS_TASK_NOTIFY
 static void prvTestAndDecrement(lv_thread_sync_t * pxCond,
                                 uint32_t ulLocalWaitingThreads)
@@ -84,6 +84,27 @@ void lv_freertos_task_switch_in(const char * name);
  */
 void lv_freertos_task_switch_out(void);
 
+/**
+ * Drive LVGL without periodic ticks: LVGL gets the time from FreeRTOS (from `esp_timer` on ESP-IDF)
+ * instead of `lv_tick_inc()` calls, and `lv_freertos_tickless_wait()` is woken up when LVGL needs
+ * to run earlier than the last `lv_timer_handler()` returned, e.g. when something was invalidated.
+ * Call it after `lv_init()`.
+ * @note    it uses `lv_timer_handler_set_resume_cb()` and `lv_tick_set_cb()`
+ */
+void lv_freertos_tickless_init(void);
+
+/**
+ * Block the calling task until the next LVGL timer is due or LVGL needs to run earlier.
+ * The task running LVGL can be as simple as `while(1) lv_freertos_tickless_wait(lv_timer_handler());`
+ * @param time_until_next   the return value of `lv_timer_handler()`
+ */
+void lv_freertos_tickless_wait(uint32_t time_until_next);
+
+/**
+ * Restore the default tick and resume callbacks and free the resources of the tickless mode
+ */
+void lv_freertos_tickless_deinit(void);
+
 
 /**********************
  *      MACROS
@@ -222,14 +222,26 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
         case LV_EVENT_RENDER_START:
             info->measured.render_in_progress = 1;
             info->measured.render_start = lv_tick_get();
+            info->measured.flush_overlap_start = info->measured.render_start;
             break;
         case LV_EVENT_RENDER_READY:
             info->measured.render_in_progress = 0;
             info->measured.render_elaps_sum += lv_tick_elaps(info->measured.render_start);
             info->measured.render_cnt++;
+            if(info->measured.flush_in_progress) {
+                info->measured.flush_overlap_elaps_sum += lv_tick_elaps(info->measured.flush_overlap_start);
+            }
             break;
         case LV_EVENT_FLUSH_START:
         case LV_EVENT_FLUSH_WAIT_START:
+            if(code == LV_EVENT_FLUSH_WAIT_START && info->measured.flush_in_progress) {
+                /*Everything rendered since the last flush_cb returned ran in parallel with that flush*/
+                if(info->measured.render_in_progress) {
+                    info->measured.flush_overlap_elaps_sum += lv_tick_elaps(info->measured.flush_overlap_start);
+                }
+                info->measured.flush_in_progress = 0;
+            }
+
             if(info->measured.render_in_progress) {
                 info->measured.flush_in_render_start = lv_tick_get();
             }
@@ -245,6 +257,12 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
             else {
                 info->measured.flush_not_in_render_elaps_sum += lv_tick_elaps(info->measured.flush_not_in_render_start);
             }
+
+            /*If flush_cb returned before the flush is ready LVGL can render the next area in the meantime*/
+            if(code == LV_EVENT_FLUSH_FINISH && disp->flushing) {
+                info->measured.flush_in_progress = 1;
+                info->measured.flush_overlap_start = lv_tick_get();
+            }
             break;
         case LV_EVENT_DELETE:
             lv_timer_delete(disp->perf_sysmon_backend.timer);
@@ -286,6 +304,13 @@ static void perf_dump_info(lv_display_t * disp)
                                                                      info->measured.flush_in_render_elaps_sum) /
                                                                     info->measured.render_cnt) : 0;
 
+    /*The flush time is the time LVGL was blocked by flushing. The overlap is the time it could render meanwhile.*/
+    uint32_t flush_blocked_sum = info->measured.flush_in_render_elaps_sum +
+                                 info->measured.flush_not_in_render_elaps_sum;
+    uint32_t flush_total_sum = flush_blocked_sum + info->measured.flush_overlap_elaps_sum;
+    info->calculated.flush_overlap = flush_total_sum ?
+                                     (info->measured.flush_overlap_elaps_sum * 100 / flush_total_sum) : 0;
+
     info->calculated.cpu_avg_total = ((info->calculated.cpu_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.cpu) / info->calculated.run_cnt;
     info->calculated.fps_avg_total = ((info->calculated.fps_avg_total * (info->calculated.run_cnt - 1)) +
@@ -296,6 +321,8 @@ static void perf_dump_info(lv_display_t * disp)
     lv_sysmon_perf_info_t prev_info = *info;
     lv_memzero(info, sizeof(lv_sysmon_perf_info_t));
     info->measured.refr_start = prev_info.measured.refr_start;
+    info->measured.flush_in_progress = prev_info.measured.flush_in_progress;
+    info->measured.flush_overlap_start = lv_tick_get();
     info->calculated.cpu_avg_total = prev_info.calculated.cpu_avg_total;
 #if LV_SYSMON_PROC_IDLE_AVAILABLE
     info->calculated.cpu_proc = prev_info.calculated.cpu_proc;
@@ -322,18 +349,20 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
 #if LV_SYSMON_PROC_IDLE_AVAILABLE
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
-           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
+           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms, %" LV_PRIu32 "%% overlap), "
            "CPU (total %" LV_PRIu32 "%% proc %" LV_PRIu32 "%%)\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
+           perf->calculated.flush_overlap,
            perf->calculated.cpu, perf->calculated.cpu_proc);
 #else
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
-           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
+           "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms, %" LV_PRIu32 "%% overlap), "
            "CPU %" LV_PRIu32 "%%\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
+           perf->calculated.flush_overlap,
            perf->calculated.cpu);
 #endif
 #else
@@ -342,19 +371,19 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
     lv_label_set_text_fmt(
         label,
         "%" LV_PRIu32" FPS | CPU (%" LV_PRIu32 "%% | %" LV_PRIu32 "%%)\n"
-        "%" LV_PRIu32" ms (%" LV_PRIu32" | %" LV_PRIu32")",
+        "%" LV_PRIu32" ms (%" LV_PRIu32" | %" LV_PRIu32", %" LV_PRIu32"%%)",
         perf->calculated.fps, perf->calculated.cpu, perf->calculated.cpu_proc,
         perf->calculated.render_avg_time + perf->calculated.flush_avg_time,
-        perf->calculated.render_avg_time, perf->calculated.flush_avg_time
+        perf->calculated.render_avg_time, perf->calculated.flush_avg_time, perf->calculated.flush_overlap
     );
 #else
     lv_label_set_text_fmt(
         label,
         "%" LV_PRIu32" FPS, %" LV_PRIu32 "%% CPU\n"
-        "%" LV_PRIu32" ms (%" LV_PRIu32" | %" LV_PRIu32")",
+        "%" LV_PRIu32" ms (%" LV_PRIu32" | %" LV_PRIu32", %" LV_PRIu32"%%)",
         perf->calculated.fps, perf->calculated.cpu,
         perf->calculated.render_avg_time + perf->calculated.flush_avg_time,
-        perf->calculated.render_avg_time, perf->calculated.flush_avg_time
+        perf->calculated.render_avg_time, perf->calculated.flush_avg_time, perf->calculated.flush_overlap
     );
 #endif /*LV_SYSMON_PROC_IDLE_AVAILABLE*/
 #endif /*LV_USE_PERF_MONITOR_LOG_MODE*/
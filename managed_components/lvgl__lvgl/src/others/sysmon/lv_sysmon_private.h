@@ -46,8 +46,11 @@ struct _lv_sysmon_perf_info_t {
         uint32_t flush_in_render_elaps_sum;
         uint32_t flush_not_in_render_start;
         uint32_t flush_not_in_render_elaps_sum;
+        uint32_t flush_overlap_start;
+        uint32_t flush_overlap_elaps_sum; /*Rendering while a flush was still in progress*/
         uint32_t last_report_timestamp;
         uint32_t render_in_progress : 1;
+        uint32_t flush_in_progress : 1;   /*flush_cb returned but the flush is not ready yet*/
     } measured;
 
     struct {
@@ -59,6 +62,7 @@ struct _lv_sysmon_perf_info_t {
         uint32_t refr_avg_time;
         uint32_t render_avg_time;       /**< Pure rendering time without flush time*/
         uint32_t flush_avg_time;        /**< Pure flushing time without rendering time*/
+        uint32_t flush_overlap;         /**< Percentage of the flush time hidden behind rendering*/
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
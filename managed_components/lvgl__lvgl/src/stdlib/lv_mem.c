@@ -181,6 +181,9 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 {
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     lv_mem_monitor_core(mon_p);
+
+    mon_p->draw_task_pool_size = LV_GLOBAL_DEFAULT()->draw_info.task_pool_size;
+    mon_p->draw_task_pool_used = LV_GLOBAL_DEFAULT()->draw_info.task_pool_used;
 }
 
 /**********************
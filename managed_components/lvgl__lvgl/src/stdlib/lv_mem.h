@@ -41,6 +41,8 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+    size_t draw_task_pool_size; /**< Heap memory allocated for the draw tasks (including the cached chunks) */
+    size_t draw_task_pool_used; /**< Memory used by the not finished draw tasks and their descriptors */
 } lv_mem_monitor_t;
 
 /**********************
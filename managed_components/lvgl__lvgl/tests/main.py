@@ -34,8 +34,14 @@ test_options = {
     'OPTIONS_TEST_SYSHEAP': 'Test config, system heap, 32 bit color depth',
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
     'OPTIONS_TEST_VG_LITE': 'VG-Lite simulator with full config, 32 bit color depth',
+    'OPTIONS_TEST_DRAW_SW_ESP32S3': 'Test config, system heap, model of the ESP32-S3 blend backend, 32 bit color depth',
+    'OPTIONS_TEST_DRAW_SW_MULTI_UNIT': 'Test config, system heap, 4 software draw units with tile split, 32 bit color depth',
 }
 
+# The x86 blend backend needs GCC or Clang targeting x86-64
+if platform.system() != 'Windows' and platform.machine() in ('x86_64', 'AMD64') and not os.getenv('NON_AMD64_BUILD'):
+    test_options['OPTIONS_TEST_DRAW_SW_X86'] = 'Test config, system heap, x86 blend backend, 32 bit color depth'
+
 
 def get_option_description(option_name):
     if option_name in build_only_options:
@@ -211,6 +217,24 @@ def generate_test_images():
                     img.to_c_array(output, compress=compress)
                     print(f"converting {os.path.basename(png)}, format: {fmt.name}, compress: {compress_name}")
 
+    # Images compressed in bands and their uncompressed references
+    outputs = os.path.join(lvgl_test_dir, "test_images/band/")
+    os.makedirs(outputs, exist_ok=True)
+    logo = os.path.join(lvgl_test_dir, "src/test_assets/test_img_lvgl_logo.png")
+    band_images = ((ColorFormat.ARGB8888, CompressMethod.NONE, 0),
+                   (ColorFormat.ARGB8888, CompressMethod.LZ4, 8),
+                   (ColorFormat.RGB565, CompressMethod.NONE, 0),
+                   (ColorFormat.RGB565, CompressMethod.RLE, 7))
+    for fmt, compress, band_rows in band_images:
+        name = f"test_lvgl_logo_{fmt.name}"
+        if band_rows:
+            name += f"_{compress.name}_band{band_rows}"
+        img = LVGLImage().from_png(logo, cf=fmt, background=0xffffff)
+        img.to_c_array(os.path.join(outputs, f"{name}.c"), compress=compress, band_rows=band_rows)
+        if band_rows:
+            img.to_bin(os.path.join(outputs, f"{name}.bin"), compress=compress, band_rows=band_rows)
+        print(f"converting {os.path.basename(logo)}, format: {fmt.name}, compress: {compress.name}, band rows: {band_rows}")
+
 
 def clean_build_dirs_with_filter(build_dir, clean_filters):
     for entry in os.listdir(build_dir):
@@ -2,7 +2,7 @@
 #define LV_TEST_CONF_FULL_H
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
-#define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_MASK_CACHE_SIZE      (64 * 1024)
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -14,6 +14,9 @@
 #define LV_USE_ASSERT_STYLE             1
 #define LV_USE_FLOAT      1
 #define LV_USE_MATRIX     1
+#define LV_USE_DISPLAY_FLUSH_DIFF   1
+#define LV_USE_TIMER_HEAP           1
+#define LV_USE_ANIM_PATH_LUT        1
 
 #define LV_FONT_MONTSERRAT_8    1
 #define LV_FONT_MONTSERRAT_10   1
@@ -45,6 +48,8 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (256 * 1024)
+#define LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE (128 * 1024)
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
@@ -72,6 +77,8 @@
 
 #define LV_FS_DEFAULT_DRIVER_LETTER 'A'
 
+#define LV_BIN_DECODER_MAP_FILES 1
+
 #define LV_USE_MONKEY       1
 #define LV_USE_RLE          1
 #define LV_USE_LODEPNG      1
@@ -138,6 +145,8 @@
 #define LV_USE_OBJ_NAME         1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_IMAGE_CACHE_COST_AWARE 1
+#define LV_IMAGE_CACHE_SHARD_CNT 4
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
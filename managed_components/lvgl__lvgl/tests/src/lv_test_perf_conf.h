@@ -197,16 +197,11 @@
             #define LV_DRAW_SW_COMPLEX          1
 
             #if LV_DRAW_SW_COMPLEX == 1
-                /** Allow buffering some shadow calculation.
-                *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-                *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
-                #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
-
-                /** Set number of maximally-cached circle data.
-                *  The circumference of 1/4 circle are saved for anti-aliasing.
-                *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
+                /** Byte budget of the cache of circle masks and shadow corners.
+                *  A rounded corner costs about `radius * 6` bytes and a shadow corner
+                *  `2 * (shadow_width + radius)^2` bytes. Entries larger than 1/4 of the budget are not cached.
                 *  - 0: disables caching */
-                #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+                #define LV_DRAW_SW_MASK_CACHE_SIZE (8 * 1024)
             #endif
 
             #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
@@ -5,6 +5,11 @@
 
 #include "unity/unity.h"
 
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <pthread.h>
+    #include <time.h>
+#endif
+
 static uint32_t MEM_SIZE = 0;
 
 // Cache size in bytes
@@ -304,4 +309,364 @@ void test_cache_sc_da_eviction_second_chance_spares_referenced_entries(void)
     lv_cache_destroy(cache, NULL);
 }
 
+/*Add the entry if it's not cached yet. Return true on a cache hit.*/
+static bool cache_acquire_or_add(lv_cache_t * cache, int32_t key, size_t size, uint32_t cost)
+{
+    test_data_t search_key = {
+        .slot.size = size,
+        .slot.cost = cost,
+        .key1 = key,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    bool hit = entry != NULL;
+    if(!hit) entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+    return hit;
+}
+
+static bool cache_has(lv_cache_t * cache, int32_t key)
+{
+    test_data_t search_key = { .key1 = key };
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry != NULL) lv_cache_release(cache, entry, NULL);
+    return entry != NULL;
+}
+
+void test_cache_gds_rb_evicts_large_cheap_entries(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_gds_rb_size, CACHE_SIZE_BYTES);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    for(int32_t i = 0; i < 5; i++) cache_acquire_or_add(cache, i, 100, 10);
+    cache_acquire_or_add(cache, 100, 500, 10);
+    TEST_ASSERT_EQUAL(1000, lv_cache_get_size(cache, NULL));
+
+    /*The large entry is evicted first, though it was used last*/
+    cache_acquire_or_add(cache, 5, 100, 10);
+    TEST_ASSERT_FALSE(cache_has(cache, 100));
+    for(int32_t i = 0; i <= 5; i++) TEST_ASSERT_TRUE(cache_has(cache, i));
+
+    /*Unless it's much slower to create*/
+    cache_acquire_or_add(cache, 101, 500, 1000);
+    cache_acquire_or_add(cache, 6, 100, 10);
+    TEST_ASSERT_TRUE(cache_has(cache, 101));
+    TEST_ASSERT_FALSE(cache_has(cache, 0));
+    TEST_ASSERT_FALSE(cache_has(cache, 1));
+    for(int32_t i = 2; i <= 6; i++) TEST_ASSERT_TRUE(cache_has(cache, i));
+    TEST_ASSERT_EQUAL(1000, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_gds_rb_evicts_lru_on_tie(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_gds_rb_size, CACHE_SIZE_BYTES);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    for(int32_t i = 0; i < 10; i++) cache_acquire_or_add(cache, i, 100, 10);
+    TEST_ASSERT_TRUE(cache_acquire_or_add(cache, 0, 100, 10));
+
+    cache_acquire_or_add(cache, 10, 100, 10);
+    TEST_ASSERT_TRUE(cache_has(cache, 0));
+    TEST_ASSERT_FALSE(cache_has(cache, 1));
+
+    /*Referenced entries are not evicted*/
+    test_data_t search_key = { .key1 = 2 };
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    cache_acquire_or_add(cache, 11, 100, 10);
+    TEST_ASSERT_FALSE(cache_has(cache, 3));
+    lv_cache_release(cache, entry, NULL);
+    TEST_ASSERT_TRUE(cache_has(cache, 2));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+/*Replay a trace of small, slow to decode icons and large photos, and sum the decode time of the misses*/
+static void replay_trace(const char * name, const lv_cache_class_t * cache_class, uint32_t * hit_cnt,
+                         uint32_t * decode_time)
+{
+    const uint32_t icon_cnt = 40;
+    const uint32_t photo_cnt = 8;
+    const uint32_t request_cnt = 20000;
+
+    lv_cache_t * cache = create_cache(cache_class, 1024 * 1024);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    uint32_t seed = 12345;
+    *hit_cnt = 0;
+    *decode_time = 0;
+    for(uint32_t i = 0; i < request_cnt; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t r = seed >> 8;
+
+        uint32_t key;
+        size_t size;
+        uint32_t cost;
+        if(r % 10 < 7) {
+            /*Some icons are used much more often than the others*/
+            key = ((r / 10) % icon_cnt) * ((r / 1000) % icon_cnt) / icon_cnt;
+            size = 2048 + (key % 6) * 1024;
+            cost = 2;    /*Mostly the time to open the file*/
+        }
+        else {
+            key = icon_cnt + (r / 10) % photo_cnt;
+            size = (150 + (key % 4) * 100) * 1024;
+            cost = 5 + size / (40 * 1024);
+        }
+
+        if(cache_acquire_or_add(cache, key, size, cost)) (*hit_cnt)++;
+        else *decode_time += cost;
+    }
+
+    TEST_PRINTF("%s: hit ratio %d%%, decode time %d ms", name, (int)(*hit_cnt * 100 / request_cnt),
+                (int)*decode_time);
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_gds_rb_trace_benchmark(void)
+{
+    uint32_t lru_rb_hit, lru_rb_time;
+    uint32_t lru_ll_hit, lru_ll_time;
+    uint32_t gds_rb_hit, gds_rb_time;
+    replay_trace("lru_rb_size", &lv_cache_class_lru_rb_size, &lru_rb_hit, &lru_rb_time);
+    replay_trace("lru_ll_size", &lv_cache_class_lru_ll_size, &lru_ll_hit, &lru_ll_time);
+    replay_trace("gds_rb_size", &lv_cache_class_gds_rb_size, &gds_rb_hit, &gds_rb_time);
+
+    /*The LRU classes evict the same entries*/
+    TEST_ASSERT_EQUAL_UINT32(lru_rb_hit, lru_ll_hit);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(lru_rb_hit, gds_rb_hit);
+    TEST_ASSERT_LESS_THAN_UINT32(lru_rb_time, gds_rb_time);
+}
+
+static uint32_t hash_cb(const test_data_t * key)
+{
+    return (uint32_t)key->key1 * 2654435761u ^ (uint32_t)key->key2;
+}
+
+static lv_cache_t * create_sharded_cache(const lv_cache_class_t * cache_class, size_t max_size, uint32_t shard_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+    return lv_cache_create_sharded(cache_class, sizeof(test_data_t), max_size, ops, shard_cnt);
+}
+
+void test_cache_sharded_add_acquire(void)
+{
+    lv_cache_t * cache = create_sharded_cache(&lv_cache_class_lru_rb_count, 4 * CACHE_EXPECTED_DATA_CNT, 4);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_add_acquire_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+
+    /*The entries are spread over the shards but seen as one cache*/
+    TEST_ASSERT_EQUAL_size_t(CACHE_EXPECTED_DATA_CNT, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_size_t(3 * CACHE_EXPECTED_DATA_CNT, lv_cache_get_free_size(cache, NULL));
+    uint32_t used_shard_cnt = 0;
+    for(uint32_t i = 0; i < cache->shard_cnt; i++) {
+        if(lv_cache_get_size(cache->shards[i], NULL) > 0) used_shard_cnt++;
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(1, used_shard_cnt);
+
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+    uint8_t elem[64];
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(elem), lv_cache_entry_get_size(sizeof(test_data_t)));
+    uint32_t iter_cnt = 0;
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) iter_cnt++;
+    lv_iter_destroy(iter);
+    TEST_ASSERT_EQUAL_UINT32(CACHE_EXPECTED_DATA_CNT, iter_cnt);
+
+    /*Referenced entries are freed on the last release*/
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &expected_data[0], NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_PTR(entry, lv_cache_acquire(cache, &expected_data[0], NULL));
+    lv_cache_drop(cache, &expected_data[0], NULL);
+    TEST_ASSERT_FALSE(cache_has(cache, 0));
+    lv_cache_release(cache, entry, NULL);
+    TEST_ASSERT_EQUAL_INT32(1, lv_cache_entry_get_ref(entry));
+    lv_cache_release(cache, entry, NULL);
+
+    TEST_ASSERT_TRUE(lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL_size_t(CACHE_EXPECTED_DATA_CNT - 2, lv_cache_get_size(cache, NULL));
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL_size_t(0, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_FALSE(lv_cache_evict_one(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_sharded_max_size(void)
+{
+    lv_cache_t * cache = create_sharded_cache(&lv_cache_class_lru_rb_size, CACHE_SIZE_BYTES, 4);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL_size_t(CACHE_SIZE_BYTES, lv_cache_get_max_size(cache, NULL));
+
+    /*Each shard can hold only a part of the cache*/
+    test_data_t search_key = { .slot.size = CACHE_SIZE_BYTES / 2, .key1 = 1 };
+    TEST_ASSERT_NULL(lv_cache_add(cache, &search_key, NULL));
+    search_key.slot.size = CACHE_SIZE_BYTES / 4;
+    lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+
+    lv_cache_set_max_size(cache, 2 * CACHE_SIZE_BYTES, NULL);
+    search_key.slot.size = CACHE_SIZE_BYTES / 2;
+    search_key.key1 = 2;
+    entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+
+    /*Make room for a new entry in every shard*/
+    lv_cache_reserve(cache, 2 * CACHE_SIZE_BYTES, NULL);
+    TEST_ASSERT_EQUAL_size_t(0, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_hit_stats(void)
+{
+    lv_cache_t * cache = create_sharded_cache(&lv_cache_class_lru_rb_count, CACHE_EXPECTED_DATA_CNT, 2);
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+
+    test_data_t search_key = { .key1 = 1 };
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key, NULL));
+    lv_cache_entry_t * entry = lv_cache_add(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+    for(uint32_t i = 0; i < 3; i++) {
+        entry = lv_cache_acquire(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        lv_cache_release(cache, entry, NULL);
+    }
+    search_key.key1 = 2;
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key, NULL));
+
+    /*Adding an entry is not a lookup*/
+    lv_cache_get_hit_stats(cache, &hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, miss_cnt);
+
+    lv_cache_reset_hit_stats(cache);
+    lv_cache_get_hit_stats(cache, &hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, miss_cnt);
+
+    lv_cache_destroy(cache, NULL);
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+
+#define CONTENTION_THREAD_CNT   4
+#define CONTENTION_KEY_CNT      256
+#define CONTENTION_ITER_CNT     50000
+
+typedef struct {
+    lv_cache_t * cache;
+    uint32_t seed;
+    uint32_t hit_cnt;
+} contention_thread_t;
+
+static uint32_t created_cnt;
+static uint32_t freed_cnt;
+
+static bool counted_create_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->magic = (uint32_t)node->key1 * 31u;
+    node->data = NULL;
+    __atomic_add_fetch(&created_cnt, 1, __ATOMIC_RELAXED);
+    return true;
+}
+
+static void counted_free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)node->key1 * 31u, node->magic);
+    __atomic_add_fetch(&freed_cnt, 1, __ATOMIC_RELAXED);
+}
+
+/*Look up random keys like the draw units do, and drop a key now and then*/
+static void * contention_thread_cb(void * arg)
+{
+    contention_thread_t * t = arg;
+    for(uint32_t i = 0; i < CONTENTION_ITER_CNT; i++) {
+        t->seed = t->seed * 1103515245 + 12345;
+        uint32_t r = t->seed >> 8;
+        test_data_t search_key = { .key1 = (int32_t)(r % CONTENTION_KEY_CNT) };
+
+        if(r % 1000 == 0) {
+            lv_cache_drop(t->cache, &search_key, NULL);
+            continue;
+        }
+
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(t->cache, &search_key, NULL);
+        if(entry == NULL) continue;
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        if(data->magic == (uint32_t)search_key.key1 * 31u) t->hit_cnt++;
+        lv_cache_release(t->cache, entry, NULL);
+    }
+
+    return NULL;
+}
+
+static uint32_t run_contention(uint32_t shard_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = (lv_cache_create_cb_t)counted_create_cb,
+        .free_cb = (lv_cache_free_cb_t)counted_free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+    lv_cache_t * cache = lv_cache_create_sharded(&lv_cache_class_lru_rb_count, sizeof(test_data_t),
+                                                 CONTENTION_KEY_CNT / 2, ops, shard_cnt);
+    TEST_ASSERT_NOT_NULL(cache);
+    created_cnt = 0;
+    freed_cnt = 0;
+
+    contention_thread_t threads[CONTENTION_THREAD_CNT];
+    pthread_t thread_ids[CONTENTION_THREAD_CNT];
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t i = 0; i < CONTENTION_THREAD_CNT; i++) {
+        threads[i] = (contention_thread_t) {
+            .cache = cache, .seed = i + 1
+        };
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread_ids[i], NULL, contention_thread_cb, &threads[i]));
+    }
+    uint32_t hit_cnt = 0;
+    for(uint32_t i = 0; i < CONTENTION_THREAD_CNT; i++) {
+        pthread_join(thread_ids[i], NULL);
+        hit_cnt += threads[i].hit_cnt;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    /*Every entry is released and only the cached ones are alive*/
+    TEST_ASSERT_GREATER_THAN_UINT32(CONTENTION_ITER_CNT, hit_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(CONTENTION_KEY_CNT / 2, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL_UINT32(created_cnt - freed_cnt, lv_cache_get_size(cache, NULL));
+    lv_cache_destroy(cache, NULL);
+    TEST_ASSERT_EQUAL_UINT32(created_cnt, freed_cnt);
+
+    uint32_t time_ms = (uint32_t)((end.tv_sec - start.tv_sec) * 1000 + (end.tv_nsec - start.tv_nsec) / 1000000);
+    TEST_PRINTF("%d shard(s), %d threads: %d ms", (int)shard_cnt, CONTENTION_THREAD_CNT, (int)time_ms);
+    return time_ms;
+}
+
+void test_cache_sharded_contention_benchmark(void)
+{
+    run_contention(1);
+    run_contention(8);
+}
+
+#endif /*LV_USE_OS == LV_OS_PTHREAD*/
+
 #endif
@@ -0,0 +1,238 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3
+
+#include "../../src/draw/sw/blend/esp32s3/lv_draw_sw_blend_esp32s3_to_rgb565.h"
+
+/* Compare the ESP32-S3 RGB565 blend hooks with the generic C blending.
+ * On the host the portable model of the PIE kernels runs, so the head/tail and
+ * alignment handling of the wrappers is checked bit-exact against `lv_color_16_16_mix()`.*/
+
+#define BUF_W   53
+#define BUF_H   7
+#define STRIDE  (BUF_W + 11)
+
+static uint16_t dest_buf[STRIDE * BUF_H + 8];
+static uint16_t ref_buf[STRIDE * BUF_H + 8];
+static uint16_t src_buf[STRIDE * BUF_H + 8];
+static uint8_t mask_buf[STRIDE * BUF_H + 16];
+
+static uint32_t rnd_state;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return rnd_state >> 8;
+}
+
+void setUp(void)
+{
+    rnd_state = 1;
+    for(uint32_t i = 0; i < sizeof(dest_buf) / sizeof(dest_buf[0]); i++) {
+        dest_buf[i] = (uint16_t)rnd();
+        src_buf[i] = (uint16_t)rnd();
+    }
+    for(uint32_t i = 0; i < sizeof(mask_buf); i++) {
+        /*Use many fully transparent and opaque values too as they have their own paths in the C code*/
+        uint32_t r = rnd();
+        mask_buf[i] = (r & 0x300) == 0 ? 0x00 : (r & 0x300) == 0x100 ? 0xFF : (uint8_t)r;
+    }
+    lv_memcpy(ref_buf, dest_buf, sizeof(dest_buf));
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static uint16_t ref_mix(uint16_t fg, uint16_t bg, const uint8_t * mask, lv_opa_t opa)
+{
+    lv_opa_t mix = opa >= LV_OPA_MAX ? LV_OPA_COVER : opa;
+    if(mask) mix = opa >= LV_OPA_MAX ? *mask : LV_OPA_MIX2(*mask, opa);
+    return lv_color_16_16_mix(fg, bg, mix);
+}
+
+static void check_fill(lv_result_t (*hook)(lv_draw_sw_blend_fill_dsc_t *), uint32_t dest_ofs, uint32_t mask_ofs,
+                       int32_t w, lv_opa_t opa, bool use_mask)
+{
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = &dest_buf[dest_ofs];
+    dsc.dest_w = w;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = STRIDE * 2;
+    dsc.color = lv_color_hex(0x3a7fc4);
+    dsc.opa = opa;
+    dsc.mask_buf = use_mask ? &mask_buf[mask_ofs] : NULL;
+    dsc.mask_stride = STRIDE;
+
+    uint16_t color16 = lv_color_to_u16(dsc.color);
+    for(int32_t y = 0; y < BUF_H; y++) {
+        for(int32_t x = 0; x < w; x++) {
+            uint16_t * d = &ref_buf[dest_ofs + y * STRIDE + x];
+            *d = ref_mix(color16, *d, use_mask ? &mask_buf[mask_ofs + y * STRIDE + x] : NULL, opa);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, hook(&dsc));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(ref_buf, dest_buf, sizeof(dest_buf) / sizeof(dest_buf[0]));
+}
+
+static void check_image(lv_result_t (*hook)(lv_draw_sw_blend_image_dsc_t *), uint32_t dest_ofs, uint32_t src_ofs,
+                        uint32_t mask_ofs, int32_t w, lv_opa_t opa, bool use_mask)
+{
+    lv_draw_sw_blend_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = &dest_buf[dest_ofs];
+    dsc.dest_w = w;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = STRIDE * 2;
+    dsc.src_buf = &src_buf[src_ofs];
+    dsc.src_stride = STRIDE * 2;
+    dsc.src_color_format = LV_COLOR_FORMAT_RGB565;
+    dsc.opa = opa;
+    dsc.mask_buf = use_mask ? &mask_buf[mask_ofs] : NULL;
+    dsc.mask_stride = STRIDE;
+
+    for(int32_t y = 0; y < BUF_H; y++) {
+        for(int32_t x = 0; x < w; x++) {
+            uint16_t * d = &ref_buf[dest_ofs + y * STRIDE + x];
+            *d = ref_mix(src_buf[src_ofs + y * STRIDE + x], *d,
+                         use_mask ? &mask_buf[mask_ofs + y * STRIDE + x] : NULL, opa);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, hook(&dsc));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(ref_buf, dest_buf, sizeof(dest_buf) / sizeof(dest_buf[0]));
+}
+
+void test_esp32s3_color_to_rgb565(void)
+{
+    for(uint32_t ofs = 0; ofs < 8; ofs++) {
+        for(int32_t w = 1; w <= BUF_W; w += 13) {
+            check_fill(lv_draw_sw_blend_esp32s3_color_to_rgb565, ofs, 0, w, LV_OPA_COVER, false);
+        }
+    }
+}
+
+void test_esp32s3_color_to_rgb565_with_opa(void)
+{
+    static const lv_opa_t opas[] = {0, 1, 3, 4, 60, 127, 128, 200, 252};
+    for(uint32_t i = 0; i < sizeof(opas); i++) {
+        for(uint32_t ofs = 0; ofs < 8; ofs += 3) {
+            check_fill(lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa, ofs, 0, BUF_W, opas[i], false);
+        }
+    }
+}
+
+void test_esp32s3_color_to_rgb565_with_mask(void)
+{
+    for(uint32_t ofs = 0; ofs < 8; ofs++) {
+        for(uint32_t mask_ofs = 0; mask_ofs < 8; mask_ofs++) {
+            /*Also rows too short to reach an aligned group of 8 pixels*/
+            for(int32_t w = 1; w <= BUF_W; w += 4) {
+                check_fill(lv_draw_sw_blend_esp32s3_color_to_rgb565_with_mask, ofs, mask_ofs, w, LV_OPA_COVER, true);
+            }
+        }
+    }
+}
+
+void test_esp32s3_color_to_rgb565_with_opa_mask(void)
+{
+    for(uint32_t ofs = 0; ofs < 8; ofs += 3) {
+        for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+            check_fill(lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa_mask, ofs, mask_ofs, BUF_W, 100, true);
+            check_fill(lv_draw_sw_blend_esp32s3_color_to_rgb565_with_opa_mask, ofs, mask_ofs, 17, 250, true);
+        }
+    }
+}
+
+void test_esp32s3_rgb565_to_rgb565(void)
+{
+    for(uint32_t ofs = 0; ofs < 8; ofs++) {
+        for(uint32_t src_ofs = 0; src_ofs < 8; src_ofs += 3) {
+            check_image(lv_draw_sw_blend_esp32s3_rgb565_to_rgb565, ofs, src_ofs, 0, BUF_W, LV_OPA_COVER, false);
+        }
+    }
+}
+
+void test_esp32s3_rgb565_to_rgb565_with_opa(void)
+{
+    static const lv_opa_t opas[] = {0, 4, 60, 128, 252};
+    for(uint32_t i = 0; i < sizeof(opas); i++) {
+        for(uint32_t ofs = 0; ofs < 8; ofs += 3) {
+            check_image(lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa, ofs, 5, 0, BUF_W, opas[i], false);
+        }
+    }
+}
+
+void test_esp32s3_rgb565_to_rgb565_with_mask(void)
+{
+    for(uint32_t ofs = 0; ofs < 8; ofs++) {
+        for(uint32_t mask_ofs = 0; mask_ofs < 8; mask_ofs++) {
+            for(int32_t w = 1; w <= BUF_W; w += 4) {
+                check_image(lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_mask, ofs, 2, mask_ofs, w, LV_OPA_COVER,
+                            true);
+            }
+        }
+    }
+}
+
+void test_esp32s3_rgb565_to_rgb565_with_opa_mask(void)
+{
+    for(uint32_t ofs = 0; ofs < 8; ofs += 3) {
+        for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+            check_image(lv_draw_sw_blend_esp32s3_rgb565_to_rgb565_with_opa_mask, ofs, 7, mask_ofs, BUF_W, 180, true);
+        }
+    }
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_esp32s3_color_to_rgb565(void)
+{
+}
+
+void test_esp32s3_color_to_rgb565_with_opa(void)
+{
+}
+
+void test_esp32s3_color_to_rgb565_with_mask(void)
+{
+}
+
+void test_esp32s3_color_to_rgb565_with_opa_mask(void)
+{
+}
+
+void test_esp32s3_rgb565_to_rgb565(void)
+{
+}
+
+void test_esp32s3_rgb565_to_rgb565_with_opa(void)
+{
+}
+
+void test_esp32s3_rgb565_to_rgb565_with_mask(void)
+{
+}
+
+void test_esp32s3_rgb565_to_rgb565_with_opa_mask(void)
+{
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_ESP32S3*/
+
+#endif
@@ -0,0 +1,422 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+
+#include "../../src/draw/sw/blend/x86/lv_draw_sw_blend_x86_to_rgb565.h"
+#include "../../src/draw/sw/blend/x86/lv_draw_sw_blend_x86_to_rgb888.h"
+
+/* Compare the x86 blend hooks with the per pixel mixing of the generic C blending.
+ * The widths and offsets are chosen to run both the vector loops and the scalar tails.*/
+
+#define BUF_W   53
+#define BUF_H   7
+#define STRIDE  (BUF_W + 11)
+#define BUF_LEN (STRIDE * BUF_H + 8)
+
+static uint32_t dest_buf[BUF_LEN];
+static uint32_t ref_buf[BUF_LEN];
+static uint32_t src_buf[BUF_LEN];
+static uint8_t mask_buf[BUF_LEN];
+
+static uint32_t rnd_state;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return rnd_state >> 8;
+}
+
+/*Many fully transparent and opaque values as they are handled separately by the C code*/
+static uint8_t rnd_opa(void)
+{
+    uint32_t r = rnd();
+    return (r & 0x300) == 0 ? 0x00 : (r & 0x300) == 0x100 ? 0xFF : (uint8_t)r;
+}
+
+void setUp(void)
+{
+    rnd_state = 1;
+    for(uint32_t i = 0; i < BUF_LEN; i++) {
+        dest_buf[i] = (rnd() << 8) ^ rnd();
+        src_buf[i] = (rnd() & 0xFFFFFF) | ((uint32_t)rnd_opa() << 24);
+        mask_buf[i] = rnd_opa();
+    }
+    lv_memcpy(ref_buf, dest_buf, sizeof(dest_buf));
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void ref_24_24_mix(const uint8_t * src, uint8_t * dest, uint8_t mix)
+{
+    if(mix == 0) return;
+
+    if(mix >= LV_OPA_MAX) {
+        lv_memcpy(dest, src, 3);
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+        for(uint32_t i = 0; i < 3; i++) dest[i] = (uint32_t)((uint32_t)src[i] * mix + dest[i] * mix_inv) >> 8;
+    }
+}
+
+/*The mix factor the C code uses for each case. `src_alpha` is NULL for formats without alpha.*/
+static lv_opa_t ref_mix(const uint8_t * src_alpha, const uint8_t * mask, lv_opa_t opa)
+{
+    if(src_alpha == NULL) {
+        if(mask && opa < LV_OPA_MAX) return LV_OPA_MIX2(*mask, opa);
+        if(mask) return *mask;
+        return opa;
+    }
+
+    if(mask && opa < LV_OPA_MAX) return LV_OPA_MIX3(*src_alpha, *mask, opa);
+    if(mask) return LV_OPA_MIX2(*src_alpha, *mask);
+    if(opa < LV_OPA_MAX) return LV_OPA_MIX2(*src_alpha, opa);
+    return *src_alpha;
+}
+
+static void check_rgb565_fill(lv_result_t (*hook)(lv_draw_sw_blend_fill_dsc_t *), uint32_t dest_ofs, uint32_t mask_ofs,
+                              int32_t w, lv_opa_t opa, bool use_mask)
+{
+    uint16_t * dest_u16 = (uint16_t *)dest_buf;
+    uint16_t * ref_u16 = (uint16_t *)ref_buf;
+
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = &dest_u16[dest_ofs];
+    dsc.dest_w = w;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = STRIDE * 2;
+    dsc.color = lv_color_hex(0x3a7fc4);
+    dsc.opa = opa;
+    dsc.mask_buf = use_mask ? &mask_buf[mask_ofs] : NULL;
+    dsc.mask_stride = STRIDE;
+
+    uint16_t color16 = lv_color_to_u16(dsc.color);
+    for(int32_t y = 0; y < BUF_H; y++) {
+        for(int32_t x = 0; x < w; x++) {
+            uint16_t * d = &ref_u16[dest_ofs + y * STRIDE + x];
+            const uint8_t * m = use_mask ? &mask_buf[mask_ofs + y * STRIDE + x] : NULL;
+            *d = lv_color_16_16_mix(color16, *d, ref_mix(NULL, m, opa));
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, hook(&dsc));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_buf, dest_buf, BUF_LEN);
+}
+
+static void check_rgb565_image(lv_result_t (*hook)(lv_draw_sw_blend_image_dsc_t *), uint32_t dest_ofs,
+                               uint32_t src_ofs, uint32_t mask_ofs, int32_t w, lv_opa_t opa, bool use_mask)
+{
+    uint16_t * dest_u16 = (uint16_t *)dest_buf;
+    uint16_t * ref_u16 = (uint16_t *)ref_buf;
+    uint16_t * src_u16 = (uint16_t *)src_buf;
+
+    lv_draw_sw_blend_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = &dest_u16[dest_ofs];
+    dsc.dest_w = w;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = STRIDE * 2;
+    dsc.src_buf = &src_u16[src_ofs];
+    dsc.src_stride = STRIDE * 2;
+    dsc.src_color_format = LV_COLOR_FORMAT_RGB565;
+    dsc.opa = opa;
+    dsc.mask_buf = use_mask ? &mask_buf[mask_ofs] : NULL;
+    dsc.mask_stride = STRIDE;
+
+    for(int32_t y = 0; y < BUF_H; y++) {
+        for(int32_t x = 0; x < w; x++) {
+            uint16_t * d = &ref_u16[dest_ofs + y * STRIDE + x];
+            const uint8_t * m = use_mask ? &mask_buf[mask_ofs + y * STRIDE + x] : NULL;
+            *d = lv_color_16_16_mix(src_u16[src_ofs + y * STRIDE + x], *d, ref_mix(NULL, m, opa));
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, hook(&dsc));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_buf, dest_buf, BUF_LEN);
+}
+
+static void check_xrgb8888_fill(lv_result_t (*hook)(lv_draw_sw_blend_fill_dsc_t *, uint32_t), uint32_t px_size,
+                                uint32_t mask_ofs, int32_t w, lv_opa_t opa, bool use_mask)
+{
+    uint8_t * ref_u8 = (uint8_t *)ref_buf;
+
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = dest_buf;
+    dsc.dest_w = w;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = STRIDE * px_size;
+    dsc.color = lv_color_hex(0x3a7fc4);
+    dsc.opa = opa;
+    dsc.mask_buf = use_mask ? &mask_buf[mask_ofs] : NULL;
+    dsc.mask_stride = STRIDE;
+
+    uint32_t color32 = lv_color_to_u32(dsc.color);
+    for(int32_t y = 0; y < BUF_H; y++) {
+        for(int32_t x = 0; x < w; x++) {
+            uint8_t * d = &ref_u8[(y * STRIDE + x) * px_size];
+            const uint8_t * m = use_mask ? &mask_buf[mask_ofs + y * STRIDE + x] : NULL;
+            if(!use_mask && opa >= LV_OPA_MAX && px_size == 4) lv_memcpy(d, &color32, 4);
+            else ref_24_24_mix((const uint8_t *)&color32, d, ref_mix(NULL, m, opa));
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, hook(&dsc, px_size));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_buf, dest_buf, BUF_LEN);
+}
+
+static void check_xrgb8888_image(lv_result_t (*hook)(lv_draw_sw_blend_image_dsc_t *, uint32_t),
+                                 lv_color_format_t src_cf, uint32_t px_size, uint32_t src_ofs, uint32_t mask_ofs,
+                                 int32_t w, lv_opa_t opa, bool use_mask)
+{
+    uint8_t * ref_u8 = (uint8_t *)ref_buf;
+    uint8_t * src_u8 = (uint8_t *)src_buf;
+
+    lv_draw_sw_blend_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = dest_buf;
+    dsc.dest_w = w;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = STRIDE * px_size;
+    dsc.src_buf = &src_u8[src_ofs * px_size];
+    dsc.src_stride = STRIDE * px_size;
+    dsc.src_color_format = src_cf;
+    dsc.opa = opa;
+    dsc.mask_buf = use_mask ? &mask_buf[mask_ofs] : NULL;
+    dsc.mask_stride = STRIDE;
+
+    for(int32_t y = 0; y < BUF_H; y++) {
+        for(int32_t x = 0; x < w; x++) {
+            uint8_t * d = &ref_u8[(y * STRIDE + x) * px_size];
+            const uint8_t * s = &src_u8[(src_ofs + y * STRIDE + x) * px_size];
+            const uint8_t * m = use_mask ? &mask_buf[mask_ofs + y * STRIDE + x] : NULL;
+            const uint8_t * src_alpha = src_cf == LV_COLOR_FORMAT_ARGB8888 ? &s[3] : NULL;
+            ref_24_24_mix(s, d, ref_mix(src_alpha, m, opa));
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, hook(&dsc, px_size));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_buf, dest_buf, BUF_LEN);
+}
+
+static lv_result_t rgb888_to_rgb888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size)
+{
+    return lv_draw_sw_blend_x86_rgb888_to_rgb888_with_opa(dsc, px_size, px_size);
+}
+
+static lv_result_t rgb888_to_rgb888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size)
+{
+    return lv_draw_sw_blend_x86_rgb888_to_rgb888_with_mask(dsc, px_size, px_size);
+}
+
+static lv_result_t rgb888_to_rgb888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size)
+{
+    return lv_draw_sw_blend_x86_rgb888_to_rgb888_with_opa_mask(dsc, px_size, px_size);
+}
+
+void test_x86_color_to_rgb565(void)
+{
+    for(uint32_t ofs = 0; ofs < 8; ofs++) {
+        for(int32_t w = 1; w <= BUF_W; w += 13) {
+            check_rgb565_fill(lv_draw_sw_blend_x86_color_to_rgb565, ofs, 0, w, LV_OPA_COVER, false);
+        }
+    }
+}
+
+void test_x86_color_to_rgb565_with_opa(void)
+{
+    static const lv_opa_t opas[] = {0, 1, 3, 4, 60, 127, 128, 200, 252};
+    for(uint32_t i = 0; i < sizeof(opas); i++) {
+        check_rgb565_fill(lv_draw_sw_blend_x86_color_to_rgb565_with_opa, 3, 0, BUF_W, opas[i], false);
+    }
+}
+
+void test_x86_color_to_rgb565_with_mask(void)
+{
+    for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+        check_rgb565_fill(lv_draw_sw_blend_x86_color_to_rgb565_with_mask, 1, mask_ofs, BUF_W, LV_OPA_COVER, true);
+    }
+}
+
+void test_x86_color_to_rgb565_with_opa_mask(void)
+{
+    for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+        check_rgb565_fill(lv_draw_sw_blend_x86_color_to_rgb565_with_opa_mask, 0, mask_ofs, BUF_W, 100, true);
+        check_rgb565_fill(lv_draw_sw_blend_x86_color_to_rgb565_with_opa_mask, 5, mask_ofs, 17, 250, true);
+    }
+}
+
+void test_x86_rgb565_to_rgb565(void)
+{
+    for(int32_t w = 1; w <= BUF_W; w += 13) {
+        check_rgb565_image(lv_draw_sw_blend_x86_rgb565_to_rgb565, 2, 3, 0, w, LV_OPA_COVER, false);
+    }
+}
+
+void test_x86_rgb565_to_rgb565_with_opa(void)
+{
+    static const lv_opa_t opas[] = {0, 4, 60, 128, 252};
+    for(uint32_t i = 0; i < sizeof(opas); i++) {
+        check_rgb565_image(lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa, 3, 5, 0, BUF_W, opas[i], false);
+    }
+}
+
+void test_x86_rgb565_to_rgb565_with_mask(void)
+{
+    for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+        check_rgb565_image(lv_draw_sw_blend_x86_rgb565_to_rgb565_with_mask, 0, 2, mask_ofs, BUF_W, LV_OPA_COVER, true);
+    }
+}
+
+void test_x86_rgb565_to_rgb565_with_opa_mask(void)
+{
+    for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+        check_rgb565_image(lv_draw_sw_blend_x86_rgb565_to_rgb565_with_opa_mask, 1, 7, mask_ofs, BUF_W, 180, true);
+    }
+}
+
+void test_x86_color_to_xrgb8888(void)
+{
+    for(int32_t w = 1; w <= BUF_W; w += 13) {
+        check_xrgb8888_fill(lv_draw_sw_blend_x86_color_to_rgb888, 4, 0, w, LV_OPA_COVER, false);
+    }
+}
+
+void test_x86_color_to_rgb888_with_opa(void)
+{
+    static const lv_opa_t opas[] = {0, 1, 60, 128, 252};
+    for(uint32_t i = 0; i < sizeof(opas); i++) {
+        check_xrgb8888_fill(lv_draw_sw_blend_x86_color_to_rgb888_with_opa, 3, 0, BUF_W, opas[i], false);
+        check_xrgb8888_fill(lv_draw_sw_blend_x86_color_to_rgb888_with_opa, 4, 0, BUF_W, opas[i], false);
+    }
+}
+
+void test_x86_color_to_xrgb8888_with_mask(void)
+{
+    for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+        check_xrgb8888_fill(lv_draw_sw_blend_x86_color_to_rgb888_with_mask, 4, mask_ofs, BUF_W, LV_OPA_COVER, true);
+        check_xrgb8888_fill(lv_draw_sw_blend_x86_color_to_rgb888_with_opa_mask, 4, mask_ofs, BUF_W, 90, true);
+    }
+}
+
+void test_x86_rgb888_to_rgb888(void)
+{
+    static const lv_opa_t opas[] = {0, 1, 60, 128, 252};
+    for(uint32_t i = 0; i < sizeof(opas); i++) {
+        check_xrgb8888_image(rgb888_to_rgb888_with_opa, LV_COLOR_FORMAT_RGB888, 3, 5, 0, BUF_W, opas[i], false);
+        check_xrgb8888_image(rgb888_to_rgb888_with_opa, LV_COLOR_FORMAT_XRGB8888, 4, 5, 0, BUF_W, opas[i], false);
+    }
+    for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+        check_xrgb8888_image(rgb888_to_rgb888_with_mask, LV_COLOR_FORMAT_XRGB8888, 4, 1, mask_ofs, BUF_W, LV_OPA_COVER,
+                             true);
+        check_xrgb8888_image(rgb888_to_rgb888_with_opa_mask, LV_COLOR_FORMAT_XRGB8888, 4, 1, mask_ofs, BUF_W, 140, true);
+    }
+}
+
+void test_x86_argb8888_to_xrgb8888(void)
+{
+    for(int32_t w = 1; w <= BUF_W; w += 13) {
+        check_xrgb8888_image(lv_draw_sw_blend_x86_argb8888_to_rgb888, LV_COLOR_FORMAT_ARGB8888, 4, 3, 0, w,
+                             LV_OPA_COVER, false);
+        check_xrgb8888_image(lv_draw_sw_blend_x86_argb8888_to_rgb888_with_opa, LV_COLOR_FORMAT_ARGB8888, 4, 3, 0, w,
+                             77, false);
+    }
+    for(uint32_t mask_ofs = 0; mask_ofs < 9; mask_ofs += 4) {
+        check_xrgb8888_image(lv_draw_sw_blend_x86_argb8888_to_rgb888_with_mask, LV_COLOR_FORMAT_ARGB8888, 4, 2, mask_ofs,
+                             BUF_W, LV_OPA_COVER, true);
+        check_xrgb8888_image(lv_draw_sw_blend_x86_argb8888_to_rgb888_with_opa_mask, LV_COLOR_FORMAT_ARGB8888, 4, 2,
+                             mask_ofs, BUF_W, 201, true);
+    }
+}
+
+void test_x86_unsupported_px_sizes(void)
+{
+    lv_draw_sw_blend_fill_dsc_t fill_dsc;
+    lv_memzero(&fill_dsc, sizeof(fill_dsc));
+    fill_dsc.opa = LV_OPA_COVER;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_blend_x86_color_to_rgb888(&fill_dsc, 3));
+
+    lv_draw_sw_blend_image_dsc_t image_dsc;
+    lv_memzero(&image_dsc, sizeof(image_dsc));
+    image_dsc.opa = LV_OPA_50;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_blend_x86_rgb888_to_rgb888_with_opa(&image_dsc, 4, 3));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_blend_x86_argb8888_to_rgb888_with_opa(&image_dsc, 3));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_x86_color_to_rgb565(void)
+{
+}
+
+void test_x86_color_to_rgb565_with_opa(void)
+{
+}
+
+void test_x86_color_to_rgb565_with_mask(void)
+{
+}
+
+void test_x86_color_to_rgb565_with_opa_mask(void)
+{
+}
+
+void test_x86_rgb565_to_rgb565(void)
+{
+}
+
+void test_x86_rgb565_to_rgb565_with_opa(void)
+{
+}
+
+void test_x86_rgb565_to_rgb565_with_mask(void)
+{
+}
+
+void test_x86_rgb565_to_rgb565_with_opa_mask(void)
+{
+}
+
+void test_x86_color_to_xrgb8888(void)
+{
+}
+
+void test_x86_color_to_rgb888_with_opa(void)
+{
+}
+
+void test_x86_color_to_xrgb8888_with_mask(void)
+{
+}
+
+void test_x86_rgb888_to_rgb888(void)
+{
+}
+
+void test_x86_argb8888_to_xrgb8888(void)
+{
+}
+
+void test_x86_unsupported_px_sizes(void)
+{
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86*/
+
+#endif
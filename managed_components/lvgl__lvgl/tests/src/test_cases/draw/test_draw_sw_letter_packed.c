@@ -0,0 +1,227 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+LV_FONT_DECLARE(test_font_montserrat_ascii_1bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_2bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp)
+
+#define NOISE_W     77
+#define NOISE_H     13
+
+/*A font with a single glyph ('A') of random pixels, so the rows have many spans
+ *and the rows don't start on byte boundaries*/
+static uint8_t noise_bitmap[2048];
+
+static lv_font_fmt_txt_glyph_dsc_t noise_glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = (NOISE_W + 3) * 16, .box_w = NOISE_W, .box_h = NOISE_H, .ofs_x = 0, .ofs_y = 0},
+};
+
+static const lv_font_fmt_txt_cmap_t noise_cmaps[] = {
+    {
+        .range_start = 'A', .range_length = 1, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+static lv_font_fmt_txt_dsc_t noise_font_dsc = {
+    .glyph_bitmap = noise_bitmap,
+    .glyph_dsc = noise_glyph_dsc,
+    .cmaps = noise_cmaps,
+    .cmap_num = 1,
+    .bpp = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_PLAIN,
+};
+
+static lv_font_t noise_font = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = NOISE_H,
+    .base_line = 0,
+    .dsc = &noise_font_dsc,
+};
+
+static lv_obj_t * label;
+
+/*Not `lv_font_get_bitmap_fmt_txt`, so the software renderer converts the glyphs to A8 before drawing*/
+static const void * get_bitmap_as_a8(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
+{
+    return lv_font_get_bitmap_fmt_txt(g_dsc, draw_buf);
+}
+
+static lv_draw_buf_t * render(const lv_font_t * font)
+{
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_draw_buf_t * draw_buf = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    return draw_buf;
+}
+
+/*Render the label with the packed bitmaps and converted to A8 and compare them*/
+static void assert_same_as_a8(const lv_font_t * font)
+{
+    lv_font_t a8_font = *font;
+    a8_font.get_glyph_bitmap = get_bitmap_as_a8;
+
+    lv_draw_buf_t * ref_buf = render(&a8_font);
+    lv_draw_buf_t * buf = render(font);
+
+    uint32_t size = ref_buf->header.stride * ref_buf->header.h;
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf->data, buf->data, size);
+
+    lv_draw_buf_destroy(ref_buf);
+    lv_draw_buf_destroy(buf);
+}
+
+void setUp(void)
+{
+    /*The cached glyphs wouldn't be released with `get_bitmap_as_a8`*/
+    lv_font_fmt_txt_glyph_cache_resize(0);
+
+    uint32_t seed = 12345;
+    uint32_t i;
+    for(i = 0; i < sizeof(noise_bitmap); i++) {
+        seed = seed * 1103515245 + 12345;
+        noise_bitmap[i] = (uint8_t)(seed >> 16);
+        /*Add some longer runs too*/
+        if(i % 7 == 0) noise_bitmap[i] = 0xff;
+        if(i % 11 == 0) noise_bitmap[i] = 0x00;
+    }
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x204080), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    label = lv_label_create(scr);
+    lv_obj_set_width(label, 500);
+    lv_label_set_text(label, "Packed 0123456789\nAAAAAA The quick brown fox jumps over the lazy dog.");
+    lv_obj_set_style_text_color(label, lv_color_hex(0xffe080), 0);
+    lv_obj_set_pos(label, 20, 20);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    noise_glyph_dsc[1].box_w = NOISE_W;
+    noise_glyph_dsc[1].box_h = NOISE_H;
+    noise_glyph_dsc[1].adv_w = (NOISE_W + 3) * 16;
+    noise_font.line_height = NOISE_H;
+    noise_font_dsc.bpp = 1;
+    noise_font_dsc.stride = 0;
+    lv_font_fmt_txt_glyph_cache_resize(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+}
+
+void test_draw_sw_letter_packed_fonts(void)
+{
+    assert_same_as_a8(&test_font_montserrat_ascii_1bpp);
+    assert_same_as_a8(&test_font_montserrat_ascii_2bpp);
+    assert_same_as_a8(&test_font_montserrat_ascii_4bpp);
+    assert_same_as_a8(&lv_font_montserrat_48);
+}
+
+void test_draw_sw_letter_packed_opa_and_clip(void)
+{
+    lv_obj_set_style_text_opa(label, LV_OPA_60, 0);
+    assert_same_as_a8(&test_font_montserrat_ascii_1bpp);
+    assert_same_as_a8(&test_font_montserrat_ascii_4bpp);
+
+    /*Clipped by the screen and the parent*/
+    lv_obj_set_style_text_opa(label, LV_OPA_COVER, 0);
+    lv_obj_set_pos(label, -13, -7);
+    assert_same_as_a8(&lv_font_montserrat_48);
+
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_size(cont, 217, 61);
+    lv_obj_set_pos(cont, 101, 33);
+    lv_obj_set_parent(label, cont);
+    lv_obj_set_pos(label, -29, -5);
+    assert_same_as_a8(&test_font_montserrat_ascii_1bpp);
+    assert_same_as_a8(&test_font_montserrat_ascii_2bpp);
+    assert_same_as_a8(&lv_font_montserrat_48);
+}
+
+void test_draw_sw_letter_packed_noise(void)
+{
+    lv_label_set_text(label, "AAAAAAAAA\nAAAAA");
+
+    uint32_t bpp;
+    for(bpp = 1; bpp <= 4; bpp *= 2) {
+        noise_font_dsc.bpp = bpp;
+        noise_font_dsc.stride = 0;
+        assert_same_as_a8(&noise_font);
+
+        /*Rows padded to 4 bytes*/
+        noise_font_dsc.stride = 4;
+        assert_same_as_a8(&noise_font);
+
+        lv_obj_set_style_text_opa(label, LV_OPA_70, 0);
+        assert_same_as_a8(&noise_font);
+        lv_obj_set_style_text_opa(label, LV_OPA_COVER, 0);
+    }
+}
+
+void test_draw_sw_letter_packed_benchmark(void)
+{
+    /*Turn the noise glyph into a large 1 bpp '0' like on a measurement display*/
+    int32_t w = 100;
+    int32_t h = 150;
+    noise_glyph_dsc[1].box_w = w;
+    noise_glyph_dsc[1].box_h = h;
+    noise_glyph_dsc[1].adv_w = (w + 10) * 16;
+    noise_font.line_height = h;
+    noise_font_dsc.bpp = 1;
+    lv_memzero(noise_bitmap, sizeof(noise_bitmap));
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            /*An elliptic ring with 20 px thick strokes*/
+            int32_t dx = (x - w / 2) * 1000 / (w / 2);
+            int32_t dy = (y - h / 2) * 1000 / (h / 2);
+            int32_t r = lv_sqrt32(dx * dx + dy * dy);
+            if(r >= 600 && r <= 1000) {
+                uint32_t bit = y * w + x;
+                noise_bitmap[bit >> 3] |= 0x80 >> (bit & 0x7);
+            }
+        }
+    }
+
+    const lv_font_t * fonts[] = {&noise_font, &test_font_montserrat_ascii_1bpp, &lv_font_montserrat_48};
+    const char * texts[] = {"AAAAAA", "1234 ppm 5678 ppm 9012 ppm\n3456 ppm 7890 ppm 1234 ppm", "1234 ppm\n5678 ppm"};
+
+    uint32_t f;
+    for(f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        lv_font_t a8_font = *fonts[f];
+        a8_font.get_glyph_bitmap = get_bitmap_as_a8;
+        const lv_font_t * variants[2] = {&a8_font, fonts[f]};
+        lv_label_set_text(label, texts[f]);
+        uint32_t time_us[2];
+
+        uint32_t v;
+        for(v = 0; v < 2; v++) {
+            lv_obj_set_style_text_font(label, variants[v], 0);
+
+            struct timespec start;
+            struct timespec end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            uint32_t i;
+            for(i = 0; i < 50; i++) {
+                lv_obj_invalidate(label);
+                lv_refr_now(NULL);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            time_us[v] = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+        }
+
+        TEST_PRINTF("font %d: %d us converted to A8, %d us from packed bitmap",
+                    (int)f, (int)time_us[0], (int)time_us[1]);
+    }
+}
+
+#endif
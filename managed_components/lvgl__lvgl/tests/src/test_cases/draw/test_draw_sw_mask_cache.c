@@ -0,0 +1,95 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * create_card(lv_obj_t * parent, int32_t x)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_set_pos(obj, x, 40);
+    lv_obj_set_size(obj, 120, 160);
+    lv_obj_set_style_radius(obj, 24, 0);
+    lv_obj_set_style_shadow_width(obj, 30, 0);
+    lv_obj_set_style_shadow_spread(obj, 4, 0);
+    lv_obj_set_style_shadow_offset_y(obj, 6, 0);
+    return obj;
+}
+
+static void mask_cache_drop_all(void)
+{
+    lv_cache_drop_all(LV_GLOBAL_DEFAULT()->sw_mask_cache, NULL);
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    mask_cache_drop_all();
+}
+
+void test_draw_sw_mask_cache_hits_on_redraw(void)
+{
+    create_card(lv_screen_active(), 20);
+    create_card(lv_screen_active(), 200);
+    mask_cache_drop_all();
+    lv_refr_now(NULL);
+
+    uint32_t hit_cnt_1;
+    uint32_t miss_cnt_1;
+    lv_draw_sw_mask_cache_get_hit_stats(&hit_cnt_1, &miss_cnt_1);
+
+    /*Nothing new has to be calculated when the same cards are drawn again*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    uint32_t hit_cnt_2;
+    uint32_t miss_cnt_2;
+    lv_draw_sw_mask_cache_get_hit_stats(&hit_cnt_2, &miss_cnt_2);
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt_1, miss_cnt_2);
+    TEST_ASSERT_GREATER_THAN_UINT32(hit_cnt_1, hit_cnt_2);
+}
+
+void test_draw_sw_mask_cache_same_result(void)
+{
+    create_card(lv_screen_active(), 20);
+    lv_obj_t * wide = create_card(lv_screen_active(), 200);
+    lv_obj_set_width(wide, 400);
+
+    /*With a zero sized cache nothing fits in it, so every mask is calculated into a temporary buffer*/
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_mask_cache;
+    size_t max_size = lv_cache_get_max_size(cache, NULL);
+    mask_cache_drop_all();
+    lv_cache_set_max_size(cache, 0, NULL);
+    lv_draw_buf_t * uncached = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(uncached);
+    lv_cache_set_max_size(cache, max_size, NULL);
+
+    /*Fill the cache, then draw again only from the cached masks*/
+    lv_draw_buf_t * warm_up = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(warm_up);
+    uint32_t hit_cnt_1;
+    uint32_t miss_cnt_1;
+    lv_draw_sw_mask_cache_get_hit_stats(&hit_cnt_1, &miss_cnt_1);
+    lv_draw_buf_t * cached = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(cached);
+    uint32_t hit_cnt_2;
+    uint32_t miss_cnt_2;
+    lv_draw_sw_mask_cache_get_hit_stats(&hit_cnt_2, &miss_cnt_2);
+    TEST_ASSERT_EQUAL_UINT32(miss_cnt_1, miss_cnt_2);
+    TEST_ASSERT_GREATER_THAN_UINT32(hit_cnt_1, hit_cnt_2);
+
+    TEST_ASSERT_EQUAL_UINT32(uncached->data_size, cached->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(uncached->data, cached->data, uncached->data_size);
+
+    lv_draw_buf_destroy(uncached);
+    lv_draw_buf_destroy(warm_up);
+    lv_draw_buf_destroy(cached);
+}
+
+#endif
@@ -3,6 +3,8 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include <stdlib.h>
+#include <time.h>
 
 void setUp(void)
 {
@@ -295,6 +297,103 @@ void test_rotate270_L8(void)
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
 }
 
+/*Column-wise rotation used before the tiled kernels. Reference for correctness and speed.*/
+static void rotate_reference(const uint8_t * src, uint8_t * dst, int32_t src_w, int32_t src_h,
+                             int32_t src_stride, int32_t dst_stride, lv_display_rotation_t rotation, uint32_t px_size)
+{
+    for(int32_t x = 0; x < src_w; x++) {
+        for(int32_t y = 0; y < src_h; y++) {
+            const uint8_t * s = src + y * src_stride + x * px_size;
+            uint8_t * d;
+            if(rotation == LV_DISPLAY_ROTATION_90) d = dst + (src_w - x - 1) * dst_stride + y * px_size;
+            else d = dst + x * dst_stride + (src_h - y - 1) * px_size;
+            lv_memcpy(d, s, px_size);
+        }
+    }
+}
+
+static void rotate_compare(lv_color_format_t cf, lv_display_rotation_t rotation)
+{
+    /*Not a multiple of the tile size and padded strides to hit the edge tiles*/
+    const int32_t w = 45;
+    const int32_t h = 37;
+    uint32_t px_size = lv_color_format_get_size(cf);
+    int32_t src_stride = (w + 3) * px_size;
+    int32_t dst_stride = (h + 5) * px_size;
+    uint8_t * src = lv_malloc(src_stride * h);
+    uint8_t * dst = lv_malloc(dst_stride * w);
+    uint8_t * ref = lv_malloc(dst_stride * w);
+
+    for(int32_t i = 0; i < src_stride * h; i++) src[i] = (uint8_t)(i * 7 + (i >> 8));
+    lv_memset(dst, 0xAA, dst_stride * w);
+    lv_memset(ref, 0xAA, dst_stride * w);
+
+    lv_draw_sw_rotate(src, dst, w, h, src_stride, dst_stride, rotation, cf);
+    rotate_reference(src, ref, w, h, src_stride, dst_stride, rotation, px_size);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, dst, dst_stride * w);
+
+    lv_free(src);
+    lv_free(dst);
+    lv_free(ref);
+}
+
+void test_rotate_tiled_matches_reference(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_L8, LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_ARGB8888
+    };
+
+    for(uint32_t i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        rotate_compare(cfs[i], LV_DISPLAY_ROTATION_90);
+        rotate_compare(cfs[i], LV_DISPLAY_ROTATION_270);
+    }
+}
+
+static uint32_t mpix_per_sec(uint32_t px_cnt, uint32_t iter, clock_t t)
+{
+    if(t == 0) t = 1;
+    return (uint32_t)(((uint64_t)px_cnt * iter * CLOCKS_PER_SEC) / ((uint64_t)t * 1000000));
+}
+
+void test_rotate_benchmark(void)
+{
+    /*The size of a full portrait 320x820 panel*/
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_L8, LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_ARGB8888
+    };
+    const int32_t w = 820;
+    const int32_t h = 320;
+    const uint32_t iter = 10;
+
+    for(uint32_t i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        uint32_t px_size = lv_color_format_get_size(cfs[i]);
+        /*Full frames don't fit into the built-in LVGL heap of the test configs*/
+        uint8_t * src = calloc(1, w * h * px_size);
+        uint8_t * dst = malloc(w * h * px_size);
+        TEST_ASSERT_NOT_NULL(src);
+        TEST_ASSERT_NOT_NULL(dst);
+
+        clock_t t = clock();
+        for(uint32_t j = 0; j < iter; j++) {
+            rotate_reference(src, dst, w, h, w * px_size, h * px_size, LV_DISPLAY_ROTATION_270, px_size);
+        }
+        uint32_t ref_mpix = mpix_per_sec(w * h, iter, clock() - t);
+
+        t = clock();
+        for(uint32_t j = 0; j < iter; j++) {
+            lv_draw_sw_rotate(src, dst, w, h, w * px_size, h * px_size, LV_DISPLAY_ROTATION_270, cfs[i]);
+        }
+        uint32_t tiled_mpix = mpix_per_sec(w * h, iter, clock() - t);
+
+        TEST_PRINTF("rotate270 %dx%d, %d bytes/px: column-wise %d MPix/s, tiled %d MPix/s",
+                    (int)w, (int)h, (int)px_size, (int)ref_mpix, (int)tiled_mpix);
+
+        free(src);
+        free(dst);
+    }
+}
+
 void test_invert(void)
 {
     uint8_t expected_buf[10] = {0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8, 0xf7, 0xf6};
@@ -0,0 +1,161 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_DRAW_SW_USE_TILE_SPLIT
+
+#include <time.h>
+
+static lv_draw_sw_unit_t * get_sw_unit(void)
+{
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u) {
+        if(u->name && lv_streq(u->name, "SW")) return (lv_draw_sw_unit_t *)u;
+        u = u->next;
+    }
+
+    TEST_FAIL_MESSAGE("The SW draw unit is not found");
+    return NULL;
+}
+
+/*A full screen gradient, a long label and a semi transparent widget rendered as a layer*/
+static void create_scene(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    lv_obj_t * label = lv_label_create(scr);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_label_set_text(label,
+                      "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore "
+                      "et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut "
+                      "aliquip ex ea commodo consequat. Duis aute irure dolor in reprehenderit in voluptate velit esse "
+                      "cillum dolore eu fugiat nulla pariatur. Excepteur sint occaecat cupidatat non proident, sunt in "
+                      "culpa qui officia deserunt mollit anim id est laborum.");
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_24, 0);
+
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 600, 260);
+    lv_obj_align(obj, LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_obj_set_style_radius(obj, 30, 0);
+    lv_obj_set_style_border_width(obj, 12, 0);
+    lv_obj_set_style_opa(obj, LV_OPA_70, 0);
+}
+
+static lv_draw_buf_t * render(uint32_t thread_cnt)
+{
+    get_sw_unit()->thread_cnt = thread_cnt;
+    lv_draw_buf_t * draw_buf = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    return draw_buf;
+}
+
+void setUp(void)
+{
+    create_scene();
+}
+
+void tearDown(void)
+{
+    get_sw_unit()->thread_cnt = LV_DRAW_SW_DRAW_UNIT_CNT;
+    lv_display_set_tile_cnt(lv_display_get_default(), LV_DRAW_SW_DRAW_UNIT_CNT);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_split_rendering_matches_single_thread(void)
+{
+    lv_draw_buf_t * ref_buf = render(1);
+    lv_draw_buf_t * buf = render(LV_DRAW_SW_DRAW_UNIT_CNT);
+
+    uint32_t size = ref_buf->header.stride * ref_buf->header.h;
+    TEST_ASSERT_EQUAL_UINT32(size, buf->header.stride * buf->header.h);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf->data, buf->data, size);
+
+    lv_draw_buf_destroy(ref_buf);
+    lv_draw_buf_destroy(buf);
+}
+
+void test_tiled_rendering_matches_single_tile(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+
+    /*Render the screen in one piece with one thread*/
+    get_sw_unit()->thread_cnt = 1;
+    lv_display_set_tile_cnt(disp, 1);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+
+    lv_draw_buf_t * disp_buf = lv_display_get_buf_active(disp);
+    uint32_t size = disp_buf->header.stride * disp_buf->header.h;
+    uint8_t * ref_data = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(ref_data);
+    lv_memcpy(ref_data, disp_buf->data, size);
+
+    /*Render the screen in tiles with several threads*/
+    get_sw_unit()->thread_cnt = LV_DRAW_SW_DRAW_UNIT_CNT;
+    lv_display_set_tile_cnt(disp, LV_DRAW_SW_DRAW_UNIT_CNT);
+    lv_memzero(disp_buf->data, size);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_data, lv_display_get_buf_active(disp)->data, size);
+
+    lv_free(ref_data);
+}
+
+void test_split_rendering_benchmark(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t time_1_thread = 0;
+
+    uint32_t thread_cnt;
+    for(thread_cnt = 1; thread_cnt <= LV_DRAW_SW_DRAW_UNIT_CNT; thread_cnt++) {
+        get_sw_unit()->thread_cnt = thread_cnt;
+
+        struct timespec start;
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        uint32_t i;
+        for(i = 0; i < 20; i++) {
+            lv_obj_invalidate(lv_screen_active());
+            lv_refr_now(disp);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        uint32_t time_us = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+        if(thread_cnt == 1) time_1_thread = time_us;
+        TEST_PRINTF("%d render threads: %d us per full refresh, %d%% speed",
+                    (int)thread_cnt, (int)(time_us / 20), (int)(time_1_thread * 100 / LV_MAX(time_us, 1)));
+    }
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_split_rendering_matches_single_thread(void)
+{
+}
+
+void test_tiled_rendering_matches_single_tile(void)
+{
+}
+
+void test_split_rendering_benchmark(void)
+{
+}
+
+#endif /*LV_DRAW_SW_USE_TILE_SPLIT*/
+
+#endif
@@ -0,0 +1,224 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+/*Not used by any real draw units so the software renderer won't take these draw tasks*/
+#define UNIT_A  10
+#define UNIT_B  11
+
+static lv_layer_t layer;
+static uint32_t rnd_state;
+
+static uint32_t rnd(uint32_t max)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 8) % max;
+}
+
+static lv_draw_task_t * add_task(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t unit, int state)
+{
+    lv_area_t a = {x, y, x + w - 1, y + h - 1};
+    lv_draw_task_t * t = lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+    lv_draw_finalize_task_creation(&layer, t);
+    t->preferred_draw_unit_id = unit;
+    t->state = state;
+    return t;
+}
+
+static void remove_finished_tasks(void)
+{
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+static void finish_all_tasks(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    remove_finished_tasks();
+}
+
+void setUp(void)
+{
+    rnd_state = 1;
+    lv_area_t a = {0, 0, 799, 479};
+    lv_layer_init(&layer);
+    layer.buf_area = a;
+    layer._clip_area = a;
+    layer.phy_clip_area = a;
+
+    /*Keep a not waiting draw task at the head so that the dispatcher never starts rendering anything*/
+    add_task(-100, -100, 10, 10, UNIT_A, LV_DRAW_TASK_STATE_QUEUED);
+}
+
+void tearDown(void)
+{
+    finish_all_tasks();
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer.task_index);
+}
+
+/*The original search, walking all the older draw tasks*/
+static bool ref_is_independent(lv_draw_task_t * t_check, uint8_t unit)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t && t != t_check) {
+        if(t->state != LV_DRAW_TASK_STATE_FINISHED &&
+           !(t->state == LV_DRAW_TASK_STATE_QUEUED && t->preferred_draw_unit_id == unit)) {
+            lv_area_t a;
+            if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) return false;
+        }
+        t = t->next;
+    }
+    return true;
+}
+
+static lv_draw_task_t * ref_get_next_available_task(lv_draw_task_t * t_prev, uint8_t unit)
+{
+    lv_draw_task_t * t = t_prev ? t_prev->next : layer.draw_task_head;
+    while(t) {
+        if(t->preferred_draw_unit_id == unit && t->state == LV_DRAW_TASK_STATE_WAITING && ref_is_independent(t, unit)) {
+            return t;
+        }
+        t = t->next;
+    }
+    return NULL;
+}
+
+static void add_random_tasks(uint32_t cnt, bool change_area)
+{
+    static const int states[] = {
+        LV_DRAW_TASK_STATE_WAITING, LV_DRAW_TASK_STATE_WAITING, LV_DRAW_TASK_STATE_WAITING,
+        LV_DRAW_TASK_STATE_QUEUED, LV_DRAW_TASK_STATE_IN_PROGRESS, LV_DRAW_TASK_STATE_FINISHED
+    };
+
+    for(uint32_t i = 0; i < cnt; i++) {
+        /*Mostly letters and some larger, partially out of the layer areas*/
+        int32_t w = rnd(10) == 0 ? (int32_t)rnd(400) + 1 : (int32_t)rnd(10) + 5;
+        int32_t h = rnd(10) == 0 ? (int32_t)rnd(300) + 1 : (int32_t)rnd(8) + 12;
+        int32_t x = (int32_t)rnd(900) - 50;
+        int32_t y = (int32_t)rnd(580) - 50;
+        uint8_t unit = rnd(2) ? UNIT_A : UNIT_B;
+        int state = states[rnd(sizeof(states) / sizeof(states[0]))];
+
+        if(change_area) {
+            /*Change the real area between adding and finalizing the draw task as e.g. images do*/
+            lv_area_t a = {x, y, x + w - 1, y + h - 1};
+            lv_draw_task_t * t = lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+            lv_area_increase(&t->_real_area, (int32_t)rnd(100), (int32_t)rnd(100));
+            lv_draw_finalize_task_creation(&layer, t);
+            t->preferred_draw_unit_id = unit;
+            t->state = state;
+        }
+        else {
+            add_task(x, y, w, h, unit, state);
+        }
+    }
+}
+
+static void check_available_tasks(void)
+{
+    static const uint8_t units[] = {UNIT_A, UNIT_B};
+    for(uint32_t i = 0; i < sizeof(units); i++) {
+        lv_draw_task_t * t_ref = NULL;
+        lv_draw_task_t * t = NULL;
+        do {
+            t_ref = ref_get_next_available_task(t_ref, units[i]);
+            t = lv_draw_get_next_available_task(&layer, t, units[i]);
+            TEST_ASSERT_EQUAL_PTR(t_ref, t);
+        } while(t);
+    }
+}
+
+static void change_random_states(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head->next;
+    while(t) {
+        uint32_t r = rnd(8);
+        if(r == 0) t->state = LV_DRAW_TASK_STATE_FINISHED;
+        else if(r == 1) t->state = LV_DRAW_TASK_STATE_QUEUED;
+        else if(r == 2) t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        t = t->next;
+    }
+}
+
+void test_available_tasks_match_linear_search(void)
+{
+    add_random_tasks(1000, false);
+    check_available_tasks();
+    TEST_ASSERT_NOT_NULL(layer.task_index);
+
+    /*Added to the existing index*/
+    add_random_tasks(500, true);
+    check_available_tasks();
+
+    /*Removed from the index*/
+    for(uint32_t i = 0; i < 5; i++) {
+        change_random_states();
+        remove_finished_tasks();
+        check_available_tasks();
+    }
+}
+
+void test_few_tasks_are_not_indexed(void)
+{
+    add_random_tasks(20, false);
+    check_available_tasks();
+    TEST_ASSERT_NULL(layer.task_index);
+}
+
+void test_index_is_freed_with_the_tasks(void)
+{
+    add_random_tasks(200, false);
+    check_available_tasks();
+    TEST_ASSERT_NOT_NULL(layer.task_index);
+
+    finish_all_tasks();
+    TEST_ASSERT_NULL(layer.task_index);
+
+    /*Can be indexed again*/
+    add_task(-100, -100, 10, 10, UNIT_A, LV_DRAW_TASK_STATE_QUEUED);
+    add_random_tasks(200, false);
+    check_available_tasks();
+    TEST_ASSERT_NOT_NULL(layer.task_index);
+}
+
+void test_available_tasks_benchmark(void)
+{
+    static const uint32_t task_cnts[] = {250, 1000, 4000};
+
+    for(uint32_t i = 0; i < sizeof(task_cnts) / sizeof(task_cnts[0]); i++) {
+        /*Lines of 8x16 letters, wrapping around after a screen full of text*/
+        for(uint32_t j = 0; j < task_cnts[i]; j++) {
+            int32_t x = (j % 100) * 8;
+            int32_t y = ((j / 100) % 30) * 16;
+            add_task(x, y, 8, 16, UNIT_A, LV_DRAW_TASK_STATE_WAITING);
+        }
+
+        uint32_t ref_cnt = 0;
+        clock_t start = clock();
+        lv_draw_task_t * t = NULL;
+        while((t = ref_get_next_available_task(t, UNIT_A)) != NULL) ref_cnt++;
+        uint32_t ref_us = (uint32_t)((clock() - start) * 1000000 / CLOCKS_PER_SEC);
+
+        uint32_t cnt = 0;
+        start = clock();
+        t = NULL;
+        while((t = lv_draw_get_next_available_task(&layer, t, UNIT_A)) != NULL) cnt++;
+        uint32_t indexed_us = (uint32_t)((clock() - start) * 1000000 / CLOCKS_PER_SEC);
+
+        TEST_ASSERT_EQUAL_UINT32(ref_cnt, cnt);
+        TEST_PRINTF("%d letter draw tasks: linear search %d us, indexed search %d us",
+                    (int)task_cnts[i], (int)ref_us, (int)indexed_us);
+
+        finish_all_tasks();
+        add_task(-100, -100, 10, 10, UNIT_A, LV_DRAW_TASK_STATE_QUEUED);
+    }
+}
+
+#endif
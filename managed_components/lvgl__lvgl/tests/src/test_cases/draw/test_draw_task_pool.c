@@ -0,0 +1,156 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*Not used by any real draw units so the software renderer won't take these draw tasks*/
+#define UNIT_A  10
+
+static lv_layer_t layer;
+static size_t pool_size_start;
+static size_t pool_used_start;
+
+static lv_draw_task_t * add_task(int32_t x, int32_t y, int state)
+{
+    lv_area_t a = {x, y, x + 9, y + 9};
+    lv_draw_task_t * t = lv_draw_add_task(&layer, &a, LV_DRAW_TASK_TYPE_FILL);
+    lv_draw_finalize_task_creation(&layer, t);
+    t->preferred_draw_unit_id = UNIT_A;
+    t->state = state;
+    return t;
+}
+
+static void finish_all_tasks(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+}
+
+static size_t get_pool_size(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.draw_task_pool_size;
+}
+
+static size_t get_pool_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.draw_task_pool_used;
+}
+
+void setUp(void)
+{
+    lv_area_t a = {0, 0, 799, 479};
+    lv_layer_init(&layer);
+    layer.buf_area = a;
+    layer._clip_area = a;
+    layer.phy_clip_area = a;
+
+    pool_size_start = get_pool_size();
+    pool_used_start = get_pool_used();
+}
+
+void tearDown(void)
+{
+    finish_all_tasks();
+    TEST_ASSERT_NULL(layer.draw_task_head);
+    TEST_ASSERT_NULL(layer.task_pool_chunk);
+    TEST_ASSERT_EQUAL_UINT32(pool_used_start, get_pool_used());
+}
+
+void test_draw_tasks_are_counted_in_mem_monitor(void)
+{
+    /*Keep a not waiting draw task at the head so that the dispatcher never starts rendering anything*/
+    add_task(-100, -100, LV_DRAW_TASK_STATE_QUEUED);
+    for(uint32_t i = 0; i < 100; i++) add_task(i * 5, 0, LV_DRAW_TASK_STATE_WAITING);
+
+    TEST_ASSERT_NOT_NULL(layer.task_pool_chunk);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(pool_used_start + 101 * (sizeof(lv_draw_task_t) + sizeof(lv_draw_fill_dsc_t)),
+                                        get_pool_used());
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(get_pool_used() - pool_used_start, get_pool_size() - pool_size_start);
+
+    finish_all_tasks();
+    TEST_ASSERT_NULL(layer.task_pool_chunk);
+    TEST_ASSERT_EQUAL_UINT32(pool_used_start, get_pool_used());
+}
+
+void test_chunks_are_reused(void)
+{
+    add_task(-100, -100, LV_DRAW_TASK_STATE_QUEUED);
+    for(uint32_t i = 0; i < 20; i++) add_task(i * 5, 0, LV_DRAW_TASK_STATE_WAITING);
+    finish_all_tasks();
+    size_t pool_size = get_pool_size();
+
+    for(uint32_t j = 0; j < 10; j++) {
+        add_task(-100, -100, LV_DRAW_TASK_STATE_QUEUED);
+        for(uint32_t i = 0; i < 20; i++) add_task(i * 5, 0, LV_DRAW_TASK_STATE_WAITING);
+        finish_all_tasks();
+        TEST_ASSERT_EQUAL_UINT32(pool_size, get_pool_size());
+    }
+}
+
+void test_chunks_are_released_when_their_tasks_are_finished(void)
+{
+    lv_draw_task_t * t_head = add_task(-100, -100, LV_DRAW_TASK_STATE_QUEUED);
+    for(uint32_t i = 0; i < 500; i++) add_task(i, 0, LV_DRAW_TASK_STATE_WAITING);
+    size_t pool_size_full = get_pool_size();
+
+    /*Finish all but the first and last draw tasks*/
+    lv_draw_task_t * t = t_head->next;
+    while(t->next) {
+        t->state = LV_DRAW_TASK_STATE_FINISHED;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+
+    TEST_ASSERT_NOT_NULL(layer.draw_task_head);
+    TEST_ASSERT_LESS_THAN_UINT32(pool_size_full, get_pool_size());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(pool_size_start + (2 + LV_DRAW_TASK_POOL_CACHE_CNT) * LV_DRAW_TASK_POOL_CHUNK_SIZE,
+                                     get_pool_size());
+}
+
+void test_large_allocation(void)
+{
+    void * p = lv_draw_task_pool_alloc(&layer, LV_DRAW_TASK_POOL_CHUNK_SIZE * 4);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL_UINT32(0, (lv_uintptr_t)p % 8);
+    lv_memset(p, 0xaa, LV_DRAW_TASK_POOL_CHUNK_SIZE * 4);
+    TEST_ASSERT_GREATER_THAN_UINT32(pool_size_start + LV_DRAW_TASK_POOL_CHUNK_SIZE * 4, get_pool_size());
+
+    lv_draw_task_pool_free(p);
+    TEST_ASSERT_EQUAL_UINT32(pool_size_start, get_pool_size());
+}
+
+void test_local_label_text_is_copied(void)
+{
+    add_task(-100, -100, LV_DRAW_TASK_STATE_QUEUED);
+
+    char buf[16];
+    lv_strcpy(buf, "Hello world");
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = buf;
+    dsc.text_length = 5;
+    dsc.text_local = 1;
+
+    lv_area_t a = {0, 0, 99, 19};
+    lv_draw_label(&layer, &dsc, &a);
+    lv_strcpy(buf, "Changed");
+
+    lv_draw_task_t * t = layer.draw_task_head->next;
+    TEST_ASSERT_NOT_NULL(t);
+    t->preferred_draw_unit_id = UNIT_A;
+    lv_draw_label_dsc_t * task_dsc = lv_draw_task_get_label_dsc(t);
+    TEST_ASSERT_NOT_EQUAL(buf, task_dsc->text);
+    TEST_ASSERT_EQUAL_STRING("Hello", task_dsc->text);
+}
+
+#endif
@@ -0,0 +1,165 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+LV_IMAGE_DECLARE(test_lvgl_logo_ARGB8888);
+LV_IMAGE_DECLARE(test_lvgl_logo_ARGB8888_LZ4_band8);
+LV_IMAGE_DECLARE(test_lvgl_logo_RGB565);
+LV_IMAGE_DECLARE(test_lvgl_logo_RGB565_RLE_band7);
+
+#define BAND_FILE "A:test_images/band/test_lvgl_logo_ARGB8888_LZ4_band8.bin"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_image(const void * src, bool tile)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, src);
+    lv_obj_center(img);
+    if(tile) {
+        lv_obj_set_size(img, 275, 175);
+        lv_image_set_inner_align(img, LV_IMAGE_ALIGN_TILE);
+    }
+}
+
+static void draw_image(const void * src, bool tile, const char * screenshot)
+{
+    lv_image_cache_drop(src);
+    create_image(src, tile);
+    TEST_ASSERT_EQUAL_SCREENSHOT(screenshot);
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Check that the bands returned for `full_area` start at `band_y1` and match the uncompressed image*/
+static void check_get_area(const void * src, const lv_image_dsc_t * ref, const lv_area_t * full_area,
+                           const int32_t * band_y1, int32_t band_rows, uint32_t band_cnt)
+{
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, NULL));
+    TEST_ASSERT_NULL(dsc.decoded); /*Nothing is decompressed at open*/
+
+    uint32_t px_size = lv_color_format_get_size(ref->header.cf);
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    for(uint32_t i = 0; i < band_cnt; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&dsc, full_area, &decoded_area));
+        int32_t y2 = LV_MIN(band_y1[i] + band_rows, (int32_t)ref->header.h) - 1;
+        TEST_ASSERT_EQUAL_INT32(0, decoded_area.x1);
+        TEST_ASSERT_EQUAL_INT32(ref->header.w - 1, decoded_area.x2);
+        TEST_ASSERT_EQUAL_INT32(band_y1[i], decoded_area.y1);
+        TEST_ASSERT_EQUAL_INT32(y2, decoded_area.y2);
+
+        const lv_draw_buf_t * decoded = dsc.decoded;
+        TEST_ASSERT_NOT_NULL(decoded);
+        TEST_ASSERT_EQUAL_UINT32(ref->header.cf, decoded->header.cf);
+        for(int32_t y = band_y1[i]; y <= y2; y++) {
+            TEST_ASSERT_EQUAL_MEMORY(ref->data + y * ref->header.stride,
+                                     decoded->data + (y - band_y1[i]) * decoded->header.stride,
+                                     ref->header.w * px_size);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, full_area, &decoded_area));
+    lv_image_decoder_close(&dsc);
+}
+
+void test_bin_decoder_band_draw(void)
+{
+    /*The images compressed in bands look exactly like the uncompressed ones*/
+    draw_image(&test_lvgl_logo_ARGB8888, false, "libs/bin_decoder_band_argb8888.png");
+    draw_image(&test_lvgl_logo_ARGB8888_LZ4_band8, false, "libs/bin_decoder_band_argb8888.png");
+    draw_image(BAND_FILE, false, "libs/bin_decoder_band_argb8888.png");
+
+    draw_image(&test_lvgl_logo_RGB565, false, "libs/bin_decoder_band_rgb565.png");
+    draw_image(&test_lvgl_logo_RGB565_RLE_band7, false, "libs/bin_decoder_band_rgb565.png");
+}
+
+void test_bin_decoder_band_draw_tile(void)
+{
+    draw_image(&test_lvgl_logo_ARGB8888, true, "libs/bin_decoder_band_argb8888_tile.png");
+    draw_image(&test_lvgl_logo_ARGB8888_LZ4_band8, true, "libs/bin_decoder_band_argb8888_tile.png");
+    draw_image(BAND_FILE, true, "libs/bin_decoder_band_argb8888_tile.png");
+}
+
+void test_bin_decoder_band_get_area(void)
+{
+    /*Only the bands intersecting the area are returned*/
+    lv_area_t full_area = {10, 13, 50, 22};
+    int32_t band_y1[] = {8, 16};
+    check_get_area(&test_lvgl_logo_ARGB8888_LZ4_band8, &test_lvgl_logo_ARGB8888, &full_area, band_y1, 8, 2);
+    check_get_area(BAND_FILE, &test_lvgl_logo_ARGB8888, &full_area, band_y1, 8, 2);
+
+    /*The last band is shorter*/
+    lv_area_t full_area_bottom = {0, 30, 104, 39};
+    int32_t band_y1_bottom[] = {28, 35};
+    check_get_area(&test_lvgl_logo_RGB565_RLE_band7, &test_lvgl_logo_RGB565, &full_area_bottom, band_y1_bottom, 7, 2);
+
+    lv_area_t full_area_all = {0, 0, 104, 39};
+    int32_t band_y1_all[] = {0, 8, 16, 24, 32};
+    check_get_area(&test_lvgl_logo_ARGB8888_LZ4_band8, &test_lvgl_logo_ARGB8888, &full_area_all, band_y1_all, 8, 5);
+}
+
+void test_bin_decoder_band_invalid(void)
+{
+    static uint8_t data[8192];
+    const lv_image_dsc_t * src = &test_lvgl_logo_ARGB8888_LZ4_band8;
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(data), src->data_size);
+
+    lv_image_dsc_t image = *src;
+    image.data = data;
+    lv_image_decoder_dsc_t dsc;
+
+    /*A valid copy can be opened*/
+    lv_memcpy(data, src->data, src->data_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &image, NULL));
+    lv_image_decoder_close(&dsc);
+
+    /*Offsets of the bands decrease*/
+    uint32_t * index = (uint32_t *)(data + 12);
+    index[2] = index[1] - 1;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_open(&dsc, &image, NULL));
+
+    /*The last band doesn't end at the end of the data*/
+    lv_memcpy(data, src->data, src->data_size);
+    index[5]--;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_open(&dsc, &image, NULL));
+
+    /*A corrupt band fails only when it's decompressed*/
+    lv_memcpy(data, src->data, src->data_size);
+    lv_memset(data + 12 + 6 * 4 + index[1], 0xff, index[2] - index[1]);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &image, NULL));
+    lv_area_t full_area = {0, 0, 104, 39};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    lv_image_decoder_close(&dsc);
+
+    /*Truncated data*/
+    lv_memcpy(data, src->data, src->data_size);
+    image.data_size--;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_open(&dsc, &image, NULL));
+}
+
+void test_bin_decoder_band_mem_leak(void)
+{
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 20; i++) {
+        create_image(&test_lvgl_logo_ARGB8888_LZ4_band8, false);
+        create_image(BAND_FILE, true);
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+        lv_obj_clean(lv_screen_active());
+    }
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+}
+
+#endif
@@ -0,0 +1,281 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+#if LV_BIN_DECODER_MAP_FILES
+
+LV_IMAGE_DECLARE(test_lvgl_logo_ARGB8888);
+
+#define MAP_FILE "Z:logo.bin"
+
+/*A file system keeping a bin image in RAM, so the mapped pixels can be aligned as the draw units need*/
+typedef struct {
+    uint32_t pos;
+} mem_file_t;
+
+static lv_fs_drv_t mem_drv;
+static uint8_t file_storage[LV_DRAW_BUF_ALIGN + 32 * 1024];
+static uint8_t * file_data;
+static uint32_t file_size;
+static bool map_enabled;
+static uint32_t map_cnt;
+static uint32_t unmap_cnt;
+
+static void * mem_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(mode);
+    if(!lv_streq(path, "logo.bin")) return NULL;
+    return lv_malloc_zeroed(sizeof(mem_file_t));
+}
+
+static lv_fs_res_t mem_close(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+    lv_free(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t mem_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+    mem_file_t * f = file_p;
+    *br = LV_MIN(btr, file_size - f->pos);
+    lv_memcpy(buf, file_data + f->pos, *br);
+    f->pos += *br;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t mem_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    mem_file_t * f = file_p;
+    if(whence == LV_FS_SEEK_SET) f->pos = pos;
+    else if(whence == LV_FS_SEEK_CUR) f->pos += pos;
+    else f->pos = file_size - pos;
+    f->pos = LV_MIN(f->pos, file_size);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t mem_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(drv);
+    *pos_p = ((mem_file_t *)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t mem_map(lv_fs_drv_t * drv, void * file_p, const void ** buf_p, uint32_t * size_p)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    if(!map_enabled) return LV_FS_RES_NOT_IMP;
+
+    map_cnt++;
+    *buf_p = file_data;
+    *size_p = file_size;
+    return LV_FS_RES_OK;
+}
+
+static void mem_unmap(lv_fs_drv_t * drv, const void * buf, uint32_t size)
+{
+    LV_UNUSED(drv);
+    TEST_ASSERT_EQUAL_PTR(file_data, buf);
+    TEST_ASSERT_EQUAL_UINT32(file_size, size);
+    unmap_cnt++;
+}
+
+/*Store the image as a bin file with its pixels at `pixel_ofs` from an aligned address, with the default stride*/
+static void create_file(const lv_image_dsc_t * img, uint32_t pixel_ofs)
+{
+    lv_image_header_t header = img->header;
+    header.stride = lv_draw_buf_width_to_stride(header.w, header.cf);
+
+    uint8_t * pixels = lv_draw_buf_align(file_storage + sizeof(lv_image_header_t), header.cf);
+    file_data = pixels + pixel_ofs - sizeof(lv_image_header_t);
+    file_size = sizeof(lv_image_header_t) + header.stride * header.h;
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(file_storage), file_data - file_storage + file_size);
+
+    lv_memzero(file_data, file_size);
+    lv_memcpy(file_data, &header, sizeof(lv_image_header_t));
+    for(uint32_t y = 0; y < header.h; y++) {
+        lv_memcpy(file_data + sizeof(lv_image_header_t) + y * header.stride, img->data + y * img->header.stride,
+                  img->header.stride);
+    }
+}
+
+void setUp(void)
+{
+    if(lv_fs_get_drv('Z') == NULL) {
+        lv_fs_drv_init(&mem_drv);
+        mem_drv.letter = 'Z';
+        mem_drv.open_cb = mem_open;
+        mem_drv.close_cb = mem_close;
+        mem_drv.read_cb = mem_read;
+        mem_drv.seek_cb = mem_seek;
+        mem_drv.tell_cb = mem_tell;
+        mem_drv.map_cb = mem_map;
+        mem_drv.unmap_cb = mem_unmap;
+        lv_fs_drv_register(&mem_drv);
+    }
+
+    create_file(&test_lvgl_logo_ARGB8888, 0);
+    map_enabled = true;
+    map_cnt = 0;
+    unmap_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    TEST_ASSERT_EQUAL_UINT32(map_cnt, unmap_cnt);
+}
+
+static const lv_draw_buf_t * open_file(lv_image_decoder_dsc_t * dsc, const lv_image_decoder_args_t * args)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(dsc, MAP_FILE, args));
+    const lv_draw_buf_t * decoded = dsc->decoded;
+    TEST_ASSERT_NOT_NULL(decoded);
+    return decoded;
+}
+
+void test_bin_decoder_map_draw(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, MAP_FILE);
+    lv_obj_center(img);
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/bin_decoder_band_argb8888.png");
+    TEST_ASSERT_EQUAL_UINT32(1, map_cnt);
+
+    /*Read as before if the file can't be mapped*/
+    lv_image_cache_drop(NULL);
+    map_enabled = false;
+    lv_obj_invalidate(img);
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/bin_decoder_band_argb8888.png");
+    TEST_ASSERT_EQUAL_UINT32(1, map_cnt);
+}
+
+void test_bin_decoder_map_zero_copy(void)
+{
+    size_t cache_size = lv_cache_get_size(LV_GLOBAL_DEFAULT()->img_cache, NULL);
+
+    /*The pixels are used from the mapped file*/
+    lv_image_decoder_dsc_t dsc;
+    const lv_draw_buf_t * decoded = open_file(&dsc, NULL);
+    TEST_ASSERT_EQUAL_PTR(file_data + sizeof(lv_image_header_t), decoded->data);
+    TEST_ASSERT_EQUAL_UINT32(file_size - sizeof(lv_image_header_t), decoded->data_size);
+    TEST_ASSERT_FALSE(lv_draw_buf_has_flag(decoded, LV_IMAGE_FLAGS_MODIFIABLE));
+
+    /*The image is cached but takes almost no room in the cache*/
+    TEST_ASSERT_NOT_NULL(dsc.cache_entry);
+    TEST_ASSERT_EQUAL_size_t(cache_size + 1, lv_cache_get_size(LV_GLOBAL_DEFAULT()->img_cache, NULL));
+    lv_image_decoder_close(&dsc);
+    TEST_ASSERT_EQUAL_UINT32(0, unmap_cnt);
+
+    /*Opened again from the cache*/
+    open_file(&dsc, NULL);
+    lv_image_decoder_close(&dsc);
+    TEST_ASSERT_EQUAL_UINT32(1, map_cnt);
+
+    /*Unmapped when it's dropped from the cache*/
+    lv_image_cache_drop(MAP_FILE);
+    TEST_ASSERT_EQUAL_UINT32(1, unmap_cnt);
+}
+
+void test_bin_decoder_map_no_cache(void)
+{
+    lv_image_decoder_args_t args = {
+        .no_cache = true,
+    };
+
+    lv_image_decoder_dsc_t dsc;
+    const lv_draw_buf_t * decoded = open_file(&dsc, &args);
+    TEST_ASSERT_EQUAL_PTR(file_data + sizeof(lv_image_header_t), decoded->data);
+    TEST_ASSERT_NULL(dsc.cache_entry);
+    TEST_ASSERT_EQUAL_UINT32(0, unmap_cnt);
+
+    lv_image_decoder_close(&dsc);
+    TEST_ASSERT_EQUAL_UINT32(1, unmap_cnt);
+}
+
+void test_bin_decoder_map_copy(void)
+{
+    /*Unaligned pixels are read as usual*/
+    create_file(&test_lvgl_logo_ARGB8888, 4);
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, MAP_FILE, NULL));
+    const lv_draw_buf_t * decoded = dsc.decoded;
+    TEST_ASSERT_TRUE(decoded == NULL || lv_draw_buf_has_flag(decoded, LV_IMAGE_FLAGS_MODIFIABLE));
+    TEST_ASSERT_EQUAL_UINT32(1, map_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, unmap_cnt);
+    lv_image_decoder_close(&dsc);
+    lv_image_cache_drop(NULL);
+
+    /*The pixels are copied if they need to be changed*/
+    create_file(&test_lvgl_logo_ARGB8888, 0);
+    lv_image_decoder_args_t args = {
+        .premultiply = true,
+    };
+    decoded = open_file(&dsc, &args);
+    TEST_ASSERT_NOT_EQUAL(file_data + sizeof(lv_image_header_t), decoded->data);
+    TEST_ASSERT_TRUE(lv_draw_buf_has_flag(decoded, LV_IMAGE_FLAGS_PREMULTIPLIED));
+    TEST_ASSERT_EQUAL_UINT32(2, map_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, unmap_cnt);
+    lv_image_decoder_close(&dsc);
+}
+
+/*Open the image and get all of its pixels, either at once or via `get_area_cb`*/
+static void decode_all(size_t * mem_used)
+{
+    lv_image_decoder_args_t args = {
+        .no_cache = true,
+    };
+
+    size_t mem_before = lv_test_get_free_mem();
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, MAP_FILE, &args));
+    *mem_used = mem_before - lv_test_get_free_mem();
+
+    if(dsc.decoded == NULL) {
+        lv_area_t full_area = {0, 0, dsc.header.w - 1, dsc.header.h - 1};
+        lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+        while(lv_image_decoder_get_area(&dsc, &full_area, &decoded_area) == LV_RESULT_OK) {
+            *mem_used = LV_MAX(*mem_used, mem_before - lv_test_get_free_mem());
+        }
+    }
+
+    lv_image_decoder_close(&dsc);
+}
+
+static void measure(const char * name)
+{
+    const uint32_t iter = 1000;
+    size_t mem_used = 0;
+    clock_t t = clock();
+    for(uint32_t i = 0; i < iter; i++) {
+        decode_all(&mem_used);
+    }
+    t = clock() - t;
+
+    TEST_PRINTF("%s: %d us, peak heap %d bytes", name,
+                (int)(((uint64_t)t * 1000000) / ((uint64_t)CLOCKS_PER_SEC * iter)), (int)mem_used);
+}
+
+void test_bin_decoder_map_benchmark(void)
+{
+    /*The mapped file needs no heap for the pixels*/
+    size_t mem_used;
+    decode_all(&mem_used);
+    TEST_ASSERT_LESS_THAN(test_lvgl_logo_ARGB8888.data_size / 16, mem_used);
+
+    measure("mapped");
+    map_enabled = false;
+    measure("read");
+}
+
+#endif
+
+#endif
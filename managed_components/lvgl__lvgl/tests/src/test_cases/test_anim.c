@@ -4,6 +4,7 @@
 
 #include "unity/unity.h"
 
+#include <time.h>
 
 void setUp(void)
 {
@@ -35,6 +36,42 @@ static void custom_exec_cb(lv_anim_t * a, int32_t v)
     *var_i32 = v;
 }
 
+static int32_t order_vars[4];
+static int32_t order_log[8];
+static uint32_t order_log_cnt;
+
+static void order_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(v);
+    if(order_log_cnt < 8) order_log[order_log_cnt++] = (int32_t)((int32_t *)var - order_vars);
+}
+
+/*Delete the next animation and start a new one when completed*/
+static void delete_next_completed_cb(lv_anim_t * a)
+{
+    int32_t * var = a->var;
+    (*(int32_t *)lv_anim_get_user_data(a))++;
+    if(var > order_vars) lv_anim_delete(var - 1, exec_cb);
+
+    lv_anim_t a_new;
+    lv_anim_init(&a_new);
+    lv_anim_set_var(&a_new, &order_vars[3]);
+    lv_anim_set_values(&a_new, 0, 100);
+    lv_anim_set_exec_cb(&a_new, exec_cb);
+    lv_anim_set_duration(&a_new, 100);
+    lv_anim_start(&a_new);
+}
+
+static void benchmark_exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+static void benchmark_completed_cb(lv_anim_t * a)
+{
+    (*(uint32_t *)lv_anim_get_user_data(a))++;
+}
+
 void test_anim_delete(void)
 {
     int32_t var;
@@ -67,6 +104,32 @@ void test_anim_delete(void)
     TEST_ASSERT_EQUAL(39, var);
 }
 
+void test_anim_set_var_of_running_anim(void)
+{
+    int32_t var1 = 0;
+    int32_t var2 = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &var1);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_t * running = lv_anim_start(&a);
+
+    /*Switch the running animation to the other variable before the timer runs*/
+    lv_anim_set_var(running, &var2);
+    TEST_ASSERT_NULL(lv_anim_get(&var1, exec_cb));
+    TEST_ASSERT_EQUAL_PTR(running, lv_anim_get(&var2, exec_cb));
+
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(0, var1);
+    TEST_ASSERT_EQUAL(19, var2);
+
+    TEST_ASSERT_FALSE(lv_anim_delete(&var1, exec_cb));
+    TEST_ASSERT_TRUE(lv_anim_delete(&var2, exec_cb));
+}
+
 void test_anim_delete_custom(void)
 {
     int32_t var;
@@ -263,4 +326,195 @@ void test_anim_vsync_mode(void)
     lv_anim_delete(&var, exec_cb);
 }
 
+void test_anim_order(void)
+{
+    /*The newest animation runs first*/
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_exec_cb(&a, order_exec_cb);
+    lv_anim_set_duration(&a, 100);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_anim_set_var(&a, &order_vars[i]);
+        lv_anim_start(&a);
+    }
+    TEST_ASSERT_EQUAL(3, lv_anim_count_running());
+
+    order_log_cnt = 0;
+    lv_tick_inc(1);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL(3, order_log_cnt);
+    TEST_ASSERT_EQUAL(2, order_log[0]);
+    TEST_ASSERT_EQUAL(1, order_log[1]);
+    TEST_ASSERT_EQUAL(0, order_log[2]);
+
+    /*Deleting one doesn't change the order of the others*/
+    lv_anim_delete(&order_vars[1], order_exec_cb);
+    TEST_ASSERT_EQUAL(2, lv_anim_count_running());
+    TEST_ASSERT_NULL(lv_anim_get(&order_vars[1], NULL));
+    TEST_ASSERT_NOT_NULL(lv_anim_get(&order_vars[2], NULL));
+
+    order_log_cnt = 0;
+    lv_tick_inc(1);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL(2, order_log_cnt);
+    TEST_ASSERT_EQUAL(2, order_log[0]);
+    TEST_ASSERT_EQUAL(0, order_log[1]);
+}
+
+void test_anim_delete_and_start_in_completed_cb(void)
+{
+    /*Animations completing at the same time, each deletes the older one and starts a new one*/
+    int32_t completed_cnt = 0;
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_completed_cb(&a, delete_next_completed_cb);
+    lv_anim_set_user_data(&a, &completed_cnt);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_anim_set_var(&a, &order_vars[i]);
+        lv_anim_start(&a);
+    }
+
+    /*Only the newest completes, it deletes the middle one, and the oldest completes*/
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL(2, completed_cnt);
+    TEST_ASSERT_EQUAL(100, order_vars[2]);
+    TEST_ASSERT_EQUAL(100, order_vars[0]);
+    TEST_ASSERT_NOT_EQUAL(100, order_vars[1]);
+
+    /*The 2 new animations are for the same variable so only the second one remains*/
+    TEST_ASSERT_EQUAL(1, lv_anim_count_running());
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL(100, order_vars[3]);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+void test_anim_many(void)
+{
+    /*More animations than the initial size of the animation array, all with different timing*/
+    uint32_t anim_cnt = 300;
+    int32_t * vars = lv_malloc_zeroed(anim_cnt * sizeof(int32_t));
+    uint32_t completed_cnt = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, benchmark_exec_cb);
+    lv_anim_set_completed_cb(&a, benchmark_completed_cb);
+    lv_anim_set_user_data(&a, &completed_cnt);
+    uint32_t i;
+    for(i = 0; i < anim_cnt; i++) {
+        lv_anim_set_var(&a, &vars[i]);
+        lv_anim_set_values(&a, 0, i);
+        lv_anim_set_duration(&a, 10 + i % 50);
+        lv_anim_set_delay(&a, i % 7);
+        lv_anim_start(&a);
+    }
+    TEST_ASSERT_EQUAL(anim_cnt, lv_anim_count_running());
+
+    /*Delete every third*/
+    for(i = 0; i < anim_cnt; i += 3) {
+        TEST_ASSERT_TRUE(lv_anim_delete(&vars[i], benchmark_exec_cb));
+    }
+    TEST_ASSERT_EQUAL(anim_cnt - anim_cnt / 3, lv_anim_count_running());
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL(anim_cnt - anim_cnt / 3, completed_cnt);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+    for(i = 0; i < anim_cnt; i++) {
+        if(i % 3) TEST_ASSERT_EQUAL(i, vars[i]);
+    }
+
+    lv_free(vars);
+}
+
+void test_anim_path_values(void)
+{
+    /*The built-in cubic-bezier paths give the same values with and without lookup table*/
+    const struct {
+        lv_anim_path_cb_t path_cb;
+        int32_t x1, y1, x2, y2;
+    } paths[] = {
+        {lv_anim_path_ease_in, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1)},
+        {lv_anim_path_ease_out, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+        {lv_anim_path_ease_in_out, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+        {lv_anim_path_overshoot, 341, 0, 683, 1300},
+    };
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_values(&a, -300, 2000);
+    lv_anim_set_duration(&a, 1777);
+
+    uint32_t p;
+    for(p = 0; p < sizeof(paths) / sizeof(paths[0]); p++) {
+        for(a.act_time = -10; a.act_time <= 1790; a.act_time++) {
+            int32_t t = lv_map(a.act_time, 0, a.duration, 0, LV_BEZIER_VAL_MAX);
+            int32_t step = lv_cubic_bezier(t, paths[p].x1, paths[p].y1, paths[p].x2, paths[p].y2);
+            int32_t expected = ((step * (a.end_value - a.start_value)) >> LV_BEZIER_VAL_SHIFT) + a.start_value;
+            TEST_ASSERT_EQUAL_INT32(expected, paths[p].path_cb(&a));
+        }
+    }
+
+    /*Custom bezier3 path*/
+    lv_anim_set_bezier3_param(&a, 100, 900, 300, 1100);
+    a.act_time = 500;
+    int32_t t = lv_map(a.act_time, 0, a.duration, 0, LV_BEZIER_VAL_MAX);
+    int32_t step = lv_cubic_bezier(t, 100, 900, 300, 1100);
+    TEST_ASSERT_EQUAL_INT32(((step * 2300) >> LV_BEZIER_VAL_SHIFT) - 300, lv_anim_path_custom_bezier3(&a));
+}
+
+void test_anim_benchmark(void)
+{
+    uint32_t anim_cnts[] = {1000, 10000};
+    uint32_t c;
+    for(c = 0; c < sizeof(anim_cnts) / sizeof(anim_cnts[0]); c++) {
+        uint32_t anim_cnt = anim_cnts[c];
+        int32_t * vars = lv_malloc_zeroed(anim_cnt * sizeof(int32_t));
+        TEST_ASSERT_NOT_NULL(vars);
+        uint32_t completed_cnt = 0;
+
+        struct timespec start;
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_exec_cb(&a, benchmark_exec_cb);
+        lv_anim_set_completed_cb(&a, benchmark_completed_cb);
+        lv_anim_set_user_data(&a, &completed_cnt);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+        lv_anim_set_values(&a, 0, 1000);
+        uint32_t i;
+        for(i = 0; i < anim_cnt; i++) {
+            lv_anim_set_var(&a, &vars[i]);
+            /*Half of them complete at the same time*/
+            lv_anim_set_duration(&a, i % 2 ? 500 : 300 + i % 400);
+            lv_anim_start(&a);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        uint32_t start_us = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+
+        /*Run the animations in 10 ms steps until all complete*/
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for(i = 0; i < 70; i++) {
+            lv_tick_inc(10);
+            lv_anim_refr_now();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        uint32_t run_us = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+
+        TEST_PRINTF("%d animations: start %d us, run %d us", (int)anim_cnt, (int)start_us, (int)run_us);
+        TEST_ASSERT_EQUAL(anim_cnt, completed_cnt);
+        TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+        TEST_ASSERT_EQUAL(1000, vars[anim_cnt - 1]);
+
+        lv_free(vars);
+    }
+}
+
 #endif
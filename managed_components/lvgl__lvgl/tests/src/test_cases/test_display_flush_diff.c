@@ -0,0 +1,241 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DISPLAY_FLUSH_DIFF
+
+#define DISP_HOR_RES    200
+#define DISP_VER_RES    100
+#define DISP_BUF_ROWS   20
+
+/*Leave room for the stride and buffer alignment*/
+#define DISP_BUF_SIZE   (DISP_BUF_ROWS * (DISP_HOR_RES * 2 + 256) + LV_DRAW_BUF_ALIGN)
+
+static lv_display_t * disp;
+static LV_ATTRIBUTE_MEM_ALIGN uint8_t disp_buf1[DISP_BUF_SIZE];
+static LV_ATTRIBUTE_MEM_ALIGN uint8_t disp_buf2[DISP_BUF_SIZE];
+
+/*What the display shows*/
+static uint16_t screen_px[DISP_VER_RES][DISP_HOR_RES];
+/*The whole screen rendered without flush diff*/
+static uint16_t ref_px[DISP_VER_RES][DISP_HOR_RES];
+static uint16_t (*flush_dest)[DISP_HOR_RES] = screen_px;
+static uint32_t flush_cnt;
+static uint32_t flushed_rows;
+static bool last_flushed;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&flush_dest[y][area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+
+    flush_cnt++;
+    flushed_rows += lv_area_get_height(area);
+    last_flushed = lv_display_flush_is_last(d);
+    lv_display_flush_ready(d);
+}
+
+static void refresh(void)
+{
+    flush_cnt = 0;
+    flushed_rows = 0;
+    last_flushed = false;
+    lv_refr_now(disp);
+}
+
+/*Invalidating the whole screen would forget the flushed rows, so leave out the last row*/
+static void invalidate_all_but_last_row(void)
+{
+    lv_area_t area = {0, 0, DISP_HOR_RES - 1, DISP_VER_RES - 2};
+    lv_inv_area(disp, &area);
+}
+
+static void assert_screen_matches_rendering(void)
+{
+    /*Render the whole screen again but keep the hashes of the flushed rows*/
+    static lv_display_flush_diff_row_t rows[DISP_VER_RES];
+    lv_memcpy(rows, disp->flush_diff_rows, sizeof(rows));
+    disp->flush_diff = 0;
+    flush_dest = ref_px;
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    flush_dest = screen_px;
+    disp->flush_diff = 1;
+    lv_memcpy(disp->flush_diff_rows, rows, sizeof(rows));
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_px, screen_px, sizeof(screen_px));
+}
+
+void setUp(void)
+{
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    uint32_t buf_size = DISP_BUF_ROWS * lv_draw_buf_width_to_stride(DISP_HOR_RES, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(disp_buf1, LV_COLOR_FORMAT_RGB565),
+                           lv_draw_buf_align(disp_buf2, LV_COLOR_FORMAT_RGB565), buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_flush_diff(disp, true);
+    lv_memzero(screen_px, sizeof(screen_px));
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+}
+
+void test_display_flush_diff_flushes_everything_first(void)
+{
+    lv_obj_t * label = lv_label_create(lv_display_get_screen_active(disp));
+    lv_label_set_text(label, "1234");
+    lv_obj_center(label);
+
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(DISP_VER_RES / DISP_BUF_ROWS, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(DISP_VER_RES, flushed_rows);
+    TEST_ASSERT_TRUE(last_flushed);
+    assert_screen_matches_rendering();
+}
+
+void test_display_flush_diff_skips_unchanged_areas(void)
+{
+    lv_obj_t * label = lv_label_create(lv_display_get_screen_active(disp));
+    lv_label_set_text(label, "1234");
+    lv_obj_center(label);
+    refresh();
+
+    /*Redraw the screen without changing anything. Only one row of the last area is flushed.*/
+    invalidate_all_but_last_row();
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, flushed_rows);
+    TEST_ASSERT_TRUE(last_flushed);
+    assert_screen_matches_rendering();
+}
+
+void test_display_flush_diff_flushes_only_changed_rows(void)
+{
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * label = lv_label_create(scr);
+    lv_label_set_text(label, "1234");
+    lv_obj_set_pos(label, 10, 40);
+    lv_obj_set_width(label, 100);   /*Always invalidate the same area*/
+
+    /*Only the underline changes so only a few rows should be flushed*/
+    lv_obj_t * line = lv_obj_create(scr);
+    lv_obj_set_style_radius(line, 0, 0);
+    lv_obj_set_style_border_width(line, 0, 0);
+    lv_obj_set_style_bg_color(line, lv_color_hex(0xff0000), 0);
+    lv_obj_set_size(line, 100, 2);
+    lv_obj_set_pos(line, 10, 70);
+    refresh();
+
+    lv_obj_set_style_bg_color(line, lv_color_hex(0x0000ff), 0);
+    invalidate_all_but_last_row();
+    refresh();
+    /*2 changed rows and 1 row of the last, unchanged area*/
+    TEST_ASSERT_EQUAL_UINT32(3, flushed_rows);
+    assert_screen_matches_rendering();
+
+    /*These columns of the rows were not flushed alone yet, so they are flushed*/
+    lv_obj_invalidate(label);
+    refresh();
+    uint32_t label_area_rows = flushed_rows;
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(lv_obj_get_height(label), label_area_rows);
+    assert_screen_matches_rendering();
+
+    /*Redrawing the same label again flushes only a single row*/
+    lv_label_set_text(label, "1234");
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(1, flushed_rows);
+    assert_screen_matches_rendering();
+
+    /*Only the rows of the glyphs are flushed, not the empty rows around them*/
+    lv_label_set_text(label, "1284");
+    refresh();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, flushed_rows);
+    TEST_ASSERT_LESS_THAN_UINT32(label_area_rows, flushed_rows);
+    assert_screen_matches_rendering();
+}
+
+void test_display_flush_diff_full_invalidation_flushes_everything(void)
+{
+    lv_obj_t * label = lv_label_create(lv_display_get_screen_active(disp));
+    lv_label_set_text(label, "1234");
+    lv_obj_center(label);
+    refresh();
+
+    /*E.g. the display controller was reset, so the whole screen is invalidated to restore it*/
+    lv_memzero(screen_px, sizeof(screen_px));
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(DISP_VER_RES, flushed_rows);
+    assert_screen_matches_rendering();
+}
+
+void test_display_flush_diff_rotation_flushes_everything(void)
+{
+    lv_obj_t * label = lv_label_create(lv_display_get_screen_active(disp));
+    lv_label_set_text(label, "1234");
+    lv_obj_center(label);
+    refresh();
+
+    lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_180);
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(DISP_VER_RES, flushed_rows);
+}
+
+void test_display_flush_diff_disabled(void)
+{
+    lv_display_set_flush_diff(disp, false);
+    TEST_ASSERT_FALSE(lv_display_get_flush_diff(disp));
+
+    refresh();
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    refresh();
+    TEST_ASSERT_EQUAL_UINT32(DISP_VER_RES, flushed_rows);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_display_flush_diff_flushes_everything_first(void)
+{
+}
+
+void test_display_flush_diff_skips_unchanged_areas(void)
+{
+}
+
+void test_display_flush_diff_flushes_only_changed_rows(void)
+{
+}
+
+void test_display_flush_diff_full_invalidation_flushes_everything(void)
+{
+}
+
+void test_display_flush_diff_rotation_flushes_everything(void)
+{
+}
+
+void test_display_flush_diff_disabled(void)
+{
+}
+
+#endif /*LV_USE_DISPLAY_FLUSH_DIFF*/
+
+#endif
@@ -0,0 +1,315 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define LOOKUP_MEM_SIZE     (128 * 1024)
+
+/*A font with all kinds of overlapping character maps and kern pairs*/
+static const lv_font_fmt_txt_glyph_dsc_t mixed_glyph_dsc[40] = {
+    [1] = {.adv_w = 1 * 16}, [2] = {.adv_w = 2 * 16}, [3] = {.adv_w = 3 * 16}, [4] = {.adv_w = 4 * 16},
+    [5] = {.adv_w = 5 * 16}, [6] = {.adv_w = 6 * 16}, [7] = {.adv_w = 7 * 16}, [8] = {.adv_w = 8 * 16},
+    [9] = {.adv_w = 9 * 16}, [10] = {.adv_w = 10 * 16}, [11] = {.adv_w = 11 * 16}, [12] = {.adv_w = 12 * 16},
+    [20] = {.adv_w = 20 * 16}, [21] = {.adv_w = 21 * 16}, [22] = {.adv_w = 22 * 16}, [23] = {.adv_w = 23 * 16},
+    [24] = {.adv_w = 24 * 16}, [25] = {.adv_w = 25 * 16},
+    [30] = {.adv_w = 30 * 16}, [31] = {.adv_w = 31 * 16}, [32] = {.adv_w = 32 * 16}, [33] = {.adv_w = 33 * 16},
+};
+
+/*'A'..'H' with 'C' and 'F' missing*/
+static const uint8_t mixed_full_ofs[] = {0, 1, 0, 2, 3, 0, 4, 5};
+
+/*'@', 'A', '`', 'a', 0x140, 0x33F*/
+static const uint16_t mixed_sparse_tiny_list[] = {0x0, 0x1, 0x20, 0x21, 0x100, 0x2FF};
+
+/*0x4E00, 0x4E01, 0x4FFF, 0x12400 (not in the BMP)*/
+static const uint16_t mixed_sparse_full_list[] = {0x0, 0x1, 0x1FF, 0xD600};
+static const uint16_t mixed_sparse_full_ofs[] = {0, 1, 2, 3};
+
+static const lv_font_fmt_txt_cmap_t mixed_cmaps[] = {
+    {
+        .range_start = 'A', .range_length = 8, .glyph_id_start = 1,
+        .glyph_id_ofs_list = mixed_full_ofs, .list_length = 8, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    },
+    {
+        .range_start = '0', .range_length = 12, .glyph_id_start = 1,
+        .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = '@', .range_length = 0x300, .glyph_id_start = 20,
+        .unicode_list = mixed_sparse_tiny_list, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 0x4E00, .range_length = 0xD601, .glyph_id_start = 30,
+        .unicode_list = mixed_sparse_full_list, .glyph_id_ofs_list = mixed_sparse_full_ofs, .list_length = 4,
+        .type = LV_FONT_FMT_TXT_CMAP_SPARSE_FULL
+    },
+};
+
+/*Ordered by the left, then the right glyph ID*/
+static const uint8_t mixed_kern_ids[] = {1, 2, 1, 20, 2, 2, 5, 31, 20, 1, 20, 33, 31, 5};
+static const int8_t mixed_kern_values[] = {-1, 3, -2, 11, -1, 9, -13};
+
+static const lv_font_fmt_txt_kern_pair_t mixed_kern_pairs = {
+    .glyph_ids = mixed_kern_ids,
+    .values = mixed_kern_values,
+    .pair_cnt = 7,
+    .glyph_ids_size = 0,
+};
+
+static const uint16_t mixed_kern_ids_16[] = {1, 2, 1, 20, 2, 2, 5, 31, 20, 1, 20, 33, 31, 5};
+
+static const lv_font_fmt_txt_kern_pair_t mixed_kern_pairs_16 = {
+    .glyph_ids = mixed_kern_ids_16,
+    .values = mixed_kern_values,
+    .pair_cnt = 7,
+    .glyph_ids_size = 1,
+};
+
+static lv_font_fmt_txt_dsc_t mixed_font_dsc = {
+    .glyph_dsc = mixed_glyph_dsc,
+    .cmaps = mixed_cmaps,
+    .cmap_num = 4,
+    .kern_dsc = &mixed_kern_pairs,
+    .kern_scale = 256,
+    .kern_classes = 0,
+    .bpp = 1,
+};
+
+static lv_font_t mixed_font = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 10,
+    .dsc = &mixed_font_dsc,
+};
+
+static bool get_glyph(const lv_font_t * font, uint32_t letter, uint32_t letter_next, lv_font_glyph_dsc_t * dsc)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    return lv_font_get_glyph_dsc_fmt_txt(font, dsc, letter, letter_next);
+}
+
+/*Compare the glyphs of all BMP code points with and without the lookup tables*/
+static void assert_same_glyphs(const lv_font_t * font)
+{
+    uint32_t letter_cnt = 0x10001;
+    uint32_t * ref_gid = lv_malloc(letter_cnt * sizeof(uint32_t));
+    TEST_ASSERT_NOT_NULL(ref_gid);
+
+    lv_font_glyph_dsc_t dsc;
+    uint32_t letter;
+    lv_font_fmt_txt_lookup_set_mem_budget(0);
+    for(letter = 0; letter < letter_cnt; letter++) {
+        ref_gid[letter] = get_glyph(font, letter, 0, &dsc) ? dsc.gid.index : 0;
+    }
+
+    lv_font_fmt_txt_lookup_set_mem_budget(LOOKUP_MEM_SIZE);
+    for(letter = 0; letter < letter_cnt; letter++) {
+        uint32_t gid = get_glyph(font, letter, 0, &dsc) ? dsc.gid.index : 0;
+        TEST_ASSERT_EQUAL_UINT32(ref_gid[letter], gid);
+    }
+
+    lv_free(ref_gid);
+}
+
+/*Compare the advance widths with kerning of all pairs of some letters with and without the lookup tables*/
+static void assert_same_kerning(const lv_font_t * font, const uint32_t * letters, uint32_t letter_cnt)
+{
+    lv_font_glyph_dsc_t dsc;
+
+    uint32_t * ref_adv_w = lv_malloc(letter_cnt * letter_cnt * sizeof(uint32_t));
+    TEST_ASSERT_NOT_NULL(ref_adv_w);
+
+    lv_font_fmt_txt_lookup_set_mem_budget(0);
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < letter_cnt; i++) {
+        for(j = 0; j < letter_cnt; j++) {
+            get_glyph(font, letters[i], letters[j], &dsc);
+            ref_adv_w[i * letter_cnt + j] = dsc.adv_w;
+        }
+    }
+
+    lv_font_fmt_txt_lookup_set_mem_budget(LOOKUP_MEM_SIZE);
+    for(i = 0; i < letter_cnt; i++) {
+        for(j = 0; j < letter_cnt; j++) {
+            get_glyph(font, letters[i], letters[j], &dsc);
+            TEST_ASSERT_EQUAL_UINT32(ref_adv_w[i * letter_cnt + j], dsc.adv_w);
+        }
+    }
+
+    lv_free(ref_adv_w);
+}
+
+static void assert_same_ascii_kerning(const lv_font_t * font)
+{
+    uint32_t letters[128 - 32];
+    uint32_t i;
+    for(i = 0; i < 128 - 32; i++) letters[i] = i + 32;
+
+    assert_same_kerning(font, letters, 128 - 32);
+}
+
+void setUp(void)
+{
+    lv_font_fmt_txt_lookup_set_mem_budget(LOOKUP_MEM_SIZE);
+}
+
+void tearDown(void)
+{
+    mixed_font_dsc.kern_dsc = &mixed_kern_pairs;
+    lv_font_fmt_txt_lookup_set_mem_budget(LV_FONT_FMT_TXT_LOOKUP_MEM_SIZE);
+}
+
+void test_font_fmt_txt_lookup_mixed_cmaps(void)
+{
+    lv_font_glyph_dsc_t dsc;
+
+    /*The first character map containing the code point is used,
+     *or the next one for the missing characters of a full format 0 map*/
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, 'A', 0, &dsc));
+    TEST_ASSERT_EQUAL_UINT32(1, dsc.gid.index);
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, '@', 0, &dsc));
+    TEST_ASSERT_EQUAL_UINT32(20, dsc.gid.index);
+    TEST_ASSERT_FALSE(get_glyph(&mixed_font, 'C', 0, &dsc));
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, '0' + 11, 0, &dsc));
+    TEST_ASSERT_EQUAL_UINT32(12, dsc.gid.index);
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, 0x33F, 0, &dsc));
+    TEST_ASSERT_EQUAL_UINT32(25, dsc.gid.index);
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, 0x4FFF, 0, &dsc));
+    TEST_ASSERT_EQUAL_UINT32(32, dsc.gid.index);
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, 0x12400, 0, &dsc));
+    TEST_ASSERT_EQUAL_UINT32(33, dsc.gid.index);
+
+    assert_same_glyphs(&mixed_font);
+}
+
+void test_font_fmt_txt_lookup_builtin_fonts(void)
+{
+    assert_same_glyphs(&lv_font_montserrat_14);
+    assert_same_glyphs(&lv_font_source_han_sans_sc_16_cjk);
+    assert_same_glyphs(&lv_font_dejavu_16_persian_hebrew);
+    assert_same_glyphs(&lv_font_unscii_8);
+}
+
+void test_font_fmt_txt_lookup_kerning(void)
+{
+    const uint32_t letters[] = {'0', '1', '5', '9', 'A', 'B', 'D', 'E', '@', '`', 'a', 0x4E01, 0x4FFF, 0x12400, 'C', 'x'};
+    uint32_t letter_cnt = sizeof(letters) / sizeof(letters[0]);
+
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, '0', '@', &dsc));
+    TEST_ASSERT_EQUAL_UINT32(1 + 3, dsc.adv_w);
+
+    assert_same_kerning(&mixed_font, letters, letter_cnt);
+    mixed_font_dsc.kern_dsc = &mixed_kern_pairs_16;
+    lv_font_fmt_txt_lookup_set_mem_budget(0);
+    assert_same_kerning(&mixed_font, letters, letter_cnt);
+
+    /*Kern classes*/
+    assert_same_ascii_kerning(&lv_font_montserrat_14);
+}
+
+void test_font_fmt_txt_lookup_mem_budget(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &lv_font_source_han_sans_sc_16_cjk, 0);
+    lv_label_set_text(label, "二氧化碳浓度 1234 ppm, 温度 23.5°C, 湿度 45%");
+
+    lv_font_fmt_txt_lookup_set_mem_budget(LOOKUP_MEM_SIZE);
+    lv_refr_now(NULL);
+    uint32_t mem_size = lv_font_fmt_txt_lookup_get_mem_size();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, mem_size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LOOKUP_MEM_SIZE, mem_size);
+    lv_draw_buf_t * ref_buf = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+
+    /*Only some pages fit, the others are searched*/
+    uint32_t budget = mem_size / 2;
+    lv_font_fmt_txt_lookup_set_mem_budget(budget);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_font_fmt_txt_lookup_get_mem_size());
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_font_fmt_txt_lookup_get_mem_size());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(budget, lv_font_fmt_txt_lookup_get_mem_size());
+
+    lv_draw_buf_t * buf = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf->data, buf->data, ref_buf->header.stride * ref_buf->header.h);
+    lv_draw_buf_destroy(ref_buf);
+    lv_draw_buf_destroy(buf);
+
+    /*Even the kerning matrix might not fit*/
+    budget = sizeof(lv_font_fmt_txt_lookup_t) + 2 * 64;
+    lv_font_fmt_txt_lookup_set_mem_budget(budget);
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, '0', '@', &dsc));
+    TEST_ASSERT_EQUAL_UINT32(1 + 3, dsc.adv_w);
+    TEST_ASSERT_TRUE(get_glyph(&mixed_font, 0x4E01, 'G', &dsc));
+    TEST_ASSERT_EQUAL_UINT32(31 - 13, dsc.adv_w);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(budget, lv_font_fmt_txt_lookup_get_mem_size());
+
+    lv_obj_delete(label);
+}
+
+void test_font_fmt_txt_lookup_binfont_destroy(void)
+{
+    uint32_t mem_size_start = lv_font_fmt_txt_lookup_get_mem_size();
+
+    lv_font_t * font = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+    TEST_ASSERT_NOT_NULL(font);
+
+    assert_same_glyphs(font);
+    assert_same_ascii_kerning(font);
+    TEST_ASSERT_GREATER_THAN_UINT32(mem_size_start, lv_font_fmt_txt_lookup_get_mem_size());
+
+    lv_binfont_destroy(font);
+    TEST_ASSERT_EQUAL_UINT32(mem_size_start, lv_font_fmt_txt_lookup_get_mem_size());
+}
+
+static uint32_t measure_text(const lv_font_t * font, const char * text)
+{
+    lv_point_t size;
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        lv_text_get_size(&size, text, font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+}
+
+void test_font_fmt_txt_lookup_benchmark(void)
+{
+    /*Wrapping long texts of different scripts*/
+    const lv_font_t * fonts[] = {&lv_font_montserrat_14, &lv_font_source_han_sans_sc_16_cjk, &lv_font_dejavu_16_persian_hebrew};
+    const char * texts[] = {
+        "The CO2 concentration is 1234 ppm. Open the window to let some fresh air in. "
+        "Temperature: 23.5 C, humidity: 45 %, pressure: 1013 hPa. The quick brown fox jumps over the lazy dog.",
+
+        "室内二氧化碳浓度为一千二百三十四，请打开窗户通风换气。温度二十三点五度，湿度百分之四十五。"
+        "空气质量良好时指示灯为绿色，浓度过高时为红色并发出提示音。传感器每五秒测量一次并更新显示。",
+
+        "ריכוז הפחמן הדו חמצני הוא 1234 חלקים למיליון. פתחו את החלון כדי להכניס אוויר צח. "
+        "غلظت دی اکسید کربن ۱۲۳۴ است. پنجره را باز کنید تا هوای تازه وارد شود.",
+    };
+
+    uint32_t f;
+    for(f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        lv_font_fmt_txt_lookup_set_mem_budget(0);
+        uint32_t time_search = measure_text(fonts[f], texts[f]);
+
+        /*The first run builds the tables*/
+        lv_font_fmt_txt_lookup_set_mem_budget(LOOKUP_MEM_SIZE);
+        measure_text(fonts[f], texts[f]);
+        uint32_t time_lookup = measure_text(fonts[f], texts[f]);
+
+        TEST_PRINTF("font %d: %d us with searching, %d us with lookup tables of %d bytes",
+                    (int)f, (int)time_search, (int)time_lookup, (int)lv_font_fmt_txt_lookup_get_mem_size());
+    }
+}
+
+#endif
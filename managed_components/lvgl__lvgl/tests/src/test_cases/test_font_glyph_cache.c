@@ -0,0 +1,186 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define glyph_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache
+
+LV_FONT_DECLARE(test_font_montserrat_ascii_1bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_3bpp_compressed)
+LV_FONT_DECLARE(test_font_montserrat_ascii_8bpp)
+
+static lv_obj_t * label;
+
+static void get_stats(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    lv_font_fmt_txt_glyph_cache_get_stats(hit_cnt, miss_cnt);
+}
+
+static lv_draw_buf_t * render(const lv_font_t * font, uint32_t cache_size)
+{
+    lv_font_fmt_txt_glyph_cache_resize(cache_size);
+    lv_font_fmt_txt_glyph_cache_drop();
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_draw_buf_t * draw_buf = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    return draw_buf;
+}
+
+static void assert_same_rendering(const lv_font_t * font, uint32_t cache_size)
+{
+    lv_draw_buf_t * ref_buf = render(font, 0);
+    lv_draw_buf_t * buf = render(font, cache_size);
+
+    uint32_t size = ref_buf->header.stride * ref_buf->header.h;
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf->data, buf->data, size);
+
+    lv_draw_buf_destroy(ref_buf);
+    lv_draw_buf_destroy(buf);
+}
+
+void setUp(void)
+{
+    label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "0123456789 ppm");
+    lv_obj_center(label);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_font_fmt_txt_glyph_cache_resize(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+    lv_font_fmt_txt_glyph_cache_drop();
+}
+
+void test_font_glyph_cache_hit_and_miss(void)
+{
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label, "1221");
+    lv_font_fmt_txt_glyph_cache_resize(256 * 1024);
+    lv_font_fmt_txt_glyph_cache_drop();
+
+    uint32_t hit_start;
+    uint32_t miss_start;
+    get_stats(&hit_start, &miss_start);
+
+    /*Both glyphs are converted once and drawn again from the cache.
+     *(A glyph can be drawn more times if the label is rendered in parts)*/
+    lv_refr_now(NULL);
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+    get_stats(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, miss_cnt - miss_start);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, hit_cnt - hit_start);
+    uint32_t hit_first = hit_cnt - hit_start;
+
+    /*Everything is cached now*/
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    get_stats(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, miss_cnt - miss_start);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(hit_first + 4, hit_cnt - hit_start);
+
+    /*Nothing is used from the cache while rendering, so everything can be dropped*/
+    TEST_ASSERT_NOT_EQUAL(0, lv_cache_get_size(glyph_cache.cache, NULL));
+    lv_font_fmt_txt_glyph_cache_drop();
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(glyph_cache.cache, NULL));
+}
+
+void test_font_glyph_cache_size_limit(void)
+{
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label, "0123456789");
+
+    /*Not enough for all glyphs*/
+    uint32_t cache_size = 2 * 1024;
+    lv_font_fmt_txt_glyph_cache_resize(cache_size);
+    lv_font_fmt_txt_glyph_cache_drop();
+
+    uint32_t hit_start;
+    uint32_t miss_start;
+    get_stats(&hit_start, &miss_start);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(cache_size, lv_cache_get_size(glyph_cache.cache, NULL));
+
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+    get_stats(&hit_cnt, &miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(10, miss_cnt - miss_start);
+
+    /*Glyphs larger than the whole cache are still drawn*/
+    lv_font_fmt_txt_glyph_cache_resize(64);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(64, lv_cache_get_size(glyph_cache.cache, NULL));
+    assert_same_rendering(&lv_font_montserrat_28_compressed, 64);
+}
+
+void test_font_glyph_cache_same_rendering(void)
+{
+    assert_same_rendering(&test_font_montserrat_ascii_1bpp, 256 * 1024);
+    assert_same_rendering(&test_font_montserrat_ascii_4bpp, 256 * 1024);
+    assert_same_rendering(&test_font_montserrat_ascii_3bpp_compressed, 256 * 1024);
+    assert_same_rendering(&test_font_montserrat_ascii_8bpp, 256 * 1024);
+    assert_same_rendering(&lv_font_montserrat_28_compressed, 256 * 1024);
+}
+
+void test_font_glyph_cache_binfont_destroy(void)
+{
+    lv_font_t * font = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+    TEST_ASSERT_NOT_NULL(font);
+    lv_font_fmt_txt_glyph_cache_resize(256 * 1024);
+
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_EQUAL(0, lv_cache_get_size(glyph_cache.cache, NULL));
+
+    lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+    lv_binfont_destroy(font);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(glyph_cache.cache, NULL));
+}
+
+void test_font_glyph_cache_benchmark(void)
+{
+    /*Large digits updated in every frame like on a measurement display*/
+    const lv_font_t * fonts[] = {&lv_font_montserrat_28_compressed, &test_font_montserrat_ascii_3bpp_compressed};
+
+    uint32_t f;
+    for(f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        lv_obj_set_style_text_font(label, fonts[f], 0);
+        uint32_t time_us[2];
+        uint32_t c;
+        for(c = 0; c < 2; c++) {
+            lv_font_fmt_txt_glyph_cache_resize(c == 0 ? 0 : 256 * 1024);
+            lv_font_fmt_txt_glyph_cache_drop();
+
+            uint32_t hit_start;
+            uint32_t miss_start;
+            get_stats(&hit_start, &miss_start);
+
+            struct timespec start;
+            struct timespec end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            uint32_t i;
+            for(i = 0; i < 50; i++) {
+                lv_label_set_text_fmt(label, "%d ppm", (int)(400 + (i * 37) % 1600));
+                lv_refr_now(NULL);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            time_us[c] = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+
+            uint32_t hit_cnt;
+            uint32_t miss_cnt;
+            get_stats(&hit_cnt, &miss_cnt);
+            if(c == 1) {
+                TEST_PRINTF("font %d: %d us without cache, %d us with cache, %d hits, %d misses",
+                            (int)f, (int)time_us[0], (int)time_us[1],
+                            (int)(hit_cnt - hit_start), (int)(miss_cnt - miss_start));
+                TEST_ASSERT_GREATER_THAN_UINT32(miss_cnt - miss_start, hit_cnt - hit_start);
+            }
+        }
+    }
+}
+
+#endif
@@ -66,6 +66,34 @@ void test_read(void)
     }
 }
 
+void test_map(void)
+{
+    /*'B' (POSIX) can map files, the content stays mapped after closing the file*/
+    lv_fs_file_t f;
+    lv_fs_res_t res = lv_fs_open(&f, "B:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    const void * buf;
+    uint32_t size;
+    res = lv_fs_map(&f, &buf, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    lv_fs_drv_t * drv = f.drv;
+    lv_fs_close(&f);
+
+    TEST_ASSERT_EQUAL_UINT32(745, size); /*With a trailing new line*/
+    TEST_ASSERT_EQUAL_MEMORY(read_exp, buf, strlen(read_exp));
+    lv_fs_unmap(drv, buf, size);
+
+    /*'A' (STDIO) can't*/
+    res = lv_fs_open(&f, "A:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_map(&f, &buf, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, res);
+    TEST_ASSERT_NULL(buf);
+    TEST_ASSERT_EQUAL_UINT32(0, size);
+    lv_fs_close(&f);
+}
+
 void test_read_random(void)
 {
     read_random_drv('A', 8);
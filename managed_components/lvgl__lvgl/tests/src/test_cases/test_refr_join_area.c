@@ -0,0 +1,334 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define DISP_HOR_RES    400
+#define DISP_VER_RES    240
+
+/*A full screen buffer so that every joined area is flushed at once*/
+#define DISP_BUF_SIZE   (DISP_VER_RES * (DISP_HOR_RES * 2 + 256) + LV_DRAW_BUF_ALIGN)
+
+#define TRACE_FRAME_CNT     24
+#define TRACE_AREA_MAX      128
+
+/*Per-flush overhead used by the benchmark, in pixels*/
+#define BENCH_AREA_COST     2000
+
+typedef struct {
+    lv_area_t areas[TRACE_AREA_MAX];
+    uint32_t area_cnt;
+} trace_frame_t;
+
+typedef struct {
+    uint32_t flush_cnt;
+    uint32_t flushed_px;
+    uint32_t time_us;
+} replay_result_t;
+
+static lv_display_t * disp;
+static LV_ATTRIBUTE_MEM_ALIGN uint8_t disp_buf[DISP_BUF_SIZE];
+
+static trace_frame_t trace[TRACE_FRAME_CNT];
+static trace_frame_t * trace_act;
+
+/*Pixels invalidated and flushed in the current frame*/
+static uint8_t inv_map[DISP_VER_RES][DISP_HOR_RES];
+static uint8_t flushed_map[DISP_VER_RES][DISP_HOR_RES];
+static uint32_t flush_cnt;
+static uint32_t flushed_px;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(px_map);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memset(&flushed_map[y][area->x1], 1, lv_area_get_width(area));
+    }
+
+    flush_cnt++;
+    flushed_px += lv_area_get_size(area);
+    lv_display_flush_ready(d);
+}
+
+static void record_event_cb(lv_event_t * e)
+{
+    if(trace_act == NULL || trace_act->area_cnt >= TRACE_AREA_MAX) return;
+
+    const lv_area_t * area = lv_event_get_param(e);
+    trace_act->areas[trace_act->area_cnt] = *area;
+    trace_act->area_cnt++;
+}
+
+/*Every frame of the trace is recorded from the invalidations between two refreshes*/
+static void record_start(void)
+{
+    lv_memzero(trace, sizeof(trace));
+    lv_refr_now(disp);
+    trace_act = &trace[0];
+    lv_display_add_event_cb(disp, record_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+}
+
+static void record_frame_end(uint32_t frame)
+{
+    /*The layout is updated in the refresh which can invalidate more areas*/
+    lv_refr_now(disp);
+    trace_act = frame + 1 < TRACE_FRAME_CNT ? &trace[frame + 1] : NULL;
+}
+
+static void record_finish(void)
+{
+    trace_act = NULL;
+    lv_display_remove_event_cb_with_user_data(disp, record_event_cb, NULL);
+}
+
+static void check_coverage(void)
+{
+    int32_t y;
+    int32_t x;
+    for(y = 0; y < DISP_VER_RES; y++) {
+        for(x = 0; x < DISP_HOR_RES; x++) {
+            if(inv_map[y][x] && !flushed_map[y][x]) {
+                TEST_FAIL_MESSAGE("An invalidated pixel was not flushed");
+            }
+        }
+    }
+}
+
+/*Invalidate the areas of each frame again and refresh the display with the given costs*/
+static replay_result_t replay(uint32_t px_cost, uint32_t area_cost)
+{
+    lv_display_set_refr_cost(disp, px_cost, area_cost);
+
+    replay_result_t res = {0};
+    uint32_t frame;
+    for(frame = 0; frame < TRACE_FRAME_CNT; frame++) {
+        lv_memzero(inv_map, sizeof(inv_map));
+        lv_memzero(flushed_map, sizeof(flushed_map));
+        flush_cnt = 0;
+        flushed_px = 0;
+
+        uint32_t i;
+        for(i = 0; i < trace[frame].area_cnt; i++) {
+            const lv_area_t * a = &trace[frame].areas[i];
+            int32_t y;
+            for(y = a->y1; y <= a->y2; y++) lv_memset(&inv_map[y][a->x1], 1, lv_area_get_width(a));
+            lv_inv_area(disp, a);
+        }
+
+        struct timespec start;
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        lv_refr_now(disp);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        check_coverage();
+        res.flush_cnt += flush_cnt;
+        res.flushed_px += flushed_px;
+        res.time_us += (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+    }
+
+    return res;
+}
+
+static void replay_and_compare(const char * name)
+{
+    replay_result_t legacy = replay(1, 0);
+    replay_result_t costed = replay(1, BENCH_AREA_COST);
+
+    uint32_t legacy_cost = legacy.flushed_px + legacy.flush_cnt * BENCH_AREA_COST;
+    uint32_t costed_cost = costed.flushed_px + costed.flush_cnt * BENCH_AREA_COST;
+    TEST_PRINTF("%s: no area cost: %d flushes, %d px, %d us; area cost %d: %d flushes, %d px, %d us",
+                name, (int)legacy.flush_cnt, (int)legacy.flushed_px, (int)legacy.time_us,
+                BENCH_AREA_COST, (int)costed.flush_cnt, (int)costed.flushed_px, (int)costed.time_us);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(legacy_cost, costed_cost);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(legacy.flush_cnt, costed.flush_cnt);
+}
+
+/*Pseudo random numbers to get the same trace every time*/
+static uint32_t next_rand(uint32_t * seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+void setUp(void)
+{
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    uint32_t buf_size = DISP_VER_RES * lv_draw_buf_width_to_stride(DISP_HOR_RES, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(disp_buf, LV_COLOR_FORMAT_RGB565), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+}
+
+void test_refr_join_area_default_cost(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(1, lv_display_get_refr_px_cost(disp));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_refr_area_cost(disp));
+
+    lv_display_set_refr_cost(disp, 2, 300);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_display_get_refr_px_cost(disp));
+    TEST_ASSERT_EQUAL_UINT32(300, lv_display_get_refr_area_cost(disp));
+}
+
+void test_refr_join_area_by_cost(void)
+{
+    /*Two 10x10 areas with a 5 px gap: joining them adds 50 pixels*/
+    lv_area_t a1 = {10, 10, 19, 19};
+    lv_area_t a2 = {25, 10, 34, 19};
+
+    lv_refr_now(disp);
+    flush_cnt = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+
+    lv_display_set_refr_cost(disp, 1, 49);
+    flush_cnt = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+
+    lv_display_set_refr_cost(disp, 1, 51);
+    flush_cnt = 0;
+    flushed_px = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(250, flushed_px);
+
+    /*Overlapping areas are joined without area cost too if the joined area is smaller*/
+    lv_display_set_refr_cost(disp, 1, 0);
+    lv_area_t a3 = {15, 10, 29, 19};
+    flush_cnt = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a3);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+}
+
+void test_refr_join_area_overflow_is_not_full_screen(void)
+{
+    lv_refr_now(disp);
+
+    /*Twice as many small areas as the buffer can hold, in two clusters*/
+    lv_memzero(inv_map, sizeof(inv_map));
+    lv_memzero(flushed_map, sizeof(flushed_map));
+    uint32_t i;
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        int32_t x = (i % 8) * 12 + (i & 1 ? 250 : 0);
+        int32_t y = (i / 8) * 12;
+        lv_area_t a = {x, y, x + 7, y + 7};
+        int32_t row;
+        for(row = a.y1; row <= a.y2; row++) lv_memset(&inv_map[row][a.x1], 1, lv_area_get_width(&a));
+        lv_inv_area(disp, &a);
+    }
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE, disp->inv_p);
+
+    flush_cnt = 0;
+    flushed_px = 0;
+    lv_refr_now(disp);
+    check_coverage();
+    TEST_ASSERT_GREATER_THAN_UINT32(1, flush_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(DISP_HOR_RES * DISP_VER_RES / 2, flushed_px);
+}
+
+void test_refr_join_area_bench_dashboard(void)
+{
+    /*A few readouts, a bar and a chart updated periodically*/
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * labels[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        labels[i] = lv_label_create(scr);
+        lv_obj_set_pos(labels[i], 10 + i * 130, 10);
+    }
+
+    lv_obj_t * bar = lv_bar_create(scr);
+    lv_obj_set_size(bar, 380, 12);
+    lv_obj_set_pos(bar, 10, 50);
+
+    lv_obj_t * chart = lv_chart_create(scr);
+    lv_obj_set_size(chart, 380, 150);
+    lv_obj_set_pos(chart, 10, 80);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t seed = 1;
+    record_start();
+    for(i = 0; i < TRACE_FRAME_CNT; i++) {
+        lv_label_set_text_fmt(labels[0], "%d ppm", (int)(400 + next_rand(&seed) % 600));
+        if(i % 2 == 0) lv_label_set_text_fmt(labels[1], "%d.%d C", 20 + (int)(i / 8), (int)(i % 10));
+        if(i % 3 == 0) lv_label_set_text_fmt(labels[2], "%d %%", 40 + (int)(next_rand(&seed) % 20));
+        lv_bar_set_value(bar, (int32_t)(next_rand(&seed) % 100), LV_ANIM_OFF);
+        lv_chart_set_next_value(chart, ser, (int32_t)(next_rand(&seed) % 100));
+        record_frame_end(i);
+    }
+    record_finish();
+
+    replay_and_compare("dashboard");
+}
+
+void test_refr_join_area_bench_scattered(void)
+{
+    /*Many small indicators changing at random places: more areas than LV_INV_BUF_SIZE*/
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * leds[96];
+    uint32_t i;
+    for(i = 0; i < 96; i++) {
+        leds[i] = lv_led_create(scr);
+        lv_obj_set_size(leds[i], 14, 14);
+        lv_obj_set_pos(leds[i], 8 + (i % 12) * 32, 8 + (i / 12) * 29);
+    }
+
+    uint32_t seed = 2;
+    record_start();
+    for(i = 0; i < TRACE_FRAME_CNT; i++) {
+        uint32_t cnt = 4 + next_rand(&seed) % 40;
+        uint32_t j;
+        for(j = 0; j < cnt; j++) lv_led_toggle(leds[next_rand(&seed) % 96]);
+        record_frame_end(i);
+    }
+    record_finish();
+
+    replay_and_compare("scattered");
+}
+
+void test_refr_join_area_bench_scroll(void)
+{
+    /*A list scrolled a little in every frame and a clock label*/
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * list = lv_list_create(scr);
+    lv_obj_set_size(list, 200, 200);
+    lv_obj_set_pos(list, 10, 30);
+    lv_obj_set_scrollbar_mode(list, LV_SCROLLBAR_MODE_OFF);
+    uint32_t i;
+    for(i = 0; i < 30; i++) lv_list_add_button(list, NULL, "Item");
+
+    lv_obj_t * label = lv_label_create(scr);
+    lv_obj_set_pos(label, 300, 5);
+
+    record_start();
+    for(i = 0; i < TRACE_FRAME_CNT; i++) {
+        lv_obj_scroll_by(list, 0, -7, LV_ANIM_OFF);
+        lv_label_set_text_fmt(label, "12:%02d", (int)i);
+        record_frame_end(i);
+    }
+    record_finish();
+
+    replay_and_compare("scroll");
+}
+
+#endif
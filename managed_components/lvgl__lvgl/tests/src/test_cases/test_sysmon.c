@@ -0,0 +1,135 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_PERF_MONITOR
+
+static lv_display_t * disp;
+static lv_sysmon_perf_info_t perf_info;
+
+static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    LV_UNUSED(observer);
+    perf_info = *(const lv_sysmon_perf_info_t *)lv_subject_get_pointer(subject);
+}
+
+static void send(lv_event_code_t code, uint32_t ms_after)
+{
+    lv_display_send_event(disp, code, NULL);
+    lv_tick_inc(ms_after);
+}
+
+/*Simulate calling a flush_cb which takes `ms` and returns while the flush is still in progress or not*/
+static void flush(uint32_t ms, bool in_progress_after)
+{
+    disp->flushing = 1;
+    send(LV_EVENT_FLUSH_START, ms);
+    disp->flushing = in_progress_after;
+    send(LV_EVENT_FLUSH_FINISH, 0);
+}
+
+/*Simulate waiting for the previous flush to finish in `ms`*/
+static void flush_wait(uint32_t ms)
+{
+    send(LV_EVENT_FLUSH_WAIT_START, ms);
+    disp->flushing = 0;
+    send(LV_EVENT_FLUSH_WAIT_FINISH, 0);
+}
+
+void setUp(void)
+{
+    disp = lv_display_create(100, 100);
+    lv_sysmon_performance_pause(disp);
+    lv_subject_add_observer(&disp->perf_sysmon_backend.subject, perf_observer_cb, NULL);
+
+    /*Start with a clean state*/
+    lv_sysmon_performance_dump(disp);
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+}
+
+void test_sysmon_flush_overlap_is_zero_with_blocking_flush(void)
+{
+    send(LV_EVENT_RENDER_START, 10);
+    flush(5, false);
+    send(LV_EVENT_RENDER_READY, 0);
+
+    lv_sysmon_performance_dump(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, perf_info.measured.render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(10, perf_info.calculated.render_avg_time);
+    TEST_ASSERT_EQUAL_UINT32(5, perf_info.calculated.flush_avg_time);
+    TEST_ASSERT_EQUAL_UINT32(0, perf_info.calculated.flush_overlap);
+}
+
+void test_sysmon_flush_overlap_with_pipelined_flush(void)
+{
+    /*Render 3 areas while the previous one is flushed*/
+    send(LV_EVENT_RENDER_START, 10);
+    flush(1, true);
+    lv_tick_inc(6);         /*Render area 2: 6 ms overlap*/
+    flush_wait(3);
+    flush(1, true);
+    lv_tick_inc(8);         /*Render area 3: 8 ms overlap*/
+    flush_wait(0);
+    flush(1, true);
+    send(LV_EVENT_RENDER_READY, 50);
+
+    /*Idle time between the refreshes shouldn't count as overlap*/
+    send(LV_EVENT_RENDER_START, 4);
+    flush_wait(0);          /*4 ms overlap*/
+    flush(1, false);
+    send(LV_EVENT_RENDER_READY, 0);
+
+    /*18 ms overlap, 7 ms blocked*/
+    lv_sysmon_performance_dump(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, perf_info.measured.render_cnt);
+    TEST_ASSERT_EQUAL_UINT32(18 * 100 / (18 + 7), perf_info.calculated.flush_overlap);
+}
+
+void test_sysmon_flush_in_progress_is_kept_between_reports(void)
+{
+    send(LV_EVENT_RENDER_START, 10);
+    flush(2, true);
+    send(LV_EVENT_RENDER_READY, 0);
+
+    lv_sysmon_performance_dump(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, perf_info.calculated.flush_overlap);
+
+    send(LV_EVENT_RENDER_START, 6);
+    flush_wait(2);
+    send(LV_EVENT_RENDER_READY, 0);
+
+    lv_sysmon_performance_dump(disp);
+    TEST_ASSERT_EQUAL_UINT32(6 * 100 / (6 + 2), perf_info.calculated.flush_overlap);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_sysmon_flush_overlap_is_zero_with_blocking_flush(void)
+{
+}
+
+void test_sysmon_flush_overlap_with_pipelined_flush(void)
+{
+}
+
+void test_sysmon_flush_in_progress_is_kept_between_reports(void)
+{
+}
+
+#endif /*LV_USE_PERF_MONITOR*/
+
+#endif
@@ -0,0 +1,340 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+static uint32_t run_cnt[4];
+static lv_timer_t * other_timer;
+static lv_timer_t * created_timer;
+
+static void count_cb(lv_timer_t * t)
+{
+    uint32_t * cnt = lv_timer_get_user_data(t);
+    (*cnt)++;
+}
+
+static void delete_self_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    lv_timer_delete(t);
+}
+
+static void delete_other_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    if(other_timer) {
+        lv_timer_delete(other_timer);
+        other_timer = NULL;
+    }
+}
+
+static void create_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    if(created_timer == NULL) created_timer = lv_timer_create(count_cb, 0, &run_cnt[3]);
+}
+
+static void pause_self_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    lv_timer_pause(t);
+    lv_timer_resume(t);
+    lv_timer_pause(t);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+/*Pause or resume the timers of LVGL (display refresh, input device read, etc.)*/
+static void pause_other_timers(bool pause, lv_timer_t * t1, lv_timer_t * t2)
+{
+    static lv_timer_t * paused_timers[32];
+    static uint32_t paused_cnt;
+
+    if(pause) {
+        paused_cnt = 0;
+        lv_timer_t * t = lv_timer_get_next(NULL);
+        while(t) {
+            if(t != t1 && t != t2 && !lv_timer_get_paused(t)) {
+                TEST_ASSERT_LESS_THAN_UINT32(32, paused_cnt);
+                paused_timers[paused_cnt++] = t;
+                lv_timer_pause(t);
+            }
+            t = lv_timer_get_next(t);
+        }
+    }
+    else {
+        uint32_t i;
+        for(i = 0; i < paused_cnt; i++) lv_timer_resume(paused_timers[i]);
+        paused_cnt = 0;
+    }
+}
+
+void setUp(void)
+{
+    lv_memzero(run_cnt, sizeof(run_cnt));
+    other_timer = NULL;
+    created_timer = NULL;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_timer_period(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 10, &run_cnt[0]);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 25, &run_cnt[1]);
+
+    lv_test_wait(9);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+    lv_test_wait(1);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    lv_test_wait(40);
+    TEST_ASSERT_EQUAL_UINT32(5, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+
+    /*Runs only once even if much more time elapsed*/
+    lv_test_fast_forward(1000);
+    TEST_ASSERT_EQUAL_UINT32(6, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[1]);
+
+    lv_timer_set_period(t1, 100);
+    lv_test_wait(99);
+    TEST_ASSERT_EQUAL_UINT32(6, run_cnt[0]);
+    lv_test_wait(1);
+    TEST_ASSERT_EQUAL_UINT32(7, run_cnt[0]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+void test_timer_time_until_next(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 1000, &run_cnt[0]);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 3000, &run_cnt[1]);
+
+    lv_tick_inc(100);
+    pause_other_timers(true, t1, t2);
+
+    lv_tick_inc(400);
+    uint32_t time_until_next = lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(500, time_until_next);
+    TEST_ASSERT_EQUAL_UINT32(500, lv_timer_get_time_until_next());
+
+    lv_timer_pause(t1);
+    time_until_next = lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2500, time_until_next);
+
+    lv_timer_resume(t1);
+    lv_tick_inc(500);
+    time_until_next = lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1000, time_until_next);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    pause_other_timers(false, NULL, NULL);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 10, &run_cnt[0]);
+    lv_timer_set_repeat_count(t1, 3);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 10, &run_cnt[1]);
+    lv_timer_set_repeat_count(t2, 2);
+    lv_timer_set_auto_delete(t2, false);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+
+    /*Not deleted but paused*/
+    TEST_ASSERT_TRUE(timer_exists(t2));
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_resume(t2);
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[1]);
+
+    /*The repeat count is over, it's deleted in the next handler call without running*/
+    lv_timer_t * t3 = lv_timer_create(count_cb, 1000, &run_cnt[2]);
+    lv_timer_set_repeat_count(t3, 0);
+    lv_timer_handler();
+    TEST_ASSERT_FALSE(timer_exists(t3));
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[2]);
+
+    lv_timer_delete(t2);
+}
+
+void test_timer_pause_resume(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 10, &run_cnt[0]);
+
+    lv_test_wait(15);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+
+    lv_timer_pause(t1);
+    lv_timer_pause(t1);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t1));
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+
+    /*Resuming doesn't reset the period, so it's ready immediately*/
+    lv_timer_resume(t1);
+    lv_timer_resume(t1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+    lv_test_wait(10);
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt[0]);
+
+    /*Paused and resumed in its own callback*/
+    lv_timer_t * t2 = lv_timer_create(pause_self_cb, 10, &run_cnt[1]);
+    lv_test_wait(50);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+void test_timer_ready_and_reset(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 1000, &run_cnt[0]);
+
+    lv_test_wait(10);
+    lv_timer_ready(t1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+
+    lv_test_wait(900);
+    lv_timer_reset(t1);
+    lv_test_wait(999);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    lv_test_wait(1);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+
+    lv_timer_delete(t1);
+}
+
+static void resume_cb(void * data)
+{
+    uint32_t * cnt = data;
+    (*cnt)++;
+}
+
+void test_timer_resume_cb(void)
+{
+    uint32_t resume_cnt = 0;
+    lv_timer_t * t1 = lv_timer_create(count_cb, 1000, &run_cnt[0]);
+    lv_timer_handler();
+
+    /*A task sleeping until the next timer has to be woken up whenever a timer might be ready earlier*/
+    lv_timer_handler_set_resume_cb(resume_cb, &resume_cnt);
+    lv_timer_ready(t1);
+    TEST_ASSERT_EQUAL_UINT32(1, resume_cnt);
+    lv_timer_set_period(t1, 10);
+    TEST_ASSERT_EQUAL_UINT32(2, resume_cnt);
+    lv_timer_reset(t1);
+    TEST_ASSERT_EQUAL_UINT32(3, resume_cnt);
+    lv_timer_pause(t1);
+    lv_timer_resume(t1);
+    TEST_ASSERT_EQUAL_UINT32(4, resume_cnt);
+
+    lv_timer_handler_set_resume_cb(NULL, NULL);
+    lv_timer_delete(t1);
+}
+
+void test_timer_create_and_delete_in_callback(void)
+{
+    lv_timer_t * t1 = lv_timer_create(delete_self_cb, 10, &run_cnt[0]);
+    lv_timer_t * t2 = lv_timer_create(delete_other_cb, 10, &run_cnt[1]);
+    other_timer = lv_timer_create(count_cb, 10, &run_cnt[2]);
+    lv_timer_t * t3 = lv_timer_create(create_cb, 20, &run_cnt[2]);
+
+    lv_test_wait(10);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+    TEST_ASSERT_NULL(other_timer);
+
+    lv_test_wait(10);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[1]);
+    TEST_ASSERT_NOT_NULL(created_timer);
+
+    /*0 period: runs once in every handler call*/
+    uint32_t created_cnt = run_cnt[3];
+    lv_timer_handler();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(created_cnt + 2, run_cnt[3]);
+
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+    lv_timer_delete(created_timer);
+}
+
+void test_timer_zero_period_does_not_block_others(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 0, &run_cnt[0]);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 0, &run_cnt[1]);
+    lv_timer_t * t3 = lv_timer_create(count_cb, 5, &run_cnt[2]);
+
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL_UINT32(20, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(20, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(4, run_cnt[2]);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_benchmark(void)
+{
+    /*Many timers with long periods, like widgets with blinking cursors, polling, etc.*/
+    uint32_t timer_cnt = 10000;
+    lv_timer_t ** timers = lv_malloc(timer_cnt * sizeof(lv_timer_t *));
+    TEST_ASSERT_NOT_NULL(timers);
+
+    uint32_t i;
+    for(i = 0; i < timer_cnt; i++) {
+        timers[i] = lv_timer_create(count_cb, 1000 + (i * 7919) % 9000, &run_cnt[0]);
+        TEST_ASSERT_NOT_NULL(timers[i]);
+    }
+
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    uint32_t ms;
+    for(ms = 0; ms < 2000; ms++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    uint32_t time_us = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+
+    TEST_PRINTF("%d timers, 2000 handler calls: %d us, %d timer callbacks (%s)",
+                (int)timer_cnt, (int)time_us, (int)run_cnt[0], LV_USE_TIMER_HEAP ? "heap" : "list");
+    TEST_ASSERT_GREATER_THAN_UINT32(0, run_cnt[0]);
+
+    for(i = 0; i < timer_cnt; i++) {
+        lv_timer_delete(timers[i]);
+    }
+    lv_free(timers);
+}
+
+#endif
@@ -115,6 +115,11 @@ void test_line_dash_gap(void)
     static lv_point_precise_t line_points1[3] = { {50, 50}, {250, 50}, {250, 250} };
     static lv_point_precise_t line_points2[3] = { {50, 250}, {50, 50}, {250, 50} };
 
+    /* Tiles would restart the dash patterns at their edges. The reference image was
+     * rendered in one piece. */
+    uint32_t tile_cnt = lv_display_get_tile_cnt(NULL);
+    lv_display_set_tile_cnt(NULL, 1);
+
     lv_obj_t * line1;
     line1 = lv_line_create(lv_screen_active());
     lv_line_set_points(line1, line_points1, 3);
@@ -143,6 +148,8 @@ void test_line_dash_gap(void)
     lv_obj_align(line3, LV_ALIGN_RIGHT_MID, 0, 0);
 
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/line_2.png");
+
+    lv_display_set_tile_cnt(NULL, tile_cnt);
 }
 
 void test_line_point_array_getters_and_setters(void)
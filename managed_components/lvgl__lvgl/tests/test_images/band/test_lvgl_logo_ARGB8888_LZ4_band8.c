@@ -0,0 +1,450 @@
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+#include "lvgl.h"
+#elif defined(LV_LVGL_H_INCLUDE_SYSTEM)
+#include <lvgl.h>
+#elif defined(LV_BUILD_TEST)
+#include "../lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_TEST_LVGL_LOGO_ARGB8888_LZ4_BAND8
+#define LV_ATTRIBUTE_TEST_LVGL_LOGO_ARGB8888_LZ4_BAND8
+#endif
+
+static const
+LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_TEST_LVGL_LOGO_ARGB8888_LZ4_BAND8
+uint8_t test_lvgl_logo_ARGB8888_LZ4_band8_map[] = {
+
+    0x82,0x00,0x00,0x00,0x7f,0x19,0x00,0x00,0xa0,0x41,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x36,0x02,0x00,0x00,0x81,0x09,0x00,0x00,0x8a,0x0f,0x00,0x00,0xa3,0x16,0x00,0x00,
+    0x67,0x19,0x00,0x00,0x4f,0xff,0xff,0xff,0x00,0x04,0x00,0xff,0xff,0xff,0xff,0xd9,
+    0xff,0x09,0x4c,0x6d,0x46,0x00,0x45,0x61,0x40,0x00,0x35,0x3e,0x31,0x1d,0x8b,0x8a,
+    0x88,0x55,0xad,0xab,0xaa,0x5b,0xa0,0xa0,0x9d,0x57,0x04,0x00,0x44,0xfb,0x0c,0x58,
+    0xb0,0xae,0xae,0x5d,0x61,0x64,0x5c,0x46,0x2c,0x3c,0x26,0x02,0x43,0x55,0x3f,0x00,
+    0x45,0x5c,0x41,0x00,0x45,0x5e,0x41,0x00,0x45,0x5d,0x04,0x00,0xf1,0x1b,0x5e,0x42,
+    0x00,0x45,0x5a,0x3f,0x00,0x45,0x56,0x3c,0x00,0x46,0x59,0x3d,0x00,0x43,0x53,0x3c,
+    0x00,0x40,0x4b,0x3a,0x00,0x41,0x4d,0x3a,0x00,0x40,0x4b,0x39,0x00,0x42,0x51,0x3b,
+    0x00,0x46,0x59,0x3e,0x00,0x45,0x57,0x3d,0x04,0x00,0x32,0x42,0x54,0x3e,0x04,0x00,
+    0xa3,0x55,0x3f,0x00,0x41,0x50,0x3c,0x00,0x41,0x4b,0x39,0x2c,0x00,0xc6,0x3a,0x00,
+    0x42,0x4f,0x3b,0x00,0x45,0x59,0x3d,0x00,0x45,0x58,0x04,0x00,0x76,0x44,0x57,0x3e,
+    0x00,0x43,0x56,0x3f,0x04,0x00,0x61,0x58,0x40,0x00,0x42,0x51,0x3d,0x5c,0x00,0xf1,
+    0x2c,0x41,0x4d,0x3a,0x00,0x41,0x4c,0x3a,0x00,0x41,0x4e,0x3b,0x00,0x41,0x53,0x3d,
+    0x00,0x40,0x50,0x3c,0x00,0x47,0x63,0x42,0x00,0x45,0x5b,0x40,0x00,0x3e,0x43,0x38,
+    0x00,0x3f,0x48,0x39,0x00,0x45,0x59,0x41,0x00,0x40,0x48,0x3a,0x00,0x45,0x5c,0x40,
+    0x00,0x4d,0x74,0x48,0x00,0x42,0x53,0x3d,0x00,0x3f,0x48,0x3a,0x24,0x00,0xf3,0x02,
+    0x46,0x5f,0x41,0x00,0x44,0x58,0x3f,0x00,0x48,0x65,0x43,0x00,0x48,0x67,0x44,0x00,
+    0x49,0x04,0x00,0xa3,0x4a,0x6b,0x45,0x00,0x47,0x60,0x41,0x00,0x40,0x4a,0x64,0x00,
+    0x21,0x4b,0x39,0xac,0x00,0x01,0x88,0x00,0x2f,0x55,0x3e,0x04,0x00,0x06,0xff,0x08,
+    0x4c,0x6f,0x47,0x00,0x43,0x52,0x3d,0x56,0x38,0x36,0x34,0xdc,0x2f,0x2d,0x29,0xff,
+    0x2c,0x2b,0x26,0xff,0x2d,0x2c,0x28,0x04,0x00,0x46,0xfd,0x08,0x2b,0x2a,0x26,0xff,
+    0x33,0x32,0x2e,0xff,0x3b,0x3c,0x37,0xbb,0x41,0x50,0x3d,0x1f,0x47,0x63,0x43,0x00,
+    0x45,0x5f,0x42,0x04,0x00,0x31,0x46,0x60,0x43,0xf0,0x00,0x0f,0xa4,0x01,0xf1,0xff,
+    0x04,0x45,0x5a,0x40,0x3f,0x36,0x2e,0x30,0xff,0x38,0x35,0x33,0xff,0x36,0x35,0x31,
+    0xff,0x35,0x34,0x30,0x04,0x00,0x3f,0xfe,0x16,0x35,0x30,0xff,0x35,0x33,0x30,0xff,
+    0x34,0x30,0x2f,0xff,0x33,0x2f,0x2e,0xff,0x37,0x34,0x32,0xff,0x38,0x32,0x33,0xff,
+    0x3a,0x3a,0x35,0xe8,0x44,0x58,0x3e,0x0c,0x43,0x58,0x3d,0x00,0x43,0x56,0x04,0x00,
+    0x7f,0x44,0x57,0x3d,0x00,0x46,0x57,0x3d,0x48,0x03,0xee,0xef,0x3a,0x3b,0x34,0xcf,
+    0x37,0x33,0x32,0xff,0x39,0x39,0x34,0xff,0x39,0x38,0x04,0x00,0x43,0xf9,0x18,0x38,
+    0x37,0x33,0xff,0x38,0x36,0x33,0xfc,0x3f,0x47,0x39,0x78,0x41,0x4e,0x3c,0x59,0x39,
+    0x38,0x35,0xd1,0x39,0x36,0x33,0xff,0x36,0x30,0x31,0xff,0x3f,0x48,0x38,0x70,0x48,
+    0x62,0x41,0x00,0x46,0x5b,0x3f,0x04,0x00,0x26,0x45,0x5c,0xc8,0x04,0x0f,0xec,0x04,
+    0xed,0x4f,0x38,0x35,0x33,0xfa,0xa0,0x01,0x49,0xf6,0x1c,0x39,0x38,0x34,0xff,0x37,
+    0x33,0x32,0xff,0x3e,0x46,0x38,0x76,0x46,0x5d,0x41,0x00,0x47,0x62,0x43,0x00,0x43,
+    0x56,0x3e,0x0a,0x39,0x39,0x34,0xef,0x35,0x2d,0x30,0xff,0x3f,0x4a,0x3a,0x9d,0x4a,
+    0x6c,0x45,0x00,0x48,0x64,0x43,0x04,0x00,0x21,0x65,0x44,0x0c,0x00,0x3f,0x45,0x57,
+    0x3e,0x90,0x06,0xed,0x50,0x00,0x43,0x55,0x3e,0x00,0x8f,0x39,0x38,0x34,0xf3,0x39,
+    0x38,0x34,0xff,0x04,0x00,0x49,0xf6,0x18,0x37,0x33,0x32,0xff,0x40,0x4b,0x39,0x47,
+    0x46,0x5f,0x40,0x00,0x48,0x64,0x43,0x00,0x48,0x65,0x42,0x00,0x3b,0x3d,0x35,0xe4,
+    0x35,0x2c,0x30,0xff,0x3f,0x4a,0x3a,0x99,0x49,0x69,0x44,0x00,0x47,0x62,0x42,0x04,
+    0x00,0xf1,0x1b,0x64,0x43,0x00,0x46,0x5b,0x3f,0x00,0x45,0x55,0x3c,0x00,0x45,0x57,
+    0x3d,0x00,0x46,0x59,0x3d,0x00,0x43,0x53,0x3c,0x00,0x40,0x4b,0x3a,0x00,0x41,0x4d,
+    0x3a,0x00,0x40,0x4b,0x39,0x00,0x42,0x51,0x3b,0x00,0x46,0x59,0x3e,0x20,0x00,0x72,
+    0x45,0x57,0x3d,0x00,0x42,0x54,0x3e,0x04,0x00,0xa3,0x55,0x3f,0x00,0x41,0x50,0x3c,
+    0x00,0x41,0x4b,0x39,0x2c,0x00,0xc6,0x3a,0x00,0x42,0x4f,0x3b,0x00,0x45,0x59,0x3d,
+    0x00,0x45,0x58,0x04,0x00,0x76,0x44,0x57,0x3e,0x00,0x43,0x56,0x3f,0x04,0x00,0x61,
+    0x58,0x40,0x00,0x42,0x51,0x3d,0x5c,0x00,0xf1,0x2c,0x41,0x4d,0x3a,0x00,0x41,0x4c,
+    0x3a,0x00,0x41,0x4e,0x3b,0x00,0x41,0x53,0x3d,0x00,0x40,0x50,0x3c,0x00,0x47,0x63,
+    0x42,0x00,0x45,0x5b,0x40,0x00,0x3e,0x43,0x38,0x00,0x3f,0x48,0x39,0x00,0x45,0x59,
+    0x41,0x00,0x40,0x48,0x3a,0x00,0x46,0x5e,0x41,0x00,0x4e,0x77,0x49,0x00,0x42,0x54,
+    0x3d,0x00,0x3f,0x48,0x3a,0x24,0x00,0xf3,0x02,0x46,0x5f,0x41,0x00,0x44,0x58,0x3f,
+    0x00,0x48,0x65,0x43,0x00,0x48,0x67,0x44,0x00,0x49,0x04,0x00,0xa3,0x4a,0x6b,0x45,
+    0x00,0x47,0x60,0x41,0x00,0x40,0x4a,0x64,0x00,0x21,0x4b,0x39,0xac,0x00,0x01,0x88,
+    0x00,0x2f,0x55,0x3e,0x04,0x00,0x06,0x4f,0x39,0x38,0x34,0xf1,0xa0,0x01,0x49,0xfa,
+    0x15,0x39,0x38,0x34,0xff,0x38,0x34,0x33,0xff,0x3a,0x3b,0x35,0xcf,0x43,0x56,0x3e,
+    0x1f,0x46,0x5c,0x41,0x03,0x3e,0x44,0x38,0x81,0x38,0x35,0x33,0xff,0x36,0x30,0x31,
+    0xff,0x3f,0x4a,0x3a,0x97,0xa4,0x01,0xf1,0x0e,0x43,0x00,0x48,0x63,0x42,0x00,0x47,
+    0x5a,0x3e,0x00,0x46,0x5a,0x3d,0x00,0x46,0x5a,0x3e,0x00,0x47,0x5c,0x3d,0x00,0x44,
+    0x56,0x3d,0x00,0x41,0x4f,0x3b,0x9c,0x01,0xb3,0x41,0x4f,0x3a,0x00,0x43,0x55,0x3c,
+    0x00,0x47,0x5c,0x3f,0x28,0x00,0xf3,0x06,0x3e,0x00,0x42,0x53,0x3e,0x00,0x41,0x52,
+    0x3e,0x00,0x41,0x53,0x3f,0x00,0x41,0x51,0x3c,0x00,0x43,0x50,0x3a,0x2c,0x00,0x51,
+    0x3b,0x00,0x44,0x53,0x3c,0xa4,0x01,0x53,0x44,0x56,0x3c,0x00,0x45,0x04,0x00,0x76,
+    0x44,0x55,0x3e,0x00,0x42,0x54,0x3f,0x04,0x00,0x92,0x56,0x40,0x00,0x43,0x54,0x3e,
+    0x00,0x42,0x4f,0x38,0x00,0x71,0x43,0x51,0x3b,0x00,0x42,0x50,0x3c,0xa0,0x01,0xa3,
+    0x3f,0x4d,0x3b,0x00,0x46,0x61,0x41,0x00,0x45,0x5c,0xa4,0x01,0xa1,0x49,0x39,0x00,
+    0x47,0x5f,0x43,0x00,0x41,0x4b,0x3b,0x14,0x00,0xe2,0x4d,0x75,0x48,0x06,0x42,0x53,
+    0x3d,0x00,0x41,0x4c,0x3c,0x00,0x47,0x61,0x6c,0x02,0x09,0xa4,0x01,0x12,0x68,0x04,
+    0x00,0xa3,0x4a,0x6c,0x45,0x00,0x48,0x62,0x42,0x00,0x42,0x4e,0x64,0x00,0xa1,0x4f,
+    0x3a,0x00,0x42,0x53,0x3d,0x00,0x44,0x59,0x40,0xd4,0x01,0x0f,0x04,0x00,0x05,0x0f,
+    0xa4,0x01,0x51,0xff,0x08,0x39,0x39,0x34,0xff,0x38,0x35,0x33,0xff,0x39,0x38,0x34,
+    0xf9,0x3a,0x3c,0x35,0xe4,0x38,0x33,0x32,0xff,0x39,0x37,0x34,0xa4,0x01,0x02,0xf1,
+    0x00,0x48,0x66,0x44,0x00,0x44,0x57,0x3e,0x00,0x3f,0x49,0x3a,0x00,0x40,0x4d,0x3b,
+    0x04,0x00,0xf1,0x14,0x41,0x4f,0x3c,0x00,0x3e,0x48,0x39,0x46,0x3b,0x3e,0x36,0xac,
+    0x3c,0x40,0x36,0xa9,0x3b,0x3e,0x35,0xad,0x3d,0x45,0x37,0x70,0x41,0x4f,0x3b,0x00,
+    0x40,0x4c,0x3a,0x00,0x40,0x4d,0x3a,0xc8,0x02,0xf2,0x01,0x43,0x55,0x3d,0x00,0x44,
+    0x59,0x3f,0x00,0x3e,0x49,0x39,0x66,0x3b,0x3b,0x35,0xad,0x2c,0x00,0xf6,0x01,0x36,
+    0xab,0x3d,0x43,0x37,0x9c,0x46,0x5d,0x3f,0x02,0x47,0x5f,0x3f,0x00,0x46,0x5d,0x04,
+    0x00,0x31,0x45,0x5c,0x40,0x64,0x01,0x31,0x45,0x5c,0x40,0x5c,0x01,0x54,0x3f,0x4a,
+    0x3a,0x70,0x3a,0x38,0x00,0xe1,0x3d,0x36,0xab,0x3d,0x44,0x38,0x90,0x43,0x5a,0x3f,
+    0x01,0x42,0x57,0x3e,0x0c,0x03,0xf2,0x23,0x45,0x5b,0x40,0x00,0x3f,0x47,0x3a,0x00,
+    0x3f,0x48,0x39,0x21,0x3f,0x48,0x3a,0x7a,0x3b,0x3e,0x36,0xb8,0x3a,0x3c,0x35,0xde,
+    0x3b,0x3f,0x36,0xe7,0x3a,0x3a,0x35,0xd8,0x3c,0x3f,0x37,0xae,0x3f,0x4a,0x3a,0x6b,
+    0x46,0x5f,0x41,0x14,0x46,0x5e,0x41,0x00,0x48,0x66,0x48,0x03,0x01,0x3c,0x04,0xff,
+    0x13,0x63,0x43,0x00,0x49,0x69,0x44,0x00,0x45,0x5a,0x3f,0x32,0x3b,0x3c,0x35,0xab,
+    0x3c,0x40,0x36,0xa9,0x3c,0x3e,0x35,0xac,0x3d,0x44,0x38,0x82,0x40,0x4d,0x3c,0x00,
+    0x40,0x4c,0x3b,0x04,0x00,0x06,0x4f,0x39,0x38,0x34,0xf6,0x48,0x03,0x4d,0x04,0x60,
+    0x00,0x34,0x38,0x36,0x33,0xac,0x01,0x01,0x5c,0x05,0x0f,0xa4,0x01,0x01,0xf1,0x00,
+    0x49,0x68,0x43,0x00,0x41,0x51,0x3e,0x00,0x39,0x3d,0x38,0x00,0x3b,0x43,0x39,0x04,
+    0x00,0xf1,0x28,0x3c,0x45,0x3b,0x00,0x39,0x3e,0x37,0x79,0x36,0x32,0x32,0xff,0x37,
+    0x34,0x33,0xff,0x36,0x31,0x32,0xff,0x38,0x39,0x34,0xc3,0x3c,0x46,0x38,0x00,0x3b,
+    0x41,0x36,0x00,0x3b,0x43,0x37,0x00,0x45,0x59,0x3e,0x00,0x46,0x5e,0x40,0x00,0x48,
+    0x62,0x40,0x00,0x40,0x4d,0x3a,0x62,0x35,0x2e,0x31,0x2c,0x00,0xf1,0x08,0x37,0x33,
+    0x33,0xff,0x36,0x2f,0x31,0xff,0x43,0x55,0x3d,0x3f,0x49,0x66,0x42,0x00,0x46,0x5f,
+    0x40,0x00,0x47,0x60,0x40,0x08,0x00,0x32,0x46,0x5f,0x41,0x04,0x00,0x11,0x61,0x08,
+    0x00,0x81,0x05,0x39,0x38,0x34,0xff,0x36,0x30,0x32,0xf8,0x03,0xf1,0x04,0x35,0x2b,
+    0x30,0xff,0x3e,0x46,0x39,0xaf,0x4a,0x6a,0x44,0x00,0x49,0x66,0x43,0x00,0x4e,0x76,
+    0x49,0xc8,0x04,0x81,0x3a,0x3a,0x35,0x8c,0x39,0x38,0x34,0xfe,0x84,0x00,0x12,0x35,
+    0xd0,0x00,0xf1,0x18,0x37,0x33,0x32,0xff,0x38,0x36,0x33,0xff,0x37,0x34,0x32,0xff,
+    0x36,0x30,0x31,0xff,0x39,0x37,0x34,0xf1,0x3f,0x4a,0x3a,0x70,0x4b,0x6d,0x46,0x00,
+    0x4a,0x6b,0x46,0x00,0x47,0x63,0x43,0x00,0x47,0x60,0x42,0xe8,0x01,0x62,0x42,0x54,
+    0x3d,0x55,0x35,0x2f,0x9c,0x00,0xff,0x00,0x36,0x31,0x32,0xff,0x3a,0x39,0x35,0xe2,
+    0x3e,0x45,0x39,0x00,0x3d,0x43,0x38,0x04,0x00,0x06,0xb2,0x38,0x34,0x32,0xff,0x39,
+    0x36,0x31,0xff,0x39,0x37,0x31,0x08,0x00,0x17,0x36,0x08,0x00,0x03,0x14,0x00,0x21,
+    0x38,0x34,0x04,0x03,0x01,0x58,0x01,0x04,0x70,0x01,0x0f,0x08,0x00,0x31,0x0f,0xa4,
+    0x01,0x02,0x21,0x67,0x43,0xb8,0x04,0x71,0x3b,0x41,0x39,0x00,0x3d,0x46,0x3a,0x04,
+    0x00,0xb1,0x3e,0x48,0x3b,0x00,0x3b,0x41,0x38,0x69,0x38,0x36,0x33,0x84,0x00,0xf3,
+    0x19,0x38,0x35,0x33,0xff,0x3a,0x3d,0x35,0xa9,0x3e,0x49,0x39,0x00,0x3d,0x46,0x38,
+    0x00,0x3c,0x44,0x38,0x00,0x42,0x52,0x3c,0x00,0x46,0x5c,0x3f,0x00,0x45,0x5a,0x3e,
+    0x00,0x44,0x59,0x3e,0x02,0x39,0x3a,0x34,0xe9,0xbc,0x03,0x01,0xa4,0x01,0xf1,0x04,
+    0x3f,0x4a,0x3a,0x8f,0x4c,0x71,0x47,0x00,0x49,0x69,0x45,0x00,0x4a,0x6b,0x45,0x00,
+    0x48,0x65,0x43,0x44,0x03,0x22,0x46,0x5d,0x24,0x07,0x71,0x42,0x52,0x3d,0x49,0x37,
+    0x31,0x32,0x60,0x00,0x04,0x44,0x07,0xf3,0x05,0x43,0x57,0x3f,0x2f,0x4a,0x67,0x45,
+    0x00,0x4a,0x6a,0x45,0x00,0x48,0x64,0x43,0x03,0x3c,0x40,0x37,0xc3,0x84,0x01,0x02,
+    0x1c,0x04,0x21,0x37,0x33,0x9c,0x01,0x22,0x38,0x33,0xb0,0x01,0x32,0x39,0x37,0x33,
+    0x18,0x00,0x51,0x34,0x33,0xff,0x36,0x2e,0x74,0x00,0x81,0x96,0x4a,0x6d,0x46,0x00,
+    0x49,0x68,0x45,0xa8,0x01,0xa2,0x49,0x68,0x44,0x00,0x43,0x56,0x3e,0x4a,0x37,0x33,
+    0x68,0x00,0xff,0x00,0x38,0x35,0x33,0xff,0x3b,0x3d,0x36,0xc4,0x3f,0x48,0x3a,0x00,
+    0x3e,0x46,0x39,0x04,0x00,0x06,0xf8,0x01,0x40,0x49,0x32,0x68,0x3c,0x33,0x1f,0xbb,
+    0x3d,0x36,0x21,0xbc,0x3d,0x37,0x21,0xba,0x04,0x00,0xf5,0x04,0x3c,0x36,0x21,0xba,
+    0x3e,0x39,0x1f,0xb6,0x3d,0x3a,0x28,0xd8,0x37,0x32,0x33,0xff,0x39,0x38,0x35,0xc4,
+    0x00,0x0f,0xa4,0x01,0x79,0x31,0x3b,0x42,0x37,0xec,0x04,0x71,0x47,0x62,0x42,0x00,
+    0x45,0x5e,0x40,0x94,0x08,0x71,0x3e,0x47,0x39,0x93,0x37,0x30,0x31,0xb0,0x00,0x81,
+    0x37,0x34,0x32,0xff,0x3b,0x3d,0x36,0xdf,0x34,0x03,0x21,0x5e,0x41,0x10,0x03,0x31,
+    0x47,0x61,0x42,0xac,0x01,0xe3,0x4a,0x6a,0x44,0x00,0x4d,0x71,0x47,0x00,0x3f,0x49,
+    0x39,0x9a,0x36,0x2f,0x30,0x00,0x11,0x33,0x30,0x00,0x41,0xd8,0x47,0x61,0x43,0x60,
+    0x01,0x81,0x4a,0x6a,0x45,0x00,0x3a,0x3a,0x35,0xb6,0x20,0x00,0x12,0x39,0xfc,0x00,
+    0x21,0x38,0x34,0xb0,0x05,0xf2,0x00,0xfe,0x3a,0x3c,0x36,0xc2,0x3d,0x42,0x38,0xa8,
+    0x3b,0x3e,0x36,0xc6,0x38,0x37,0xdc,0x01,0xf1,0x04,0x39,0x39,0x34,0xff,0x39,0x37,
+    0x34,0xff,0x35,0x2c,0x30,0xff,0x40,0x4d,0x3c,0x6d,0x4c,0x73,0x48,0x90,0x06,0x2f,
+    0x49,0x67,0xa4,0x01,0x23,0xfa,0x00,0x44,0x6c,0x63,0x00,0x26,0x56,0xc2,0x00,0x28,
+    0x56,0xc1,0x00,0x28,0x57,0xbd,0x04,0x00,0xf2,0x02,0x56,0xc0,0x00,0x27,0x5a,0xc8,
+    0x00,0x44,0x67,0x5e,0x00,0x44,0x49,0x20,0x7e,0x37,0x33,0xa0,0x00,0x0f,0xa0,0x01,
+    0x31,0x02,0x58,0x04,0x01,0x6c,0x02,0x09,0x34,0x08,0x0f,0x48,0x03,0x21,0x31,0x3b,
+    0x42,0x36,0x20,0x09,0xf2,0x03,0x48,0x65,0x43,0x00,0x47,0x62,0x42,0x00,0x49,0x69,
+    0x44,0x00,0x43,0x57,0x3e,0x3b,0x37,0x32,0xb0,0x02,0x01,0xb8,0x08,0xa1,0x33,0x33,
+    0xff,0x41,0x4d,0x3a,0x32,0x45,0x59,0x3e,0x24,0x0a,0x32,0x44,0x58,0x3e,0xe8,0x04,
+    0x03,0xb8,0x01,0x44,0x3b,0x3c,0x36,0xe7,0x30,0x04,0xf1,0x05,0x36,0x2f,0x31,0xff,
+    0x3f,0x49,0x39,0x81,0x4a,0x69,0x44,0x00,0x4a,0x6c,0x46,0x00,0x42,0x52,0x3d,0x51,
+    0x40,0x03,0x03,0x5c,0x07,0xf1,0x04,0x37,0x32,0x32,0xff,0x3b,0x3c,0x36,0xb1,0x44,
+    0x57,0x3f,0x22,0x3e,0x49,0x3b,0x00,0x41,0x4f,0x3d,0x24,0x02,0x81,0x42,0x55,0x3f,
+    0x31,0x3a,0x3c,0x35,0xcf,0x28,0x03,0x03,0x84,0x07,0xa3,0x38,0x36,0x33,0xff,0x45,
+    0x5b,0x40,0x13,0x47,0x61,0x98,0x00,0x0f,0x48,0x03,0x20,0xfb,0x01,0x2c,0x67,0xca,
+    0x84,0x1a,0x64,0xff,0xdb,0x1c,0x64,0xff,0xdb,0x1d,0x64,0xff,0xd9,0x04,0x00,0xf1,
+    0x02,0xda,0x18,0x62,0xff,0xe0,0x28,0x6b,0xe1,0x8f,0x46,0x6a,0x59,0x00,0x3d,0x3c,
+    0x26,0xc1,0x80,0x00,0x0f,0xf8,0x04,0x34,0x0f,0xa4,0x01,0x39,0x31,0x3f,0x4c,0x3a,
+    0x50,0x04,0x13,0x46,0x58,0x09,0x81,0x47,0x61,0x42,0x00,0x3a,0x3c,0x36,0xe2,0xf0,
+    0x02,0x21,0x38,0x34,0xc4,0x06,0x71,0x3f,0x49,0x39,0x82,0x49,0x64,0x42,0x8c,0x06,
+    0x71,0x44,0x5a,0x3f,0x00,0x42,0x52,0x3d,0x50,0x09,0x62,0x3f,0x4c,0x3b,0x3a,0x37,
+    0x33,0x48,0x05,0x11,0x39,0x0c,0x03,0x01,0x58,0x01,0x31,0x28,0x4b,0x6c,0xe4,0x04,
+    0x51,0x00,0x3a,0x3c,0x35,0xd8,0xf0,0x01,0x12,0x39,0x28,0x03,0x62,0x3b,0x3e,0x36,
+    0xc3,0x45,0x5c,0xdc,0x01,0x71,0x3c,0x44,0x38,0x00,0x3e,0x47,0x3a,0x4c,0x0a,0x11,
+    0x47,0x74,0x0b,0x63,0x3d,0x0a,0x38,0x35,0x32,0xfb,0x24,0x09,0x01,0xa0,0x06,0x71,
+    0x3c,0x41,0x37,0x87,0x44,0x5a,0x3f,0x4c,0x03,0x2f,0x43,0x57,0xec,0x04,0x1a,0x50,
+    0x00,0x3e,0x46,0x39,0x00,0x73,0x1c,0x5d,0xff,0xff,0x20,0x5f,0xf3,0x04,0x00,0x1b,
+    0xf4,0x04,0x00,0xff,0x0a,0xf3,0xff,0x20,0x5f,0xf1,0xff,0x16,0x61,0xff,0xff,0x2e,
+    0x57,0xa7,0x00,0x42,0x3d,0x12,0x85,0x38,0x34,0x33,0xff,0x39,0x38,0x34,0x04,0x00,
+    0x32,0xf1,0x00,0x36,0x30,0x31,0xff,0x3f,0x4a,0x3a,0x97,0x49,0x69,0x44,0x00,0x47,
+    0x62,0x42,0x04,0x00,0xf1,0x00,0x49,0x67,0x43,0x00,0x42,0x53,0x3e,0x00,0x3b,0x41,
+    0x39,0x00,0x3d,0x46,0x3a,0x04,0x00,0xb1,0x3e,0x48,0x3b,0x00,0x3b,0x41,0x38,0x69,
+    0x38,0x36,0x33,0x78,0x00,0xf1,0x0c,0x38,0x35,0x33,0xff,0x3a,0x3d,0x35,0xa9,0x3e,
+    0x49,0x39,0x00,0x3d,0x46,0x38,0x00,0x3c,0x44,0x37,0x00,0x3e,0x48,0x39,0x00,0x46,
+    0x5f,0x41,0x44,0x00,0xf1,0x00,0x47,0x60,0x42,0x00,0x49,0x67,0x44,0x00,0x3f,0x48,
+    0x3a,0x8c,0x36,0x30,0x31,0x34,0x00,0xf1,0x0b,0x37,0x33,0x32,0xff,0x3b,0x3f,0x36,
+    0xd2,0x48,0x63,0x43,0x00,0x47,0x62,0x43,0x00,0x46,0x5e,0x42,0x00,0x45,0x5d,0x41,
+    0x00,0x48,0x64,0x28,0x00,0x15,0x8b,0x28,0x00,0xf1,0x1b,0x32,0x32,0xff,0x3c,0x40,
+    0x37,0xd1,0x4b,0x6d,0x47,0x00,0x47,0x60,0x41,0x00,0x41,0x50,0x3b,0x30,0x38,0x35,
+    0x33,0xff,0x39,0x37,0x34,0xff,0x39,0x37,0x34,0xff,0x38,0x33,0x33,0xff,0x45,0x5a,
+    0x40,0x24,0x4b,0x6d,0x47,0x70,0x00,0xf1,0x28,0x3d,0x45,0x39,0x00,0x41,0x4f,0x3c,
+    0x00,0x43,0x56,0x3e,0x00,0x48,0x65,0x43,0x00,0x4e,0x74,0x48,0x00,0x40,0x4d,0x3b,
+    0x55,0x36,0x2f,0x31,0xa4,0x39,0x37,0x34,0x9a,0x37,0x30,0x32,0xa4,0x41,0x50,0x3c,
+    0x64,0x4b,0x6f,0x46,0x00,0x49,0x69,0x44,0x00,0x43,0x56,0x3e,0x4a,0x37,0x33,0x32,
+    0x94,0x00,0xff,0x00,0x38,0x35,0x33,0xff,0x3b,0x3d,0x36,0xc4,0x3f,0x48,0x3a,0x00,
+    0x3e,0x46,0x39,0x04,0x00,0x06,0x42,0x20,0x5f,0xf3,0xf4,0x8c,0x01,0x04,0xa8,0x01,
+    0x0c,0x08,0x00,0xe1,0xf2,0xff,0x1a,0x63,0xff,0xfb,0x2e,0x54,0x9e,0x02,0x41,0x39,
+    0x13,0x8f,0xb0,0x00,0x0f,0xa4,0x01,0x7d,0xf4,0x0c,0x45,0x38,0x00,0x3d,0x45,0x38,
+    0x00,0x46,0x5e,0x3f,0x00,0x49,0x63,0x42,0x00,0x48,0x61,0x41,0x00,0x4a,0x67,0x43,
+    0x00,0x44,0x56,0x3d,0x35,0x10,0x01,0x01,0x60,0x01,0xd3,0x35,0x33,0xff,0x45,0x57,
+    0x3e,0x24,0x49,0x62,0x42,0x00,0x47,0x5e,0xd0,0x01,0x92,0x62,0x42,0x00,0x3b,0x3e,
+    0x36,0xdb,0x37,0x34,0x38,0x01,0xf2,0x07,0x36,0x2f,0x31,0xff,0x41,0x50,0x3c,0x7a,
+    0x4c,0x70,0x46,0x00,0x47,0x5f,0x40,0x00,0x3e,0x47,0x38,0x6f,0x37,0x32,0x1c,0x00,
+    0x21,0x37,0x33,0xc0,0x01,0x11,0xc8,0xe4,0x01,0xff,0x2a,0x5f,0x42,0x00,0x45,0x5a,
+    0x40,0x00,0x44,0x59,0x3f,0x00,0x45,0x5b,0x3f,0x00,0x42,0x53,0x3d,0x00,0x42,0x56,
+    0x3e,0x00,0x4a,0x6b,0x45,0x00,0x43,0x57,0x3f,0x00,0x3b,0x3e,0x36,0x00,0x3d,0x43,
+    0x38,0x00,0x3c,0x40,0x36,0x00,0x4a,0x68,0x45,0x00,0x4e,0x77,0x49,0x00,0x49,0x68,
+    0x44,0x00,0x43,0x55,0xa4,0x01,0x18,0xbe,0x45,0x39,0x00,0x3d,0x44,0x38,0x00,0x20,
+    0x5f,0xf3,0xf1,0x98,0x01,0x08,0xa8,0x01,0x01,0xa4,0x01,0x9f,0xfa,0x2f,0x55,0x9c,
+    0x02,0x41,0x3a,0x14,0x90,0xa4,0x01,0x81,0x01,0x4c,0x03,0xf1,0x03,0x43,0x37,0x00,
+    0x44,0x58,0x3e,0x00,0x48,0x64,0x42,0x00,0x47,0x60,0x40,0x00,0x47,0x61,0x41,0x04,
+    0x00,0x53,0x3a,0x3b,0x35,0xdc,0x37,0xfc,0x03,0xb1,0x36,0x30,0x32,0xff,0x40,0x4d,
+    0x3a,0x72,0x4c,0x6b,0x43,0xc8,0x01,0x93,0x48,0x64,0x43,0x00,0x43,0x56,0x3e,0x2e,
+    0x38,0xa0,0x01,0x01,0xc8,0x01,0xd1,0x36,0x33,0xff,0x42,0x52,0x3c,0x22,0x48,0x61,
+    0x41,0x00,0x4d,0x73,0x14,0x03,0x41,0x94,0x35,0x2f,0x30,0x98,0x02,0xb1,0x37,0x32,
+    0x32,0xff,0x3e,0x47,0x39,0x8f,0x46,0x5f,0x41,0x9c,0x01,0x23,0x46,0x5f,0x68,0x00,
+    0xf2,0x17,0x5e,0x41,0x00,0x44,0x58,0x3f,0x00,0x43,0x57,0x3e,0x00,0x42,0x54,0x3d,
+    0x00,0x44,0x5a,0x3f,0x00,0x45,0x5c,0x40,0x00,0x44,0x5c,0x3f,0x00,0x44,0x5b,0x3f,
+    0x00,0x46,0x5e,0x41,0x00,0x48,0x63,0x43,0xa4,0x01,0x0f,0x48,0x03,0x14,0x31,0x3d,
+    0x45,0x38,0xe4,0x01,0x3f,0x41,0x50,0x3c,0xa4,0x01,0xb6,0xf1,0x00,0x3b,0x40,0x36,
+    0x00,0x43,0x56,0x3d,0x00,0x4a,0x68,0x44,0x00,0x47,0x62,0x41,0x04,0x00,0xa3,0x4a,
+    0x6a,0x44,0x00,0x3f,0x4a,0x3a,0x83,0x36,0x2f,0xf0,0x04,0xf4,0x08,0x31,0x32,0xff,
+    0x3d,0x42,0x38,0xc4,0x4a,0x6c,0x45,0x00,0x48,0x64,0x43,0x00,0x49,0x66,0x43,0x00,
+    0x3f,0x4a,0x3b,0x7f,0xe8,0x04,0xb1,0x38,0x33,0x32,0xff,0x3c,0x3f,0x37,0xc9,0x44,
+    0x5b,0x40,0x0c,0x03,0x84,0x45,0x5e,0x42,0x00,0x3d,0x46,0x39,0xa5,0x48,0x03,0x84,
+    0x38,0x36,0x33,0xff,0x3c,0x41,0x37,0x7b,0xe0,0x02,0xf5,0x05,0x40,0x4d,0x3a,0x00,
+    0x41,0x52,0x3c,0x00,0x40,0x4d,0x3b,0x2d,0x3d,0x43,0x38,0xa3,0x3d,0x44,0x38,0xa1,
+    0x04,0x00,0x12,0x45,0x0c,0x00,0xb1,0x3c,0x43,0x37,0xa4,0x3d,0x45,0x38,0x83,0x41,
+    0x50,0x3c,0xa4,0x01,0x3f,0x44,0x58,0x3f,0xec,0x04,0x0e,0x01,0xa0,0x01,0x61,0x42,
+    0x38,0x00,0x41,0x51,0x3c,0xec,0x01,0x0f,0x48,0x03,0xb5,0x31,0x3b,0x40,0x36,0xd4,
+    0x00,0x22,0x4b,0x6e,0xf8,0x05,0xc1,0x49,0x68,0x44,0x00,0x4b,0x6f,0x46,0x00,0x45,
+    0x5d,0x40,0x2b,0xf0,0x04,0x03,0x50,0x06,0xf4,0x05,0x39,0x37,0x34,0xff,0x42,0x51,
+    0x3c,0x19,0x47,0x60,0x41,0x00,0x4b,0x69,0x44,0x00,0x3c,0x3f,0x36,0xd0,0x84,0x01,
+    0xff,0x07,0x37,0x31,0x32,0xff,0x3f,0x4a,0x3a,0x70,0x45,0x5e,0x42,0x00,0x43,0x56,
+    0x3f,0x00,0x44,0x5c,0x41,0x00,0x3d,0x44,0xa4,0x01,0x04,0xf7,0x06,0x43,0x38,0x00,
+    0x3b,0x42,0x37,0x00,0x3b,0x44,0x37,0x00,0x3a,0x3f,0x35,0x52,0x37,0x32,0x32,0xff,
+    0x37,0x33,0x04,0x00,0x12,0x32,0x04,0x00,0xb1,0x36,0x2f,0x31,0xff,0x38,0x36,0x33,
+    0xef,0x3e,0x46,0x39,0x24,0x07,0x0f,0xa4,0x01,0x0e,0x03,0x5c,0x00,0x31,0x42,0x51,
+    0x3d,0xa0,0x01,0x3f,0x44,0x59,0x3f,0x48,0x03,0xb3,0x12,0x44,0xec,0x04,0x31,0x41,
+    0x4f,0x3c,0x60,0x06,0xf4,0x05,0x49,0x69,0x44,0x00,0x49,0x6a,0x45,0x00,0x4a,0x6b,
+    0x46,0x00,0x4a,0x6c,0x46,0x00,0x3b,0x40,0x37,0xd4,0x88,0x01,0xf7,0x03,0x36,0x31,
+    0x31,0xff,0x40,0x4c,0x39,0x68,0x49,0x64,0x42,0x00,0x42,0x53,0x3d,0x25,0x38,0x36,
+    0x10,0x08,0xa1,0x36,0x33,0xff,0x43,0x53,0x3c,0x1b,0x46,0x5a,0x3f,0x50,0x01,0x21,
+    0x4d,0x75,0xec,0x04,0x39,0x97,0x35,0x2e,0xec,0x04,0x41,0x8d,0x48,0x61,0x42,0xec,
+    0x04,0xc1,0x3d,0x46,0x38,0x00,0x3c,0x46,0x37,0x00,0x3c,0x43,0x36,0x52,0x54,0x08,
+    0x12,0x38,0x04,0x02,0x08,0x10,0x06,0x01,0xe0,0x08,0x61,0x3b,0x35,0xcf,0x3f,0x4a,
+    0x3a,0x54,0x00,0x0f,0xa4,0x01,0x0a,0x0f,0xa0,0x01,0x00,0x21,0x44,0x58,0xa4,0x01,
+    0x1a,0xf2,0x80,0x06,0x08,0x8c,0x06,0x06,0x34,0x08,0x88,0x2f,0x55,0x9e,0x02,0x41,
+    0x3a,0x14,0x91,0x80,0x00,0x0f,0xe0,0x09,0x2d,0x0f,0xd8,0x09,0x32,0x03,0xa0,0x01,
+    0xb1,0x42,0x53,0x3d,0x00,0x45,0x5b,0x40,0x00,0x44,0x56,0x3f,0x08,0x00,0xf1,0x04,
+    0x45,0x5b,0x3f,0x00,0x45,0x5a,0x3e,0x00,0x48,0x63,0x42,0x00,0x3f,0x4a,0x3a,0x7a,
+    0x37,0x31,0x32,0x44,0x01,0xf4,0x01,0x36,0x31,0x31,0xff,0x3d,0x44,0x38,0xb7,0x4a,
+    0x69,0x44,0x00,0x3e,0x47,0x39,0x71,0x18,0x00,0xb1,0x37,0x32,0x32,0xff,0x3d,0x41,
+    0x37,0xc0,0x47,0x62,0x42,0xc0,0x02,0xc1,0x42,0x54,0x3c,0x00,0x43,0x57,0x3d,0x00,
+    0x3d,0x44,0x38,0x76,0x88,0x03,0x03,0x24,0x00,0xf5,0x1c,0x3c,0x41,0x37,0xc0,0x48,
+    0x64,0x42,0x00,0x48,0x62,0x41,0x00,0x42,0x52,0x3e,0x00,0x3e,0x46,0x3a,0x00,0x3d,
+    0x44,0x39,0x22,0x39,0x38,0x36,0x7a,0x38,0x38,0x35,0x77,0x38,0x35,0x34,0x72,0x3b,
+    0x3e,0x37,0x83,0x3a,0x39,0x35,0xe0,0x06,0x7f,0x39,0x39,0x34,0xca,0x3d,0x45,0x38,
+    0xa4,0x01,0x0b,0x04,0xa0,0x01,0x13,0x52,0x40,0x03,0x12,0x58,0xa0,0x01,0xc2,0x44,
+    0x58,0x3f,0x00,0x1e,0x5e,0xfd,0xff,0x1e,0x5e,0xfb,0xff,0x08,0x00,0x1f,0xfc,0x04,
+    0x00,0x00,0xf1,0x02,0xfa,0xff,0x18,0x63,0xff,0xff,0x2d,0x53,0x9f,0x02,0x40,0x36,
+    0x11,0xa0,0x37,0x32,0x32,0x20,0x09,0x0f,0x04,0x00,0x06,0x03,0x20,0x0b,0x0f,0xc0,
+    0x01,0x11,0x0f,0xa4,0x01,0x2d,0x22,0x3d,0x47,0x40,0x03,0x01,0xa0,0x01,0x07,0xd8,
+    0x00,0x01,0xa8,0x04,0x01,0xe4,0x00,0xa4,0x3d,0x00,0x45,0x58,0x3d,0x00,0x43,0x53,
+    0x3c,0x24,0x30,0x03,0x01,0x08,0x00,0xb4,0x38,0x34,0xf5,0x46,0x60,0x41,0x00,0x3d,
+    0x43,0x37,0xab,0x80,0x01,0xb1,0x36,0x30,0x31,0xff,0x41,0x4f,0x3c,0x69,0x49,0x68,
+    0x44,0x54,0x0b,0x11,0x45,0xec,0x07,0x61,0x40,0x00,0x43,0x54,0x3d,0x3d,0x70,0x0c,
+    0xf4,0x20,0x37,0x34,0xff,0x38,0x37,0x33,0xff,0x38,0x34,0x33,0xfd,0x45,0x5a,0x40,
+    0x19,0x4a,0x69,0x45,0x00,0x43,0x55,0x3f,0x00,0x40,0x4b,0x3d,0x00,0x3e,0x47,0x3c,
+    0x00,0x37,0x35,0x35,0x00,0x37,0x37,0x35,0x00,0x40,0x4e,0x3c,0x00,0x44,0x59,0x3f,
+    0x12,0xcc,0x02,0x03,0xd8,0x01,0x41,0xb5,0x45,0x5c,0x40,0x90,0x06,0x2e,0x43,0x57,
+    0xd8,0x09,0x31,0x3e,0x47,0x39,0x80,0x06,0x62,0x42,0x52,0x3d,0x00,0x46,0x5c,0x80,
+    0x08,0xc0,0x44,0x58,0x3f,0x00,0x44,0x58,0x3f,0x00,0x44,0x58,0x3f,0x00,0xfa,0x01,
+    0x1f,0x59,0xec,0x9c,0x1d,0x58,0xf6,0xf8,0x1f,0x59,0xef,0xf5,0x1f,0x59,0xf0,0xf3,
+    0x04,0x00,0xfc,0x0f,0xef,0xf4,0x1c,0x58,0xfb,0xf9,0x1c,0x5a,0xff,0xba,0x39,0x62,
+    0x7a,0x00,0x35,0x47,0x21,0x57,0x2b,0x32,0x33,0xef,0x2f,0x39,0x35,0xf8,0x2f,0x39,
+    0x35,0xf3,0x04,0x00,0xff,0x02,0x30,0x3a,0x35,0xef,0x2a,0x36,0x34,0xfd,0x34,0x32,
+    0x32,0xff,0x3b,0x38,0x34,0xff,0x39,0x04,0x00,0x0c,0xf1,0x00,0x36,0x30,0x31,0xff,
+    0x3f,0x4a,0x3a,0x97,0x49,0x69,0x44,0x00,0x47,0x62,0x42,0x04,0x00,0xf1,0x00,0x49,
+    0x67,0x43,0x00,0x42,0x53,0x3e,0x00,0x3b,0x41,0x39,0x00,0x3d,0x46,0x3a,0x04,0x00,
+    0xb1,0x3e,0x48,0x3b,0x00,0x3b,0x41,0x38,0x69,0x38,0x36,0x33,0x54,0x00,0xf5,0x08,
+    0x38,0x35,0x33,0xff,0x3a,0x3c,0x35,0xa8,0x3d,0x45,0x38,0x00,0x42,0x52,0x3d,0x00,
+    0x45,0x5c,0x40,0x00,0x44,0x58,0x3f,0x04,0x00,0xf6,0x0b,0x43,0x57,0x3f,0x00,0x45,
+    0x5c,0x41,0x00,0x49,0x66,0x43,0x00,0x44,0x56,0x3d,0x00,0x45,0x59,0x3d,0x00,0x3b,
+    0x3d,0x35,0xce,0x37,0x34,0x40,0x00,0xc1,0x3f,0x4a,0x3a,0x81,0x3b,0x3e,0x36,0xdb,
+    0x38,0x36,0x33,0xff,0x58,0x00,0xf1,0x43,0x37,0x34,0xfe,0x45,0x5b,0x3f,0x17,0x47,
+    0x62,0x42,0x00,0x46,0x5f,0x41,0x00,0x48,0x63,0x43,0x00,0x49,0x67,0x44,0x00,0x47,
+    0x60,0x43,0x01,0x39,0x38,0x34,0xe9,0x38,0x34,0x33,0xff,0x39,0x39,0x34,0xff,0x37,
+    0x31,0x32,0xff,0x3c,0x43,0x37,0xb1,0x4a,0x6a,0x45,0x00,0x40,0x4b,0x3b,0x00,0x42,
+    0x51,0x3c,0x00,0x45,0x5a,0x40,0x00,0x3e,0x46,0x3a,0x00,0x3f,0x49,0x3b,0x00,0x4c,
+    0x6e,0x47,0x00,0x3f,0x49,0x3a,0xaa,0x36,0x31,0x31,0x30,0x00,0xf7,0x08,0x36,0x2f,
+    0x31,0xff,0x40,0x4b,0x3b,0x7e,0x4a,0x6b,0x45,0x00,0x49,0x68,0x44,0x00,0x43,0x56,
+    0x3e,0x4a,0x37,0x33,0x32,0xc8,0x00,0x5f,0x36,0xc4,0x3e,0x45,0x39,0xc8,0x00,0x02,
+    0x05,0xd4,0x00,0xf9,0x00,0x75,0x76,0x00,0x46,0x73,0x68,0x01,0x46,0x6e,0x5e,0x01,
+    0x46,0x6f,0x61,0x00,0x04,0x00,0xfd,0x10,0x6e,0x5e,0x00,0x45,0x70,0x67,0x04,0x40,
+    0x75,0x83,0x00,0x48,0x6f,0x52,0x00,0x61,0x64,0x3c,0x00,0x51,0x62,0x42,0x00,0x49,
+    0x68,0x44,0x04,0x4b,0x67,0x44,0x00,0x04,0x00,0xc3,0x6b,0x45,0x00,0x53,0x62,0x42,
+    0x00,0x3b,0x40,0x37,0x83,0x35,0x88,0x00,0x0f,0xa8,0x01,0x09,0x0f,0xa4,0x01,0x26,
+    0xa1,0x34,0x33,0xff,0x3b,0x3e,0x35,0x9d,0x45,0x5b,0x40,0xd8,0x01,0x39,0x46,0x5e,
+    0x41,0x04,0x00,0xf2,0x0b,0x45,0x5d,0x41,0x00,0x47,0x5f,0x41,0x00,0x4b,0x6e,0x47,
+    0x00,0x48,0x63,0x42,0x00,0x47,0x5e,0x3f,0x00,0x3f,0x4a,0x39,0x74,0x37,0x31,0x1c,
+    0x01,0x04,0xe8,0x01,0x22,0x39,0x37,0x0c,0x00,0xb6,0x37,0x32,0x32,0xff,0x3c,0x41,
+    0x37,0xbd,0x47,0x63,0x43,0x48,0x00,0xf1,0x03,0x61,0x42,0x00,0x47,0x60,0x42,0x00,
+    0x4a,0x6b,0x45,0x00,0x40,0x4d,0x3b,0x6e,0x35,0x2d,0x30,0x74,0x01,0x01,0x3c,0x00,
+    0xf5,0x10,0x33,0x32,0xff,0x3d,0x45,0x38,0x9a,0x40,0x4c,0x3b,0x12,0x43,0x54,0x3e,
+    0x00,0x49,0x69,0x44,0x00,0x45,0x59,0x40,0x00,0x41,0x4d,0x3c,0x0a,0x3f,0x49,0x3b,
+    0x87,0x5c,0x00,0xfb,0x02,0x36,0x33,0xff,0x38,0x34,0x32,0xff,0x44,0x58,0x3f,0x21,
+    0x48,0x64,0x43,0x00,0x49,0x69,0xa4,0x01,0x9f,0x34,0x33,0xff,0x3b,0x3c,0x36,0xbb,
+    0x45,0x5a,0xc8,0x00,0x03,0x04,0xd4,0x00,0xfa,0x01,0x64,0xb7,0x48,0x51,0x68,0xcc,
+    0x50,0x9b,0x65,0xc2,0x50,0x9d,0x65,0xc2,0x4f,0x9c,0x04,0x00,0xfc,0x0f,0x50,0x9c,
+    0x68,0xca,0x4f,0x9e,0x5b,0xc1,0x48,0x6a,0x5c,0x79,0x43,0x00,0xc7,0x66,0x42,0x2b,
+    0xde,0x6c,0x3f,0x98,0xd6,0x6b,0x3f,0x9e,0xd7,0x6b,0x3f,0x9c,0x04,0x00,0xf6,0x03,
+    0xd6,0x6b,0x3f,0xa3,0xe1,0x70,0x40,0x79,0x6d,0x6f,0x46,0x00,0x2f,0x42,0x38,0x9b,
+    0x36,0x32,0x14,0x01,0x0f,0xac,0x01,0x01,0x0f,0xa4,0x01,0x26,0x11,0x36,0x48,0x03,
+    0xd8,0xde,0x3f,0x48,0x39,0x97,0x3e,0x45,0x38,0x9e,0x3e,0x45,0x38,0x9f,0x04,0x00,
+    0xf3,0x09,0x3d,0x42,0x38,0xa2,0x3f,0x47,0x39,0x8e,0x49,0x66,0x44,0x05,0x49,0x68,
+    0x45,0x00,0x47,0x63,0x43,0x00,0x44,0x59,0x3f,0x1e,0x30,0x03,0x01,0xc4,0x02,0x04,
+    0xa0,0x01,0xf1,0x04,0x39,0x38,0x34,0xff,0x36,0x31,0x31,0xff,0x40,0x4d,0x3c,0x63,
+    0x48,0x65,0x45,0x00,0x45,0x5d,0x42,0x04,0x00,0xb1,0x49,0x69,0x45,0x00,0x4a,0x6d,
+    0x46,0x00,0x4b,0x70,0x47,0x5c,0x01,0x41,0x3a,0x3b,0x35,0xd1,0xe4,0x01,0x12,0x39,
+    0x34,0x00,0x12,0x37,0xdc,0x00,0xf1,0x02,0xef,0x3c,0x42,0x38,0xac,0x3f,0x48,0x39,
+    0x90,0x3d,0x43,0x38,0xa8,0x3a,0x39,0x34,0xe7,0x18,0x00,0x03,0x64,0x00,0xcf,0x36,
+    0x2f,0x31,0xff,0x3f,0x49,0x3a,0x91,0x4b,0x6b,0x46,0x00,0xa4,0x01,0x02,0xf8,0x00,
+    0x36,0x34,0xff,0x3a,0x3b,0x35,0xe8,0x3f,0x48,0x39,0x9a,0x3e,0x45,0x38,0x9d,0xc4,
+    0x00,0x03,0x0c,0x00,0xff,0x00,0xa2,0x3e,0x45,0x38,0x96,0x69,0xda,0x64,0xff,0x6a,
+    0xdf,0x65,0xff,0x6a,0xde,0x04,0x00,0x03,0xff,0x08,0x6b,0xe0,0x65,0xff,0x57,0xed,
+    0x6a,0xff,0x8d,0x9c,0x50,0x01,0xf8,0x53,0x37,0x9a,0xff,0x63,0x3a,0xff,0xff,0x64,
+    0x3b,0x04,0x00,0x08,0xb2,0x3a,0xff,0xa8,0x71,0x43,0x29,0x2d,0x4b,0x3b,0x34,0x33,
+    0xc8,0x00,0x02,0x14,0x01,0x0f,0x08,0x00,0x00,0x0f,0xa4,0x01,0x25,0x62,0x39,0x39,
+    0x34,0xff,0x39,0x37,0x28,0x01,0x0f,0x04,0x00,0x01,0xf1,0x00,0x36,0x2f,0x31,0xff,
+    0x38,0x35,0x33,0xff,0x46,0x60,0x41,0x08,0x48,0x64,0x43,0xbc,0x04,0x81,0x47,0x62,
+    0x42,0x00,0x3c,0x40,0x36,0xc8,0x44,0x01,0x08,0x8c,0x00,0xf1,0x03,0x37,0x34,0xff,
+    0x38,0x36,0x33,0xfd,0x44,0x59,0x3f,0x12,0x47,0x61,0x42,0x00,0x46,0x5d,0x41,0x3c,
+    0x05,0xb1,0x46,0x60,0x42,0x00,0x48,0x66,0x44,0x00,0x47,0x64,0x43,0xac,0x01,0x81,
+    0x44,0x59,0x3e,0x15,0x37,0x34,0x33,0xe0,0xa8,0x01,0x04,0x40,0x00,0xa1,0x37,0x34,
+    0xff,0x37,0x33,0x32,0xff,0x37,0x30,0x32,0x08,0x00,0x13,0x38,0x9c,0x01,0x04,0x9c,
+    0x00,0x71,0x3a,0x39,0x35,0xc0,0x46,0x5f,0x42,0x00,0x05,0x01,0xa4,0x01,0x0b,0xec,
+    0x04,0x0f,0xc8,0x00,0x0d,0x04,0xdc,0x00,0xaf,0x67,0xd4,0x62,0xf8,0x67,0xd2,0x62,
+    0xff,0x67,0xd3,0x04,0x00,0x04,0xff,0x07,0xd2,0x62,0xff,0x55,0xe9,0x69,0xfe,0x97,
+    0xa3,0x52,0x02,0xf9,0x52,0x37,0x94,0xff,0x64,0x3b,0xff,0xf8,0x65,0x3c,0x04,0x00,
+    0x06,0xdf,0xff,0x66,0x3b,0xff,0xaa,0x6b,0x42,0x34,0x2a,0x46,0x39,0x3d,0x33,0xf0,
+    0x04,0x0c,0x0f,0xa4,0x01,0x02,0xe1,0x68,0x43,0x00,0x41,0x51,0x3d,0x00,0x3a,0x3d,
+    0x38,0x00,0x3c,0x43,0x39,0x04,0x00,0xb1,0x3d,0x45,0x3a,0x00,0x3a,0x3e,0x37,0x77,
+    0x36,0x32,0x32,0x20,0x04,0x0f,0x04,0x00,0x0d,0x01,0x48,0x01,0x62,0x37,0x34,0xff,
+    0x47,0x60,0x42,0xa4,0x01,0xe9,0x5e,0x41,0x00,0x48,0x64,0x42,0x00,0x40,0x4b,0x3a,
+    0x6d,0x35,0x2d,0x30,0x44,0x00,0xf2,0x00,0x36,0x2d,0x31,0xff,0x3d,0x41,0x37,0xbc,
+    0x49,0x65,0x43,0x00,0x47,0x60,0x41,0x04,0x00,0x12,0x5f,0x08,0x00,0x31,0x48,0x66,
+    0x44,0xa8,0x01,0xf4,0x01,0x49,0x67,0x45,0x00,0x43,0x59,0x3e,0x00,0x41,0x50,0x3c,
+    0x10,0x3d,0x42,0x37,0xaa,0x3c,0x01,0x31,0x38,0x35,0x33,0x0c,0x02,0x22,0x39,0x37,
+    0x3c,0x05,0x01,0xb0,0x01,0x12,0x33,0xb0,0x01,0xf1,0x00,0x3c,0x41,0x37,0x99,0x40,
+    0x4c,0x3b,0x00,0x46,0x5c,0x41,0x00,0x4a,0x68,0x45,0x38,0x05,0xaa,0x49,0x67,0x44,
+    0x00,0x42,0x54,0x3d,0x54,0x35,0x2f,0x84,0x00,0x0f,0xd0,0x00,0x0d,0x4f,0x67,0xd3,
+    0x62,0xf1,0xa0,0x01,0x06,0x03,0xb8,0x01,0xcf,0x55,0xe7,0x68,0xfa,0x92,0xa0,0x51,
+    0x02,0xf5,0x53,0x37,0x90,0xa4,0x01,0x11,0x8f,0xa7,0x6c,0x42,0x30,0x2b,0x47,0x39,
+    0x41,0xa4,0x01,0x22,0xe1,0x66,0x43,0x00,0x43,0x56,0x3e,0x00,0x3e,0x48,0x3a,0x00,
+    0x3f,0x4c,0x3c,0x04,0x00,0xff,0x01,0x40,0x4e,0x3d,0x00,0x3e,0x48,0x3a,0x4f,0x3b,
+    0x3e,0x36,0xc3,0x3c,0x40,0x37,0xbc,0x04,0x00,0x0d,0xf3,0x15,0x3b,0x3e,0x36,0xc0,
+    0x3d,0x43,0x38,0xaa,0x48,0x63,0x43,0x06,0x49,0x67,0x44,0x00,0x48,0x62,0x42,0x00,
+    0x48,0x64,0x41,0x00,0x46,0x5d,0x3f,0x16,0x3b,0x3f,0x36,0xbb,0x3b,0x3f,0x37,0xbf,
+    0x44,0x00,0xc1,0xbd,0x39,0x39,0x34,0xc2,0x44,0x58,0x3f,0x45,0x4c,0x6f,0x47,0x4c,
+    0x01,0x04,0x04,0x00,0x01,0x38,0x00,0x04,0xa4,0x01,0x61,0x68,0x45,0x00,0x42,0x53,
+    0x3d,0x98,0x00,0xf1,0x1c,0x44,0x59,0x3f,0x00,0x3f,0x48,0x3a,0x3e,0x3d,0x45,0x39,
+    0x9a,0x3a,0x3b,0x35,0xd2,0x3a,0x3b,0x35,0xee,0x39,0x38,0x34,0xf6,0x3a,0x3b,0x35,
+    0xed,0x3b,0x3e,0x36,0xce,0x3c,0x42,0x38,0x90,0x40,0x4e,0x3c,0x34,0x41,0x52,0x3d,
+    0xbc,0x00,0x31,0x45,0x59,0x40,0x58,0x00,0x01,0x84,0x08,0xf3,0x00,0x69,0x44,0x00,
+    0x45,0x5a,0x40,0x38,0x3a,0x3c,0x35,0xc1,0x3c,0x40,0x37,0xbd,0x84,0x00,0x0f,0xd0,
+    0x00,0x09,0x5f,0xbf,0x3c,0x40,0x37,0xb2,0xa4,0x01,0x7d,0x31,0x47,0x63,0x42,0x08,
+    0x08,0x36,0x44,0x59,0x40,0x04,0x00,0x21,0x5b,0x41,0x20,0x01,0x7f,0x41,0x4f,0x3b,
+    0x00,0x41,0x51,0x3c,0x04,0x00,0x0e,0x31,0x40,0x4f,0x3b,0x54,0x01,0x72,0x49,0x67,
+    0x44,0x00,0x4a,0x6a,0x45,0x6c,0x01,0x61,0x67,0x42,0x00,0x48,0x65,0x42,0x3c,0x00,
+    0x26,0x40,0x50,0x44,0x00,0x31,0x3f,0x4d,0x3a,0x70,0x00,0x31,0x4c,0x6e,0x47,0x2c,
+    0x00,0x08,0x04,0x00,0x05,0x48,0x03,0x61,0x68,0x45,0x00,0x42,0x54,0x3d,0x54,0x00,
+    0x01,0xac,0x01,0xf1,0x0f,0x55,0x3e,0x00,0x44,0x57,0x3f,0x00,0x43,0x58,0x3f,0x00,
+    0x44,0x59,0x3f,0x0e,0x3c,0x44,0x37,0x18,0x44,0x5a,0x40,0x0d,0x48,0x63,0x44,0x00,
+    0x42,0x51,0x3d,0x60,0x0a,0x71,0x40,0x4f,0x3c,0x00,0x3f,0x4a,0x3b,0x4c,0x08,0x22,
+    0x4a,0x6c,0xd4,0x09,0xaf,0x4a,0x6c,0x45,0x00,0x48,0x62,0x43,0x00,0x40,0x4e,0xc8,
+    0x00,0x13,0x04,0xec,0x00,0x4f,0x67,0xd3,0x62,0xf3,0x48,0x03,0x6c,0x18,0x99,0x7c,
+    0x0b,0xf1,0x08,0x47,0x62,0x42,0x00,0x48,0x65,0x43,0x00,0x45,0x5b,0x40,0x00,0x42,
+    0x54,0x3e,0x00,0x43,0x56,0x3f,0x00,0x43,0x58,0x40,0x20,0x01,0x7f,0x40,0x4b,0x3a,
+    0x00,0x40,0x4d,0x3b,0x04,0x00,0x0e,0xf1,0x00,0x3f,0x4b,0x3a,0x00,0x41,0x4f,0x3c,
+    0x00,0x49,0x66,0x44,0x00,0x4a,0x69,0x45,0x50,0x00,0x71,0x48,0x66,0x42,0x00,0x47,
+    0x62,0x41,0x3c,0x00,0x26,0x3f,0x4c,0x44,0x00,0x31,0x3e,0x49,0x39,0xb0,0x06,0x31,
+    0x4c,0x6d,0x47,0x2c,0x00,0x08,0x04,0x00,0x0f,0xa4,0x01,0x05,0x22,0x42,0x51,0x04,
+    0x00,0x31,0x43,0x58,0x3f,0xa8,0x00,0xfa,0x04,0x3c,0x45,0x37,0x00,0x45,0x5c,0x41,
+    0x00,0x48,0x63,0x44,0x00,0x40,0x4c,0x3b,0x00,0x43,0x54,0x3e,0xa4,0x01,0x21,0x6b,
+    0x45,0xc8,0x0b,0x22,0x4a,0x6b,0xf4,0x04,0x2f,0x3f,0x4a,0xc8,0x00,0x13,0x80,0x40,
+    0x4d,0x3b,0x00,0x40,0x4d,0x3b,0x00,0xaf,0x68,0xd7,0x63,0xfa,0x67,0xd1,0x62,0xff,
+    0x67,0xd3,0x04,0x00,0x07,0xff,0x04,0x55,0xe7,0x68,0xfa,0x92,0xa0,0x51,0x02,0xf5,
+    0x53,0x37,0x90,0xff,0x64,0x3b,0xff,0xf8,0x65,0x3c,0x04,0x00,0x06,0xff,0x04,0xff,
+    0x66,0x3b,0xff,0xa7,0x6c,0x42,0x30,0x2b,0x47,0x39,0x41,0x33,0x33,0x32,0xff,0x39,
+    0x38,0x34,0x04,0x00,0x06,0xf9,0x00,0x36,0x2f,0x31,0xff,0x3f,0x49,0x3a,0x9d,0x4a,
+    0x6b,0x45,0x00,0x48,0x64,0x43,0x04,0x00,0xff,0x0c,0x47,0x63,0x42,0x00,0x43,0x56,
+    0x3f,0x00,0x42,0x55,0x3f,0x00,0x43,0x58,0x40,0x00,0x42,0x53,0x3d,0x00,0x40,0x4b,
+    0x3a,0x00,0x40,0x4d,0x3b,0x04,0x00,0x0e,0xf1,0x0c,0x3f,0x4b,0x3a,0x00,0x41,0x4f,
+    0x3c,0x00,0x49,0x66,0x44,0x00,0x4a,0x69,0x45,0x00,0x48,0x65,0x43,0x00,0x48,0x66,
+    0x42,0x00,0x47,0x62,0x41,0x3c,0x00,0x26,0x3f,0x4c,0x44,0x00,0xb1,0x3e,0x49,0x39,
+    0x00,0x46,0x5f,0x41,0x00,0x4c,0x6d,0x47,0x2c,0x00,0x08,0x04,0x00,0xf1,0x00,0x48,
+    0x66,0x44,0x00,0x48,0x66,0x44,0x00,0x49,0x68,0x45,0x00,0x42,0x54,0x3d,0x84,0x00,
+    0x62,0x42,0x53,0x3d,0x00,0x42,0x51,0x04,0x00,0xf1,0x20,0x43,0x57,0x3f,0x00,0x44,
+    0x59,0x3f,0x00,0x3c,0x44,0x37,0x00,0x44,0x5a,0x40,0x00,0x47,0x61,0x43,0x00,0x40,
+    0x4c,0x3b,0x00,0x43,0x54,0x3e,0x00,0x40,0x4f,0x3c,0x00,0x3f,0x4a,0x3b,0x00,0x45,
+    0x59,0x40,0x00,0x4a,0x6b,0x45,0x00,0x49,0x67,0x44,0x08,0x00,0x6f,0x47,0x60,0x42,
+    0x00,0x3f,0x4a,0xc8,0x00,0x13,0x04,0xec,0x00,0xaf,0x66,0xd0,0x61,0xd7,0x69,0xd9,
+    0x64,0xff,0x67,0xd2,0xa4,0x01,0x5c,0xf6,0x03,0x39,0x34,0xff,0x36,0x30,0x31,0xff,
+    0x3e,0x49,0x3a,0x79,0x47,0x63,0x43,0x00,0x45,0x5d,0x41,0x04,0x00,0x9f,0x5c,0x41,
+    0x00,0x45,0x5e,0x40,0x00,0x43,0x57,0xa4,0x01,0xf3,0xb1,0x5a,0xa2,0x54,0x4e,0x6c,
+    0xe3,0x67,0xff,0x69,0xd8,0x64,0x4c,0x03,0x53,0x66,0xd3,0x61,0xff,0x67,0x04,0x00,
+    0xff,0x0c,0x66,0xd3,0x61,0xff,0x66,0xd2,0x61,0xff,0x54,0xeb,0x69,0xff,0x9a,0xa3,
+    0x52,0x02,0xff,0x51,0x36,0x9e,0xff,0x64,0x3a,0xff,0xf8,0x64,0x3b,0x04,0x00,0x02,
+    0xff,0x0b,0xf7,0x64,0x3b,0xff,0xff,0x66,0x3b,0xff,0xb1,0x6c,0x43,0x37,0x28,0x44,
+    0x38,0x4a,0x32,0x31,0x31,0xff,0x38,0x38,0x33,0xff,0x38,0x37,0x04,0x00,0x00,0xe9,
+    0x33,0x33,0xff,0x38,0x36,0x34,0xf7,0x46,0x60,0x42,0x16,0x4a,0x68,0x44,0x44,0x03,
+    0x31,0x48,0x64,0x43,0x04,0x03,0x7f,0x46,0x5d,0x41,0x00,0x42,0x54,0x3e,0x48,0x03,
+    0xee,0xfb,0x03,0x53,0x88,0x4d,0x00,0x62,0xbd,0x5c,0x6e,0x65,0xd4,0x60,0xef,0x62,
+    0xd4,0x5d,0xff,0x62,0xd2,0x04,0x00,0xfd,0x0b,0xd6,0x5d,0xff,0x55,0xdb,0x62,0xe7,
+    0x78,0x91,0x4f,0x00,0xda,0x57,0x38,0x73,0xff,0x5f,0x34,0xff,0xf8,0x60,0x35,0xff,
+    0xf8,0x60,0x36,0x04,0x00,0xf7,0x0b,0xfb,0x5f,0x35,0xff,0xfb,0x62,0x37,0xff,0x8c,
+    0x6f,0x43,0x1a,0x31,0x4f,0x3b,0x2a,0x2f,0x2d,0x2c,0xff,0x32,0x31,0x2d,0xff,0x33,
+    0x32,0x04,0x00,0xfd,0x07,0x31,0x2d,0xff,0x32,0x2f,0x2c,0xff,0x36,0x34,0x31,0xd1,
+    0x43,0x53,0x3f,0x30,0x4c,0x6e,0x49,0x00,0x4a,0x68,0x47,0x04,0x00,0xb2,0x4b,0x6a,
+    0x48,0x00,0x48,0x64,0x45,0x00,0x43,0x55,0x3f,0x50,0x03,0x0f,0xec,0x04,0xe8,0xf1,
+    0x09,0x55,0x8d,0x50,0x00,0x57,0xa8,0x51,0x00,0x5f,0xb2,0x59,0x2f,0x81,0xcd,0x7d,
+    0x68,0x85,0xdf,0x82,0x6e,0x83,0xda,0x80,0x6c,0x04,0x00,0xfc,0x10,0xdc,0x80,0x6d,
+    0x88,0xdc,0x85,0x6e,0x61,0xbe,0x67,0x35,0x5b,0x82,0x44,0x00,0x9a,0x62,0x41,0x0d,
+    0xee,0x81,0x60,0x67,0xfe,0x83,0x62,0x6f,0xf9,0x81,0x60,0x6c,0x04,0x00,0xf1,0x0d,
+    0xff,0x86,0x67,0x6f,0xd9,0x78,0x52,0x50,0x57,0x66,0x36,0x00,0x3e,0x5f,0x3d,0x00,
+    0x58,0x5e,0x56,0x58,0x5f,0x5b,0x5d,0x70,0x5c,0x5c,0x5a,0x6c,0x04,0x00,0xfd,0x0b,
+    0x5b,0x5a,0x6c,0x5e,0x5d,0x5c,0x6f,0x61,0x6b,0x5d,0x61,0x3f,0x4e,0x3b,0x15,0x42,
+    0x57,0x3e,0x00,0x4b,0x6b,0x49,0x00,0x49,0x64,0x46,0x04,0x00,0x71,0x4a,0x66,0x47,
+    0x00,0x48,0x63,0x45,0x94,0x06,0x0f,0xa4,0x01,0xed,0x3f,0xff,0xff,0xff,0x04,0x00,
+    0xff,0xff,0xff,0xff,0xd5,0x50,0x00,0xff,0xff,0xff,0x00,
+
+};
+
+const lv_image_dsc_t test_lvgl_logo_ARGB8888_LZ4_band8 = {
+  .header = {
+    .magic = LV_IMAGE_HEADER_MAGIC,
+    .cf = LV_COLOR_FORMAT_ARGB8888,
+    .flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .w = 105,
+    .h = 40,
+    .stride = 420,
+    .reserved_2 = 0,
+  },
+  .data_size = sizeof(test_lvgl_logo_ARGB8888_LZ4_band8_map),
+  .data = test_lvgl_logo_ARGB8888_LZ4_band8_map,
+  .reserved = NULL,
+};
+
@@ -0,0 +1,81 @@
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+#include "lvgl.h"
+#elif defined(LV_LVGL_H_INCLUDE_SYSTEM)
+#include <lvgl.h>
+#elif defined(LV_BUILD_TEST)
+#include "../lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_TEST_LVGL_LOGO_RGB565
+#define LV_ATTRIBUTE_TEST_LVGL_LOGO_RGB565
+#endif
+
+static const
+LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_TEST_LVGL_LOGO_RGB565
+uint8_t test_lvgl_logo_RGB565_map[] = {
+
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x5c,0xe7,0xba,0xd6,0x1c,0xdf,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0xfb,0xde,0x1c,0xe7,0x9a,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x17,0xbe,0x8a,0x4a,0x65,0x29,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x45,0x21,0x86,0x29,0x6d,0x6b,0x5c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xba,0xce,0x66,0x29,0xa6,0x31,0xa6,0x31,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0xa6,0x29,0x86,0x29,0x66,0x29,0x66,0x29,0x86,0x31,0x86,0x31,0x49,0x42,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xeb,0x5a,0x86,0x31,0xc7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0xc7,0x31,0x34,0xa5,0x17,0xbe,0xcb,0x5a,0xa7,0x31,0x66,0x31,0x75,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xc7,0x31,0xc7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x54,0xa5,0xff,0xff,0xff,0xff,0xbe,0xf7,0x28,0x42,0x66,0x29,0x71,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x08,0x3a,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x79,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0x89,0x4a,0x46,0x29,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x08,0x3a,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0xeb,0x5a,0x5c,0xe7,0xff,0xff,0xf3,0x9c,0xa6,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x08,0x3a,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xc7,0x31,0xa6,0x31,0xe7,0x39,0x89,0x4a,0x86,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xef,0x73,0xef,0x7b,0xcf,0x73,0x75,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb6,0xad,0xcf,0x73,0xef,0x7b,0xef,0x73,0x50,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x75,0xa5,0xcf,0x73,0xef,0x7b,0xef,0x73,0xb2,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,0x34,0xa5,0x8e,0x6b,0xaa,0x4a,0x89,0x4a,0xaa,0x52,0xcf,0x73,0x95,0xad,0x9d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xde,0xcf,0x73,0xef,0x7b,0xef,0x73,0xf3,0x9c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xe7,0x39,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0xa6,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0x9d,0x86,0x31,0x86,0x31,0x86,0x31,0x2c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb5,0x66,0x31,0x86,0x31,0x86,0x31,0x66,0x31,0xb9,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xa7,0x31,0x66,0x31,0x86,0x31,0x46,0x29,0xef,0x73,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x92,0x8c,0xc7,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0xa6,0x31,0x86,0x31,0x66,0x31,0x08,0x3a,0x75,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x37,0xbe,0x66,0x31,0x86,0x31,0x86,0x31,0x6a,0x4a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x49,0x42,0xa6,0x31,0xa7,0x31,0x66,0x31,0xd2,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xc6,0x86,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0xfb,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0x6d,0x63,0x66,0x31,0xa7,0x31,0xc7,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0xa6,0x31,0xa7,0x31,0xc7,0x31,0x86,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xb6,0xad,0x4d,0x5b,0x4d,0x5b,0x6e,0x5b,0x6e,0x5b,0x6e,0x5b,0x6e,0x5b,0x4e,0x5b,0x8e,0x5b,0xab,0x4a,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb1,0x8c,0x66,0x31,0xa7,0x31,0x86,0x31,0xaa,0x4a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x91,0x84,0x66,0x31,0xa7,0x31,0x86,0x31,0xcb,0x52,0xff,0xff,0xff,0xff,0xff,0xff,0x8e,0x6b,0x66,0x31,0xc7,0x31,0xa7,0x31,0x86,0x31,0xa7,0x31,0x4d,0x63,0x0f,0x7c,0x4c,0x63,0xa6,0x31,0x86,0x31,0xc7,0x31,0xa7,0x31,0x46,0x29,0x95,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0x95,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xba,0xd6,0x86,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0xdb,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x69,0x4a,0x86,0x31,0xa7,0x31,0x66,0x31,0x13,0x9d,0xff,0xff,0xff,0xff,0x38,0xc6,0x66,0x31,0xa7,0x31,0xc7,0x31,0x86,0x31,0xae,0x73,0x3c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xde,0x0b,0x5b,0x86,0x31,0xc7,0x31,0xa6,0x31,0xa6,0x31,0x9e,0xef,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x72,0xe5,0xc7,0xfb,0xc7,0xfb,0xc7,0xfb,0xc7,0xfb,0xc7,0xfb,0xc7,0xfb,0xc7,0xfb,0xa6,0xfb,0x50,0xed,0xff,0xff,0x4d,0x5b,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8a,0x4a,0x86,0x31,0xa7,0x31,0x86,0x31,0x13,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xba,0xd6,0x86,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x3c,0xe7,0xff,0xff,0xff,0xff,0xca,0x52,0x86,0x31,0xc7,0x31,0x86,0x31,0x4d,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xa7,0x31,0xa6,0x31,0xa7,0x31,0x66,0x31,0xd2,0x94,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xe3,0xfa,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0x02,0xfb,0xff,0xff,0xd3,0x84,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd2,0x94,0x66,0x31,0xa7,0x31,0x86,0x31,0x0b,0x5b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd2,0x94,0x66,0x31,0xa7,0x31,0x86,0x31,0x0b,0x5b,0xff,0xff,0xff,0xff,0xfb,0xde,0xa6,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x3c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x17,0xbe,0xcf,0x7b,0x30,0x84,0xcf,0x7b,0xd6,0xb5,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x25,0xf3,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0x23,0xfb,0xff,0xff,0x72,0x7c,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xda,0xd6,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0x3c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xca,0x52,0x86,0x31,0xa7,0x31,0x66,0x31,0x54,0xa5,0xff,0xff,0xff,0xff,0x75,0xa5,0x86,0x31,0xa7,0x31,0x86,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x25,0xf3,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0x23,0xfb,0xff,0xff,0x72,0x7c,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xaa,0x52,0x86,0x31,0xa7,0x31,0x66,0x31,0x75,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xde,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0x3c,0xe7,0xff,0xff,0xff,0xff,0xb1,0x8c,0x66,0x29,0xa7,0x31,0x86,0x31,0xb2,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x25,0xf3,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0x23,0xfb,0xff,0xff,0x72,0x7c,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x13,0x9d,0x66,0x31,0xa7,0x31,0x86,0x31,0x6d,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0x33,0x9d,0x66,0x31,0xa7,0x31,0x86,0x31,0x2c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0x30,0x7c,0x86,0x31,0xa7,0x31,0xa6,0x31,0x14,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xde,0x30,0x7c,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x30,0x7c,0xf3,0x9c,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x25,0xf3,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0x23,0xfb,0xff,0xff,0x72,0x7c,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1b,0xdf,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x7d,0xef,0xff,0xff,0xff,0xff,0x0b,0x5b,0x86,0x31,0xa7,0x31,0x86,0x31,0x75,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0x30,0x7c,0x86,0x31,0xa7,0x31,0xa6,0x31,0x14,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x17,0xbe,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x66,0x31,0x08,0x3a,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x25,0xf3,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0x23,0xfb,0xff,0xff,0x72,0x7c,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xeb,0x5a,0x86,0x31,0xa7,0x31,0x86,0x31,0xb6,0xad,0xff,0xff,0x3c,0xe7,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0x5d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xb1,0x8c,0x66,0x29,0xa7,0x31,0x86,0x31,0xd2,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x17,0xbe,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0xeb,0x5a,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x25,0xf3,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0xe3,0xf2,0x23,0xfb,0xff,0xff,0x72,0x7c,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0x86,0x31,0xa7,0x31,0x86,0x31,0xce,0x6b,0xff,0xff,0x75,0xa5,0x86,0x31,0xa7,0x31,0x86,0x31,0x6d,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0x86,0x31,0xa7,0x31,0x86,0x31,0x6d,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,0xf3,0x9c,0x14,0xa5,0x34,0xa5,0xd3,0x94,0xc7,0x31,0xa7,0x31,0xa6,0x31,0x0c,0x5b,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xe3,0xfa,0xe3,0xfa,0xe3,0xfa,0xe3,0xfa,0xe3,0xfa,0xe3,0xfa,0xe3,0xfa,0xe3,0xfa,0xe3,0xfa,0x02,0xfb,0xff,0xff,0x10,0x6c,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xe8,0x39,0xff,0xff,0x0f,0x7c,0x86,0x31,0xa7,0x31,0x66,0x31,0xb6,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xba,0xce,0x86,0x31,0xa7,0x31,0xa6,0x31,0xa7,0x31,0x7d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0xa6,0x31,0xa7,0x31,0x86,0x31,0xae,0x73,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xce,0xf4,0xe4,0xf2,0xe4,0xea,0x05,0xeb,0x05,0xeb,0x05,0xeb,0x05,0xeb,0xe5,0xea,0xc4,0xfa,0x2b,0xfc,0xff,0xff,0xf7,0xb5,0xe7,0x39,0xe6,0x39,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x07,0x3a,0x27,0x42,0xa5,0x31,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,0x5b,0x86,0x31,0xa7,0x31,0xa6,0x31,0x13,0x9d,0xca,0x52,0xa6,0x31,0xa6,0x31,0xa7,0x31,0x7d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x49,0x42,0x86,0x31,0xc7,0x31,0x86,0x31,0xee,0x73,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x2f,0x7c,0x86,0x31,0xc7,0x31,0x66,0x31,0x33,0x9d,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x4c,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf3,0x94,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0x86,0x31,0x30,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x54,0xa5,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa6,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x8d,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0x66,0x29,0xc7,0x31,0xa7,0x31,0x86,0x31,0x71,0x84,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xf3,0x94,0xa6,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x5c,0xe7,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0x86,0x31,0x6d,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x39,0xc7,0xf4,0x96,0xd3,0x96,0xd4,0x96,0xd4,0x96,0xd4,0x96,0xd4,0x96,0xd4,0x96,0xf4,0x96,0x37,0xb7,0xff,0xff,0x3e,0xdf,0x3d,0x8d,0x1c,0x85,0x1c,0x8d,0x1c,0x8d,0x1c,0x8d,0x1c,0x8d,0x1c,0x8d,0xfc,0x84,0xdd,0xa5,0xff,0xff,0x50,0x84,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xa6,0x31,0xaa,0x4a,0x91,0x8c,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x30,0x84,0xb2,0x94,0xdf,0xff,0xff,0xff,0xff,0xff,0x5d,0xe7,0xa6,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0xd6,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xeb,0x5a,0x86,0x31,0xc7,0x31,0xa7,0x31,0x86,0x31,0x28,0x42,0xef,0x7b,0xb2,0x8c,0x0f,0x7c,0x49,0x42,0x86,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0xb2,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xa6,0x31,0x69,0x42,0x71,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x91,0x8c,
+    0xcd,0x66,0xed,0x66,0xed,0x66,0xed,0x66,0xed,0x66,0xed,0x66,0xed,0x66,0xed,0x66,0xed,0x66,0x6a,0x6f,0xff,0xff,0xbf,0x84,0x1f,0x3b,0x1f,0x3b,0x1f,0x3b,0x1f,0x3b,0x1f,0x3b,0x1f,0x3b,0x1f,0x3b,0x1f,0x3b,0x1f,0x3b,0x3e,0xdf,0xda,0xd6,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0xa6,0x31,0xa7,0x31,0xc7,0x31,0xa7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x66,0x31,0xa6,0x31,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x4c,0x63,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xef,0x69,0x4a,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x66,0x31,0x86,0x31,0xa6,0x31,0xa7,0x31,0xa7,0x31,0x86,0x31,0x4d,0x63,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x78,0xc6,0x86,0x31,0xa7,0x31,0xc7,0x31,0xa7,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,
+    0xad,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x4a,0x6f,0xff,0xff,0xdf,0x8c,0x1f,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3f,0x3b,0xfd,0xd6,0x99,0xce,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xa7,0x31,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x95,0xad,0x66,0x29,0x86,0x31,0x86,0x31,0x86,0x31,0x66,0x31,0x8d,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0x0f,0x7c,0x86,0x31,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa7,0x31,0xa6,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x71,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x37,0xbe,0x66,0x29,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,
+    0xad,0x6e,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x2a,0x6f,0xff,0xff,0xff,0x8c,0x1f,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3f,0x3b,0x1d,0xdf,0x79,0xce,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0x4d,0x63,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x6d,0x63,0x0f,0x7c,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0xef,0x8d,0x6b,0x6d,0x6b,0x8d,0x6b,0x8d,0x6b,0x2c,0x63,0x99,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x99,0xce,0x71,0x84,0xeb,0x5a,0x28,0x42,0xe7,0x39,0x48,0x42,0x0c,0x5b,0x92,0x8c,0xda,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xda,0xd6,0x4d,0x63,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x8d,0x6b,0x6d,0x6b,0xce,0x73,
+    0xad,0x6e,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x2a,0x6f,0xff,0xff,0xff,0x8c,0x1f,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3f,0x3b,0x1d,0xdf,0x79,0xce,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x7d,0xef,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xad,0x6e,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x2a,0x6f,0xff,0xff,0xff,0x8c,0x1f,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3f,0x3b,0x1d,0xdf,0x79,0xce,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x91,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xad,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x2a,0x6f,0xff,0xff,0xff,0x8c,0x1f,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3f,0x3b,0x1d,0xdf,0x79,0xce,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0x66,0x31,0x71,0x84,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xaf,0x7e,0xcd,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x2a,0x6f,0xff,0xff,0xff,0x8c,0x1f,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3e,0x3b,0x3f,0x3b,0x1d,0xdf,0x79,0xce,0x86,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xa7,0x31,0xc7,0x31,0x66,0x31,0x34,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x19,0xcf,0x0d,0x67,0xad,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x8c,0x66,0x4a,0x6f,0xff,0xff,0x9f,0x84,0x1f,0x3b,0x1e,0x3b,0x1e,0x3b,0x1e,0x3b,0x1e,0x3b,0x1e,0x3b,0x1e,0x3b,0x1e,0x3b,0x3f,0x3b,0xfd,0xd6,0x37,0xc6,0x86,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0xa6,0x31,0x86,0x31,0xe7,0x39,0x9d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x17,0xb7,0xad,0x6e,0x8c,0x5e,0x8c,0x5e,0x8c,0x5e,0x8c,0x5e,0x8c,0x5e,0xac,0x5e,0xec,0x76,0xff,0xff,0x9d,0xa5,0xff,0x32,0xfe,0x32,0xfe,0x32,0xfe,0x32,0xfe,0x32,0xfe,0x32,0xfe,0x32,0xff,0x32,0x1f,0x33,0x7e,0xef,0x1b,0xdf,0x65,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0x66,0x29,0xcb,0x52,0xfb,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x7c,0xdf,0x59,0xcf,0x99,0xcf,0x79,0xcf,0x79,0xcf,0x79,0xc7,0x79,0xcf,0x9b,0xdf,0xff,0xff,0xbf,0xf7,0x5e,0xbe,0x5f,0xbe,0x5f,0xbe,0x5f,0xbe,0x5f,0xbe,0x5f,0xbe,0x5f,0xbe,0x5f,0xbe,0x9e,0xc6,0xff,0xff,0xff,0xff,0x38,0xc6,0xb7,0xb5,0xd7,0xbd,0xd7,0xbd,0xd7,0xbd,0xb7,0xb5,0x38,0xc6,0x7d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+
+};
+
+const lv_image_dsc_t test_lvgl_logo_RGB565 = {
+  .header = {
+    .magic = LV_IMAGE_HEADER_MAGIC,
+    .cf = LV_COLOR_FORMAT_RGB565,
+    .flags = 0,
+    .w = 105,
+    .h = 40,
+    .stride = 210,
+    .reserved_2 = 0,
+  },
+  .data_size = sizeof(test_lvgl_logo_RGB565_map),
+  .data = test_lvgl_logo_RGB565_map,
+  .reserved = NULL,
+};
+